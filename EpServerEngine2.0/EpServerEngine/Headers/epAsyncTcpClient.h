@@ -43,6 +43,8 @@ An Interface for Asynchronous TCP Client.
 #include "epServerObjectList.h"
 
 #include "epClientPacketProcessor.h"
+#include "epPacketDispatchQueue.h"
+#include "epPacketReceiveBuffer.h"
 
 
 namespace epse{
@@ -51,7 +53,7 @@ namespace epse{
 	@class AsyncTcpClient epAsyncTcpClient.h
 	@brief A class for Asynchronous TCP Client.
 	*/
-	class EP_SERVER_ENGINE AsyncTcpClient:public BaseTcpClient{
+	class EP_SERVER_ENGINE AsyncTcpClient:public BaseTcpClient, public PacketDispatchDelegate{
 	public:
 		/*!
 		Default Constructor
@@ -145,6 +147,12 @@ namespace epse{
 		*/
 		void disconnect();
 
+		/*!
+		Call Back Function when the dispatched packet is processed by the worker thread.
+		@param[in] packet the received packet
+		*/
+		virtual void OnPacketDispatched(Packet *packet);
+
 
 	private:
 
@@ -157,6 +165,15 @@ namespace epse{
 		/// Flag for Asynchronous Receive
 		bool m_isAsynchronousReceive;
 
+		/// packet dispatcher for PACKET_DISPATCH_TYPE_POOL and PACKET_DISPATCH_TYPE_POOL_ORDERED
+		PacketDispatcher *m_packetDispatcher;
+
+		/// dispatch queue for the shared worker threads
+		PacketDispatchQueue m_dispatchQueue;
+
+		/// receive buffer for the receive thread
+		PacketReceiveBuffer m_packetRecvBuffer;
+
 
 	};
 }
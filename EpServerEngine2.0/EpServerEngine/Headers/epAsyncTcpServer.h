@@ -40,6 +40,11 @@ An Interface for Asynchronous TCP Server.
 
 #include "epServerEngine.h"
 #include "epBaseTcpServer.h"
+#include "epIocpCompletionPort.h"
+#include "epPacketDispatcher.h"
+#include <vector>
+
+using namespace std;
 
 namespace epse{
 
@@ -48,7 +53,7 @@ namespace epse{
 	@class AsyncTcpServer epAsyncTcpServer.h
 	@brief A class for Asynchronous TCP Server.
 	*/
-	class EP_SERVER_ENGINE AsyncTcpServer:public BaseTcpServer{
+	class EP_SERVER_ENGINE AsyncTcpServer:public BaseTcpServer, public IocpCompletionPortDelegate{
 
 	public:
 		/*!
@@ -100,17 +105,48 @@ namespace epse{
 		@remark if argument is NULL then previously setting value is used
 		*/
 		bool StartServer(const ServerOps &ops=ServerOps::defaultServerOps);
+
+		/*!
+		Stop the server
+		*/
+		virtual void StopServer();
 	
 	private:
 
 		/*!
-		Listening Loop Function
+		Call Back Function when the socket of the event loop is read.
+		@param[in] context the socket which was waiting for the data
+		@param[in] transferredByte the byte size read into the buffer
+		@param[in] isSucceeded the flag whether the overlapped receive succeeded
+		*/
+		virtual void OnIoCompleted(epl::SmartObject *context,unsigned long transferredByte,bool isSucceeded);
+
+		/*!
+		Close all the event loops
 		*/
-		virtual void execute() ;
+		void closeEventLoop();
+
+		/*!
+		Accept on the given listening socket until the server stops
+		@param[in] listenSocket the listening socket to loop on
+		*/
+		virtual void listenLoop(SOCKET listenSocket);
 
 		/// Flag for Asynchronous Receive
 		bool m_isAsynchronousReceive;
 
+		/// event loop list
+		vector<IocpCompletionPort*> m_eventLoopList;
+
+		/// index of the event loop for the next socket
+		volatile long m_nextEventLoopIdx;
+
+		/// packet dispatcher for PACKET_DISPATCH_TYPE_POOL and PACKET_DISPATCH_TYPE_POOL_ORDERED
+		PacketDispatcher *m_packetDispatcher;
+
+		/// Packet Dispatch Type
+		PacketDispatchType m_packetDispatchType;
+
 
 	};
 }
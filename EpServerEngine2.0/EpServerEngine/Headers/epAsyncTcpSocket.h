@@ -40,6 +40,10 @@ An Interface for Asynchronous TCP Socket.
 
 #include "epServerEngine.h"
 #include "epBaseTcpSocket.h"
+#include "epIocpCompletionPort.h"
+#include "epIocpReceiveBuffer.h"
+#include "epPacketReceiveBuffer.h"
+#include "epPacketDispatchQueue.h"
 
 namespace epse
 {
@@ -48,7 +52,7 @@ namespace epse
 	@class AsyncTcpSocket epAsyncTcpSocket.h
 	@brief A class for Asynchronous TCP Socket.
 	*/
-	class EP_SERVER_ENGINE AsyncTcpSocket:public BaseTcpSocket
+	class EP_SERVER_ENGINE AsyncTcpSocket:public BaseTcpSocket, public PacketDispatchDelegate
 	{
 	public:
 		/*!
@@ -70,6 +74,12 @@ namespace epse
 		*/
 		virtual ~AsyncTcpSocket();
 
+		/*!
+		Check if the connection is alive
+		@return true if the connection is alive otherwise false
+		*/
+		virtual bool IsConnectionAlive() const;
+
 		/*!
 		Kill the connection
 		*/
@@ -120,6 +130,66 @@ namespace epse
 		*/
 		virtual void execute();
 
+		/*!
+		Process the received packet
+		@param[in] recvPacket the received packet
+		*/
+		void processPacket(Packet *recvPacket);
+
+		/*!
+		Set the dispatcher to process the received packets with
+		@param[in] dispatcher the packet dispatcher
+		@param[in] isOrdered the flag whether the packets are processed in the received order
+		*/
+		void setPacketDispatcher(PacketDispatcher *dispatcher,bool isOrdered);
+
+		/*!
+		Call Back Function when the dispatched packet is processed by the worker thread.
+		@param[in] packet the received packet
+		*/
+		virtual void OnPacketDispatched(Packet *packet);
+
+		/*!
+		Call Back Function when the processed packet is no longer counted as pending.
+		@remark the receive paused by the event loop is resumed if the processors are available.
+		*/
+		virtual void OnPacketCompleted();
+
+		/*!
+		Check if the packets being processed reached the maximum processor count
+		@return true if no more packet can be processed otherwise false
+		*/
+		bool isProcessorFull() const;
+
+		/*!
+		Set the event loop which drives this socket
+		@param[in] eventLoop the event loop
+		*/
+		void setEventLoop(IocpCompletionPort *eventLoop);
+
+		/*!
+		Start receiving on the event loop instead of the socket thread
+		*/
+		void startEventLoop();
+
+		/*!
+		Post the overlapped receive to the event loop
+		*/
+		void postReceive();
+
+		/*!
+		Assemble the packets from the data read by the event loop
+		@param[in] transferredByte the byte size read into the buffer
+		@param[in] isSucceeded the flag whether the overlapped receive succeeded
+		*/
+		void processReceive(unsigned long transferredByte,bool isSucceeded);
+
+		/*!
+		Process the data in the receive buffer and post the next receive
+		@remark the next receive is not posted while the processors are full.
+		*/
+		void processBuffer();
+
 		
 	private:
 		/*!
@@ -146,12 +216,33 @@ namespace epse
 		/// processor thread list
 		ServerObjectList m_processorList;
 
+		/// dispatch queue for the shared worker threads
+		PacketDispatchQueue m_dispatchQueue;
+
 		/// Maximum Processor Count
 		unsigned int m_maxProcessorCount;
 
 		/// Flag for Asynchronous Receive
 		bool m_isAsynchronousReceive;
 
+		/// event loop which drives this socket
+		IocpCompletionPort *m_eventLoop;
+		/// Connection status for the event loop mode
+		bool m_isConnected;
+		/// receive buffer for the socket thread
+		PacketReceiveBuffer m_packetRecvBuffer;
+
+		/// receive buffer for the event loop mode
+		IocpReceiveBuffer m_recvBuffer;
+		/// byte size of the packet size read so far
+		unsigned int m_recvSizeOffset;
+		/// packet being assembled
+		Packet *m_recvPacket;
+		/// byte size of the packet read so far
+		unsigned int m_recvPacketOffset;
+		/// flag whether the event loop stopped receiving until the processors are available
+		bool m_isReceivePaused;
+
 	};
 
 }
@@ -42,6 +42,7 @@ An Interface for Asynchronous UDP Client.
 #include "epBaseUdpClient.h"
 #include "epServerObjectList.h"
 #include "epClientPacketProcessor.h"
+#include "epPacketDispatchQueue.h"
 
 
 namespace epse{
@@ -50,7 +51,7 @@ namespace epse{
 	@class AsyncUdpClient epAsyncUdpClient.h
 	@brief A class for Asynchronous UDP Client.
 	*/
-	class EP_SERVER_ENGINE AsyncUdpClient:public BaseUdpClient{
+	class EP_SERVER_ENGINE AsyncUdpClient:public BaseUdpClient, public PacketDispatchDelegate{
 
 	public:
 		/*!
@@ -146,6 +147,12 @@ namespace epse{
 		*/
 		void disconnect();
 
+		/*!
+		Call Back Function when the dispatched packet is processed by the worker thread.
+		@param[in] packet the received packet
+		*/
+		virtual void OnPacketDispatched(Packet *packet);
+
 	private:
 	
 
@@ -157,6 +164,12 @@ namespace epse{
 
 		/// Flag for Asynchronous Receive
 		bool m_isAsynchronousReceive;
+
+		/// packet dispatcher for PACKET_DISPATCH_TYPE_POOL and PACKET_DISPATCH_TYPE_POOL_ORDERED
+		PacketDispatcher *m_packetDispatcher;
+
+		/// dispatch queue for the shared worker threads
+		PacketDispatchQueue m_dispatchQueue;
 	};
 }
 
@@ -41,6 +41,7 @@ An Interface for Asynchronous UDP Server.
 
 #include "epServerEngine.h"
 #include "epBaseUdpServer.h"
+#include "epPacketDispatcher.h"
 
 namespace epse{
 
@@ -101,16 +102,30 @@ namespace epse{
 		@remark if argument is NULL then previously setting value is used
 		*/
 		bool StartServer(const ServerOps &ops=ServerOps::defaultServerOps);
+
+		/*!
+		Stop the server
+		*/
+		virtual void StopServer();
 	
 	private:
 	
 		/*!
-		Listening Loop Function
+		Process the datagram received from the client
+		@param[in] packetData the received datagram
+		@param[in] recvLength the byte size of the datagram, or 0 or less if the receive failed
+		@param[in] clientSockAddr the socket address of the client
 		*/
-		virtual void execute();
+		virtual void processDatagram(const char *packetData,int recvLength,const sockaddr &clientSockAddr);
 	
 		/// Flag for Asynchronous Receive
 		bool m_isAsynchronousReceive;
+
+		/// packet dispatcher for PACKET_DISPATCH_TYPE_POOL and PACKET_DISPATCH_TYPE_POOL_ORDERED
+		PacketDispatcher *m_packetDispatcher;
+
+		/// Packet Dispatch Type
+		PacketDispatchType m_packetDispatchType;
 	
 	};
 }
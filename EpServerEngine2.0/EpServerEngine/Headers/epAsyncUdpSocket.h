@@ -40,6 +40,7 @@ An Interface for Asynchronous UDP Socket.
 
 #include "epServerEngine.h"
 #include "epBaseUdpSocket.h"
+#include "epPacketDispatchQueue.h"
 
 namespace epse
 {
@@ -48,7 +49,7 @@ namespace epse
 	@class AsyncUdpSocket epAsyncUdpSocket.h
 	@brief A class for Asynchronous UDP Socket.
 	*/
-	class EP_SERVER_ENGINE AsyncUdpSocket:public BaseUdpSocket
+	class EP_SERVER_ENGINE AsyncUdpSocket:public BaseUdpSocket, public PacketDispatchDelegate
 	{
 		friend class AsyncUdpServer;
 	public:
@@ -130,6 +131,19 @@ namespace epse
 		*/
 		virtual void addPacket(Packet *packet);
 
+		/*!
+		Set the dispatcher to process the received packets with
+		@param[in] dispatcher the packet dispatcher
+		@param[in] isOrdered the flag whether the packets are processed in the received order
+		*/
+		void setPacketDispatcher(PacketDispatcher *dispatcher,bool isOrdered);
+
+		/*!
+		Call Back Function when the dispatched packet is processed by the worker thread.
+		@param[in] packet the received packet
+		*/
+		virtual void OnPacketDispatched(Packet *packet);
+
 	private:
 		/*!
 		Default Copy Constructor
@@ -156,6 +170,9 @@ namespace epse
 		/// processor thread list
 		ServerObjectList m_processorList;
 
+		/// dispatch queue for the shared worker threads
+		PacketDispatchQueue m_dispatchQueue;
+
 		/// Maximum Processor Count
 		unsigned int m_maxProcessorCount;
 
@@ -48,6 +48,7 @@ An Interface for Base Client.
 #include "epBaseServerObject.h"
 #include "epServerConf.h"
 #include "epClientInterfaces.h"
+#include "epSocketHelper.h"
 
 #include <windows.h>
 #include <winsock2.h>
@@ -181,6 +182,7 @@ namespace epse{
 	
 
 	protected:
+		friend class IocpClientProcessor;
 
 		/*!
 		Actually set the hostname for the server.
@@ -207,6 +209,22 @@ namespace epse{
 		*/
 		virtual void cleanUpClient();
 
+		/*!
+		Wait until the client is ready to receive, then resume the given receive job
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the receive job to resume
+		@remark IOCP Use ONLY! by default the job is pushed back to the worker thread.
+		*/
+		virtual void waitForReceive(BaseWorkerThread *workerThread,BaseJob *job){workerThread->Push(job);}
+
+		/*!
+		Resume the given send job which timed out
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the send job to resume
+		@remark IOCP Use ONLY! by default the job is pushed back to the worker thread.
+		*/
+		virtual void retrySend(BaseWorkerThread *workerThread,BaseJob *job){workerThread->Push(job);}
+
 		/*!
 		Reset Client
 		*/
@@ -41,6 +41,8 @@ An Interface for Proxy Base Handler.
 #include "epServerEngine.h"
 #include "epProxyServerInterfaces.h"
 #include "epBaseClient.h"
+#include "epSocketRelay.h"
+#include "epForwardClientPool.h"
 
 namespace epse{
 
@@ -126,11 +128,28 @@ namespace epse{
 		*/
 		sockaddr GetSockAddr() const;
 
+		/*!
+		Stop the relay if the handler is relaying
+		*/
+		void stopRelay();
+
+		/*!
+		Give back the client connected to forward server to the pool
+		@remark nothing is done if the client is not from the pool.
+		*/
+		void releaseForwardClient();
+
 	protected:
 		/// client socket
 		SocketInterface *m_client;
 		/// the client connected to forward server
-		BaseClient *m_forwardClient;
+		ClientInterface *m_forwardClient;
+
+		/// the pool which the client connected to forward server is from, or NULL if owned
+		ForwardClientPool *m_forwardClientPool;
+
+		/// the relay between the client and forward server, or NULL if not relaying
+		SocketRelay *m_relay;
 		/// callback object
 		ProxyServerCallbackInterface *m_callBack;
 
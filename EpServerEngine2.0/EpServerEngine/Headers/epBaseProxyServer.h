@@ -43,6 +43,7 @@ An Interface for Proxy Base Server.
 #include "epProxyServerInterfaces.h"
 #include "epBaseServer.h"
 #include "epBaseProxyHandler.h"
+#include "epForwardClientPool.h"
 
 
 namespace epse{
@@ -166,6 +167,11 @@ namespace epse{
 		*/
 		virtual void OnNewConnection(SocketInterface *socket)=0;
 
+		/*!
+		Stop the relays of all handlers so that the client sockets can be killed
+		*/
+		void stopRelays();
+
 	
 
 	protected:
@@ -178,6 +184,12 @@ namespace epse{
 		/// Callback Object
 		ProxyServerCallbackInterface *m_callBack;
 
+		/// flag for the relay mode
+		bool m_isRelay;
+
+		/// the pool of the connections to forward server, or NULL if not pooled
+		ForwardClientPool *m_forwardClientPool;
+
 		/// general lock 
 		epl::BaseLock *m_baseProxyServerLock;
 
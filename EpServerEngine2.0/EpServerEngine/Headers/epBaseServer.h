@@ -48,6 +48,10 @@ An Interface for Base Server.
 #include "epBaseServerObject.h"
 #include "epServerInterfaces.h"
 #include "epServerObjectList.h"
+#include "epSocketHelper.h"
+#include "epServerAcceptor.h"
+#include "epTimerWheel.h"
+#include "epTopicRouter.h"
 
 #include <winsock2.h>
 #include <ws2tcpip.h>
@@ -61,6 +65,9 @@ An Interface for Base Server.
 
 namespace epse{
 
+	class BaseSocket;
+	class BroadcastJob;
+	class JobScheduler;
 	
 
 	/*! 
@@ -176,7 +183,62 @@ namespace epse{
 		*/
 		void ShutdownAllClient();
 
+		/*!
+		Send the packet to all clients' socket connected.
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec wait time for sending the packet to each socket
+		@remark the packet is shared by all the sockets, so it must not be changed after the call.
+		@remark the packet is queued to each socket, and sent by the worker threads.
+		*/
+		virtual void Broadcast(Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE);
+
+		/*!
+		Send the packet to the given clients' socket.
+		@param[in] socketList the list of the sockets to send the packet to
+		@param[in] socketCount the number of the sockets in the list
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec wait time for sending the packet to each socket
+		@remark the packet is shared by all the sockets, so it must not be changed after the call.
+		@remark the packet is queued to each socket, and sent by the worker threads.
+		*/
+		virtual void Multicast(SocketInterface *const*socketList,unsigned int socketCount,Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE);
+
+		/*!
+		Subscribe the client's socket to the topic.
+		@param[in] socket the socket to subscribe
+		@param[in] topic the topic, which may end with TOPIC_WILDCARD to subscribe to all the topics under it
+		@return true if subscribed, false if already subscribed, the topic is invalid, or the socket is disconnected
+		@remark the socket is unsubscribed from all the topics when disconnected.
+		*/
+		virtual bool Subscribe(SocketInterface *socket,const TCHAR *topic);
+
+		/*!
+		Unsubscribe the client's socket from the topic.
+		@param[in] socket the socket to unsubscribe
+		@param[in] topic the topic subscribed
+		@return true if unsubscribed, false if not subscribed
+		*/
+		virtual bool Unsubscribe(SocketInterface *socket,const TCHAR *topic);
+
+		/*!
+		Unsubscribe the client's socket from all the topics.
+		@param[in] socket the socket to unsubscribe
+		*/
+		virtual void UnsubscribeAll(SocketInterface *socket);
+
+		/*!
+		Send the packet to the clients' socket subscribing to the topic.
+		@param[in] topic the topic to publish to
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec wait time for sending the packet to each socket
+		@remark the packet is shared by all the sockets, so it must not be changed after the call.
+		@remark the subscribers are sent the packet in the same way as Broadcast.
+		*/
+		virtual void Publish(const TCHAR *topic,Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE);
+
 	protected:
+		friend class ServerAcceptor;
+
 		/*!
 		Actually set the port for the server.
 		@remark Cannot be changed while connected to server
@@ -187,7 +249,74 @@ namespace epse{
 		/*!
 		Listening Loop Function
 		*/
-		virtual void execute()=0 ;
+		virtual void execute();
+
+		/*!
+		Accept or receive on the given listening socket until the server stops
+		@param[in] listenSocket the listening socket to loop on
+		@remark called from the server thread and from each additional acceptor.
+		*/
+		virtual void listenLoop(SOCKET listenSocket)=0;
+
+		/*!
+		Create and bind a listening socket to the resolved address
+		@param[in,out] isReusePort flag to set SO_REUSEPORT, which is set to false if not supported
+		@return the listening socket, or INVALID_SOCKET if failed
+		*/
+		virtual SOCKET openListenSocket(bool &isReusePort)=0;
+
+		/*!
+		Start the additional acceptors
+		@param[in] acceptorCount the total number of the accept/receive loops including the server thread
+		@param[in] isReusePort flag whether each acceptor opens its own socket with SO_REUSEPORT
+		@param[in] isShareable flag whether the acceptors may share the listening socket without SO_REUSEPORT
+		@return true if successful otherwise false
+		*/
+		bool startAcceptors(unsigned int acceptorCount,bool isReusePort,bool isShareable);
+
+		/*!
+		Stop the additional acceptors
+		*/
+		void stopAcceptors();
+
+		/*!
+		Start the timer wheel if the idle timeout, the keepalive or the send timeout is set
+		@param[in] ops the server options
+		@return true if successful otherwise false
+		*/
+		bool startTimerWheel(const ServerOps &ops);
+
+		/*!
+		Start the idle timeout and the keepalive timer of the accepted socket, and set its send deadline
+		@param[in] socket the accepted socket
+		*/
+		void startActivityTimer(BaseSocket *socket);
+
+		/*!
+		Start the broadcast worker threads if not started
+		@return true if the broadcast worker threads are running otherwise false
+		@remark the caller must hold the server lock.<br/>
+		        The threads are started by the first broadcast job, so the server never broadcasting does not start them.<br/>
+		        IOCP Server does not need them since its sockets queue the packet to its worker threads.
+		*/
+		virtual bool startBroadcaster();
+
+		/*!
+		Queue the packet to the given socket, or add the socket to the broadcast job
+		@param[in] socket the socket to send the packet to
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec wait time for sending the packet to the socket
+		@param[in,out] job the broadcast job to add the socket to, which is created if NULL
+		*/
+		void broadcastTo(BaseSocket *socket,Packet &packet,unsigned int waitTimeInMilliSec,BroadcastJob *&job);
+
+		/*!
+		Push the broadcast job to the broadcast worker threads
+		@param[in,out] job the broadcast job to push, which is released and set to NULL
+		@remark the broadcast worker threads are started here for the first job.<br/>
+		        If the job cannot be pushed, the packet is sent by the caller thread.
+		*/
+		void pushBroadcastJob(BroadcastJob *&job);
 	
 		/*!
 		Clean up the server initialization.
@@ -241,6 +370,36 @@ namespace epse{
 	
 		/// Callback Object
 		ServerCallbackInterface *m_callBackObj;
+
+		/// additional acceptor list
+		std::vector<ServerAcceptor*> m_acceptorList;
+
+		/// acceptor list lock
+		epl::BaseLock *m_acceptorLock;
+
+		/// the number of the accept/receive loops including the server thread
+		unsigned int m_acceptorCount;
+
+		/// timer wheel for the idle timeout, the keepalive and the send deadline
+		TimerWheel *m_timerWheel;
+
+		/// idle timeout in millisecond
+		unsigned int m_idleTimeout;
+
+		/// keepalive time in millisecond
+		unsigned int m_keepAliveTime;
+
+		/// send timeout in millisecond
+		unsigned int m_sendTimeout;
+
+		/// broadcast worker threads
+		JobScheduler *m_broadcastScheduler;
+
+		/// number of the broadcast worker threads
+		unsigned int m_broadcastThreadCount;
+
+		/// topic index of the subscribing sockets
+		TopicRouter *m_topicRouter;
 	};
 }
 #endif //__EP_BASE_SERVER_H__
\ No newline at end of file
@@ -111,7 +111,7 @@ namespace epse{
 		Remove self from the container
 		@return true if successfully removed otherwise false
 		*/
-		bool removeSelfFromContainer();
+		virtual bool removeSelfFromContainer();
 	protected:
 
 		/// Lock Policy
@@ -122,6 +122,9 @@ namespace epse{
 		/// Container
 		ServerObjectList *m_container;
 
+		/// index of this object in the container list
+		size_t m_containerIndex;
+
 		/// container lock
 		epl::BaseLock *m_containerLock;
 	};
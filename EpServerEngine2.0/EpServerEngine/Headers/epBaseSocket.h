@@ -43,6 +43,8 @@ An Interface for Base Socket.
 #include "epServerPacketProcessor.h"
 #include "epServerConf.h"
 #include "epServerObjectList.h"
+#include "epSocketHelper.h"
+#include "epTimerWheel.h"
 
 #ifndef WIN32_LEAN_AND_MEAN
 #define WIN32_LEAN_AND_MEAN
@@ -160,6 +162,7 @@ namespace epse
 
 	protected:	
 		friend class IocpServerProcessor;
+		friend class BaseServer;
 	
 		/*!
 		Actually Kill the connection
@@ -172,6 +175,39 @@ namespace epse
 		*/
 		virtual void killConnectionNoCallBack(){}
 
+		/*!
+		Wait until the socket is ready to receive, then resume the given receive job
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the receive job to resume
+		@remark IOCP Use ONLY! by default the job is pushed back to the worker thread.
+		*/
+		virtual void waitForReceive(BaseWorkerThread *workerThread,BaseJob *job){workerThread->Push(job);}
+
+		/*!
+		Resume the given send job which timed out
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the send job to resume
+		@remark IOCP Use ONLY! by default the job is pushed back to the worker thread.
+		*/
+		virtual void retrySend(BaseWorkerThread *workerThread,BaseJob *job){workerThread->Push(job);}
+
+		/*!
+		Send the packets in the send queue
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the flush job to resume
+		@remark IOCP Use ONLY!
+		*/
+		virtual void flushSendQueue(BaseWorkerThread *workerThread,BaseJob *job){}
+
+		/*!
+		Queue the shared packet to the outbound path of the socket without copying
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec wait time in millisecond for the room of the outbound path
+		@return true if queued, false if the socket has no outbound queue and the caller should send it.
+		@remark IOCP Use ONLY! by default the packet is not queued.
+		*/
+		virtual bool queueSend(Packet &packet,unsigned int waitTimeInMilliSec){return false;}
+
 		/*!
 		thread loop function
 		*/
@@ -189,6 +225,110 @@ namespace epse
 		*/
 		virtual void setSockAddr(sockaddr sockAddr);
 
+		/*!
+		Start the timer for the idle timeout and the keepalive
+		@param[in] timerWheel the timer wheel of the server
+		@param[in] idleTimeoutMilliSec the idle timeout in millisecond, or TIMEOUT_NONE
+		@param[in] keepAliveMilliSec the keepalive time in millisecond, or TIMEOUT_NONE
+		@param[in] sendTimeoutMilliSec the send timeout in millisecond, or TIMEOUT_NONE
+		@remark the send deadline is armed later by armSendTimer.
+		*/
+		void setActivityTimer(TimerWheel *timerWheel,unsigned int idleTimeoutMilliSec,unsigned int keepAliveMilliSec,unsigned int sendTimeoutMilliSec);
+
+		/*!
+		Mark the socket active, which moves the idle timeout forward
+		*/
+		void markActive();
+
+		/*!
+		Cancel the timer for the idle timeout and the keepalive, and the send deadline
+		*/
+		void stopActivityTimer();
+
+		/*!
+		Arm the send deadline for the packets at the front of the send queue, if not armed yet
+		@remark only the flushing thread may call this.
+		*/
+		void armSendTimer();
+
+		/*!
+		Cancel the send deadline since the packets at the front of the send queue are written
+		@remark only the flushing thread may call this.
+		*/
+		void cancelSendTimer();
+
+		/*!
+		Remove self from the container, cancelling the activity timer and the subscriptions
+		@return true if successfully removed otherwise false
+		*/
+		virtual bool removeSelfFromContainer();
+
+		/*!
+		Check the idle timeout and the keepalive, and arm the timer for the next one
+		*/
+		void onActivityTimer();
+
+		/*!
+		Time out the connection whose send did not complete within the send timeout
+		*/
+		void onSendTimer();
+
+		/*! 
+		@class ActivityTimer epBaseSocket.h
+		@brief A class for the timer of the idle timeout and the keepalive of the socket.
+		*/
+		class ActivityTimer:public TimerWheel::Timer{
+		public:
+			/*!
+			Default Constructor
+
+			Initializes the Timer
+			*/
+			ActivityTimer():Timer(){m_owner=NULL;}
+
+			/*!
+			Set the socket which owns the timer
+			@param[in] owner the socket, retained while the timer is armed
+			*/
+			void setOwner(BaseSocket *owner){m_owner=owner;setTarget(owner);}
+		protected:
+			/*!
+			Called when the timer expires
+			*/
+			virtual void onExpired(){m_owner->onActivityTimer();}
+		private:
+			/// the socket which owns the timer
+			BaseSocket *m_owner;
+		};
+
+		/*! 
+		@class SendTimer epBaseSocket.h
+		@brief A class for the timer of the send deadline of the socket.
+		*/
+		class SendTimer:public TimerWheel::Timer{
+		public:
+			/*!
+			Default Constructor
+
+			Initializes the Timer
+			*/
+			SendTimer():Timer(){m_owner=NULL;}
+
+			/*!
+			Set the socket which owns the timer
+			@param[in] owner the socket, retained while the timer is armed
+			*/
+			void setOwner(BaseSocket *owner){m_owner=owner;setTarget(owner);}
+		protected:
+			/*!
+			Called when the timer expires
+			*/
+			virtual void onExpired(){m_owner->onSendTimer();}
+		private:
+			/// the socket which owns the timer
+			BaseSocket *m_owner;
+		};
+
 
 	protected:
 		/*!
@@ -225,6 +365,33 @@ namespace epse
 
 		///Sock Address
 		sockaddr m_sockAddr;
+
+		/// timer wheel of the server
+		TimerWheel *m_timerWheel;
+
+		/// idle timeout in tick
+		unsigned int m_idleTimeoutTick;
+
+		/// keepalive time in tick
+		unsigned int m_keepAliveTick;
+
+		/// tick when a packet was received last
+		volatile unsigned int m_lastActiveTick;
+
+		/// tick when the keepalive was called last
+		volatile unsigned int m_lastKeepAliveTick;
+
+		/// timer for the idle timeout and the keepalive
+		ActivityTimer m_activityTimer;
+
+		/// send timeout in tick
+		unsigned int m_sendTimeoutTick;
+
+		/// flag whether the send deadline is running
+		volatile bool m_isSendTimerRunning;
+
+		/// timer for the send deadline
+		SendTimer m_sendTimer;
 	};
 
 }
@@ -103,6 +103,18 @@ namespace epse{
 		*/
 		virtual int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 
+		/*!
+		Send the packets to the server with a single gathered write
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred before any packet is written.<br/>
+		        If a later gather fails, the byte size written before is returned with SEND_STATUS_FAIL_SEND_FAILED.
+		*/
+		virtual int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
 	protected:
 
 	
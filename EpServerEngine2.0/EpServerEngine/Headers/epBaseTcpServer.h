@@ -95,12 +95,14 @@ namespace epse{
 		*/
 		virtual void StopServer();
 
-	private:
+	protected:
 
 		/*!
-		Listening Loop Function
+		Create and bind a listening socket to the resolved address, and listen on it
+		@param[in,out] isReusePort flag to set SO_REUSEPORT, which is set to false if not supported
+		@return the listening socket, or INVALID_SOCKET if failed
 		*/
-		virtual void execute()=0;
+		virtual SOCKET openListenSocket(bool &isReusePort);
 
 	};
 }
@@ -77,6 +77,18 @@ namespace epse
 		@remark return -1 if error occurred
 		*/
 		virtual int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
+		/*!
+		Send the packets to the client with a single gathered write
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred before any packet is written.<br/>
+		        If a later gather fails, the byte size written before is returned with SEND_STATUS_FAIL_SEND_FAILED.
+		*/
+		virtual int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 		
 
 		/*!
@@ -88,6 +100,7 @@ namespace epse
 	protected:	
 		friend class SyncTcpServer;
 		friend class AsyncTcpServer;
+		friend class ProxyTcpHandler;
 		/*!
 		Actually Kill the connection
 		*/
@@ -112,6 +112,19 @@ namespace epse{
 		@remark return -1 if error occurred
 		*/
 		virtual int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
+		/*!
+		Send the packets to the server as the datagrams
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred, or the byte size of the datagrams sent before the error with sendStatus set to the failure
+		@remark the socket is waited and the send lock is taken once for all the packets.<br/>
+		        The empty packets are skipped, since the empty datagram is taken as the disconnection.
+		*/
+		virtual int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 	
 	protected:
 		/*!
@@ -106,9 +106,34 @@ namespace epse{
 	protected:
 	
 		/*!
-		Listening Loop Function
+		Receive on the given listening socket until the server stops
+		@param[in] listenSocket the listening socket to loop on
 		*/
-		virtual void execute()=0;
+		virtual void listenLoop(SOCKET listenSocket);
+
+		/*!
+		Create and bind a listening socket to the resolved address
+		@param[in,out] isReusePort flag to set SO_REUSEPORT, which is set to false if not supported
+		@return the listening socket, or INVALID_SOCKET if failed
+		*/
+		virtual SOCKET openListenSocket(bool &isReusePort);
+
+		/*!
+		Process the datagram received from the client
+		@param[in] packetData the received datagram
+		@param[in] recvLength the byte size of the datagram, or 0 or less if the receive failed
+		@param[in] clientSockAddr the socket address of the client
+		*/
+		virtual void processDatagram(const char *packetData,int recvLength,const sockaddr &clientSockAddr)=0;
+
+		/*!
+		Split the received data into the datagrams and process each of them
+		@param[in] recvData the received data
+		@param[in] recvLength the byte size of the received data
+		@param[in] segmentSize the byte size of each coalesced datagram, or 0 if not coalesced
+		@param[in] clientSockAddr the socket address of the client
+		*/
+		void dispatchDatagram(const char *recvData,int recvLength,unsigned int segmentSize,const sockaddr &clientSockAddr);
 	
 		/*!
 		Clean up the server initialization.
@@ -133,6 +158,20 @@ namespace epse{
 		*/
 		int send(const Packet &packet,const sockaddr &clientSockAddr, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 
+		/*!
+		Send the packets to the client as the datagrams
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] clientSockAddr the client socket address, which will receive the packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred, or the byte size of the datagrams sent before the error with sendStatus set to the failure
+		@remark the socket is waited and the send lock is taken once for all the packets.<br/>
+		        The empty packets are skipped, since the empty datagram is taken as the disconnection.
+		*/
+		int sendBatch(const Packet *const *packetList,unsigned int packetCount,const sockaddr &clientSockAddr, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
 
 		/*!
 		Compare given clientSocket with BaseServerObject's socket
@@ -142,6 +181,40 @@ namespace epse{
 		*/
 		static bool socketCompare(sockaddr const & clientSocket, const BaseServerObject*obj );
 
+		/*!
+		@struct PeerKey epBaseUdpServer.h
+		@brief the key of the peer made of the family, the address and the port.
+		*/
+		struct PeerKey{
+			/// address family
+			unsigned short m_family;
+			/// port in network byte order
+			unsigned short m_port;
+			/// address
+			unsigned char m_address[14];
+		};
+
+		/*!
+		Make the peer key from the given socket address
+		@param[in] clientSockAddr the socket address of the peer
+		@param[out] retKey the peer key made
+		*/
+		static void makePeerKey(const sockaddr &clientSockAddr,PeerKey &retKey);
+
+		/*!
+		Find the socket of the peer with given socket address
+		@param[in] clientSockAddr the socket address of the peer
+		@return the socket of the peer, or NULL if not found
+		*/
+		BaseServerObject *findPeer(const sockaddr &clientSockAddr);
+
+		/*!
+		Push the socket of the new peer to the socket list
+		@param[in] socket the socket of the peer
+		@param[in] clientSockAddr the socket address of the peer
+		*/
+		void pushPeer(BaseServerObject *socket,const sockaddr &clientSockAddr);
+
 
 
 	protected:
@@ -151,6 +224,12 @@ namespace epse{
 		/// send lock
 		epl::BaseLock *m_sendLock;
 
+		/// flag whether the UDP offload is enabled on the listening socket
+		bool m_isUdpOffload;
+
+		/// flag whether the offloaded send is used, cleared by the send failure without touching the receive
+		bool m_isSendOffload;
+
 	};
 }
 #endif //__EP_BASE_UDP_SERVER_H__
\ No newline at end of file
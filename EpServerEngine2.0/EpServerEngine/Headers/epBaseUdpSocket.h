@@ -40,8 +40,7 @@ An Interface for Base UDP Socket.
 
 #include "epServerEngine.h"
 #include "epBaseSocket.h"
-#include <queue>
-using namespace std;
+#include "epServerRingQueue.h"
 
 namespace epse
 {
@@ -83,6 +82,17 @@ namespace epse
 		*/
 		int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 
+		/*!
+		Send the packets to the client as the datagrams
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred
+		*/
+		virtual int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
 		
 		/*!
 		Kill the connection
@@ -122,6 +132,19 @@ namespace epse
 		@param[in] maxPacketSize the maximum packet byte size to set
 		*/
 		void setMaxPacketByteSize(unsigned int maxPacketSize);
+
+		/*!
+		Push the given packet to the packet list
+		@param[in] packet the packet to push
+		@return true if pushed, false if the packet list is full and the packet is dropped
+		@remark the packet is retained only if pushed.
+		*/
+		bool pushPacket(Packet *packet);
+
+		/*!
+		Release all the packets in the packet list
+		*/
+		void clearPacketList();
 	protected:
 		/*!
 		Default Copy Constructor
@@ -129,7 +152,7 @@ namespace epse
 		Initializes the BaseUdpSocket
 		@param[in] b the second object
 		*/
-		BaseUdpSocket(const BaseUdpSocket& b):BaseSocket(b)
+		BaseUdpSocket(const BaseUdpSocket& b):BaseSocket(b),m_packetList(UDP_RECEIVE_QUEUE_SIZE)
 		{}
 
 
@@ -144,11 +167,8 @@ namespace epse
 		/// Maximum UDP Datagram byte size
 		unsigned int m_maxPacketSize;
 
-		/// list lock 
-		epl::BaseLock *m_listLock;
-
 		/// Packet List
-		queue<Packet*> m_packetList;
+		ServerRingQueue<Packet*> m_packetList;
 	};
 
 }
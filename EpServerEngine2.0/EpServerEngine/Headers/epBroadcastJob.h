@@ -0,0 +1,121 @@
+/*! 
+@file epBroadcastJob.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Broadcast Job Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for the Broadcast Job.
+
+*/
+#ifndef __EP_BROADCAST_JOB_H__
+#define __EP_BROADCAST_JOB_H__
+
+#include "epServerEngine.h"
+#include "epPacket.h"
+#include "epBaseSocket.h"
+#include <vector>
+
+using namespace std;
+
+namespace epse{
+
+	/*! 
+	@class BroadcastJob epBroadcastJob.h
+	@brief A class for the job which sends a shared packet to a group of sockets.
+	*/
+	class EP_SERVER_ENGINE BroadcastJob:public BaseJob{
+
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Job
+		@param[in] packet the packet to send
+		@param[in] waitTimeMilliSec wait time for sending the packet to each socket
+		@param[in] priority the priority of the job
+		@param[in] lockPolicyType The lock policy
+		*/
+		BroadcastJob(Packet *packet=NULL,unsigned int waitTimeMilliSec=WAITTIME_INIFINITE,Priority priority=PRIORITY_NORMAL,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Job
+		*/
+		virtual ~BroadcastJob();
+
+		/*!
+		Add the socket to send the packet to
+		@param[in] socket the socket to add
+		*/
+		void AddSocket(BaseSocket *socket);
+
+		/*!
+		Get the number of the sockets
+		@return the number of the sockets
+		*/
+		unsigned int GetSocketCount() const;
+
+		/*!
+		Send the packet to all the sockets
+		*/
+		void Send();
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Job
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		BroadcastJob(const BroadcastJob& b):BaseJob(b)
+		{}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		BroadcastJob & operator=(const BroadcastJob&b){return *this;}
+
+	private:
+		/// shared packet
+		Packet *m_packet;
+		/// sockets to send the packet to
+		vector<BaseSocket*> m_socketList;
+		/// wait time for sending the packet to each socket
+		unsigned int m_waitTime;
+	};
+}
+
+#endif //__EP_BROADCAST_JOB_H__
@@ -72,12 +72,32 @@ namespace epse{
 		*/
 		unsigned int maximumProcessorCount;
 
+		/*!
+		The packet dispatch type.
+		@remark If isAsynchronousReceive is false then this value is ignored!
+		@remark For Asynchronous Client Use Only!
+		*/
+		PacketDispatchType packetDispatchType;
+
+		/*!
+		The number of packet dispatch worker thread.
+		@remark if 0, the number of the cores is used.
+		@remark For PACKET_DISPATCH_TYPE_POOL and PACKET_DISPATCH_TYPE_POOL_ORDERED Use Only!
+		*/
+		unsigned int dispatchThreadCount;
+
 		/*!
 		The number of worker thread.
 		@remark For IOCP Use Only!
 		*/
 		unsigned int workerThreadCount;
 
+		/*!
+		The I/O engine type.
+		@remark For IOCP Use Only!
+		*/
+		IoEngineType ioEngineType;
+
 		/*!
 		Default Constructor
 
@@ -91,7 +111,10 @@ namespace epse{
 			isAsynchronousReceive=true;
 			waitTimeMilliSec=WAITTIME_INIFINITE;
 			maximumProcessorCount=PROCESSOR_LIMIT_INFINITE;
+			packetDispatchType=PACKET_DISPATCH_TYPE_THREAD;
+			dispatchThreadCount=0;
 			workerThreadCount=0;
+			ioEngineType=IO_ENGINE_TYPE_READINESS;
 		}
 
 		static ClientOps defaultClientOps;
@@ -189,6 +212,38 @@ namespace epse{
 		*/
 		virtual int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL)=0;
 
+		/*!
+		Send the packets to the server
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending each packet in millisecond
+		@param[in] sendStatus the status of send.
+		@return sent byte size
+		@remark return -1 if error occurred
+		@remark TCP clients send the packets with a single gathered write.
+		@remark UDP clients wait for the socket once for all the packets.
+		*/
+		virtual int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL)
+		{
+			int writeLength=0;
+			SendStatus status=SEND_STATUS_SUCCESS;
+			for(unsigned int trav=0;trav<packetCount;trav++)
+			{
+				if(!packetList[trav])
+					continue;
+				int sentLength=Send(*packetList[trav],waitTimeInMilliSec,&status);
+				if(status!=SEND_STATUS_SUCCESS)
+				{
+					writeLength=sentLength;
+					break;
+				}
+				writeLength+=sentLength;
+			}
+			if(sendStatus)
+				*sendStatus=status;
+			return writeLength;
+		}
+
 		/*!
 		Receive the packet from the client
 		@param[in] waitTimeInMilliSec wait time for receiving the packet in millisecond
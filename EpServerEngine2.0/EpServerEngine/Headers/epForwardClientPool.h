@@ -0,0 +1,185 @@
+/*!
+@file epForwardClientPool.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Forward Client Pool Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for the Forward Client Pool.
+
+The Forward Client Pool keeps the connections to the forward servers for the proxy,
+so a new proxy connection does not wait for the connection to the forward server.
+The connection is either kept idle for the next proxy connection,
+or shared by many proxy connections as the Multiplex Link.
+
+*/
+#ifndef __EP_FORWARD_CLIENT_POOL_H__
+#define __EP_FORWARD_CLIENT_POOL_H__
+
+#include "epServerEngine.h"
+#include "epProxyServerInterfaces.h"
+#include "epMultiplexLink.h"
+#include "epServerObjectRemover.h"
+#include <map>
+#include <vector>
+
+using namespace std;
+
+namespace epse{
+
+	class AsyncTcpClient;
+
+	/*!
+	@class ForwardClientPool epForwardClientPool.h
+	@brief A class for the pool of the connections to the forward servers.
+	*/
+	class EP_SERVER_ENGINE ForwardClientPool:public ClientCallbackInterface{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Pool
+		@param[in] idleClientCount the maximum number of the idle connections kept for each forward server
+		@param[in] linkCount the number of the Multiplex Links for each forward server, or 0 not to multiplex
+		@param[in] lockPolicyType The lock policy
+		*/
+		ForwardClientPool(unsigned int idleClientCount,unsigned int linkCount,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Pool
+		*/
+		virtual ~ForwardClientPool();
+
+		/*!
+		Get the client connected to the given forward server
+		@param[in] forwardServerInfo the forward server info
+		@param[in] callBackObj the callback object of the client
+		@return the idle client if any, otherwise a new client connected, or NULL if failed to connect
+		@remark when multiplexing, the session is opened over the link with the least sessions.<br/>
+		        The client returned must be given back with Release.
+		*/
+		ClientInterface *Acquire(const ForwardServerInfo &forwardServerInfo,ClientCallbackInterface *callBackObj);
+
+		/*!
+		Give back the client acquired
+		@param[in] client the client to give back
+		@param[in] isReusable the flag whether the client is at the protocol-level boundary, with no reply in flight
+		@remark the reusable client still connected is kept idle, if the forward server has less idle clients than the limit.<br/>
+		        The client is reused as it is, so the forward server must not keep the state of a proxy connection per connection.<br/>
+		        isReusable is ignored when multiplexing, since the session is closed with the link kept.<br/>
+		        The client not acquired from the pool is asserted, then disconnected and removed.
+		*/
+		void Release(ClientInterface *client,bool isReusable=false);
+
+		/*!
+		Check if the clients are multiplexed
+		@return true if multiplexing otherwise false
+		*/
+		bool IsMultiplexing() const;
+
+		/*!
+		Disconnect and remove all the connections
+		@remark the links are closed, and deleted when the sessions still acquired are released.
+		*/
+		void Clear();
+
+	protected:
+		/*!
+		Received the packet while idle.
+		@param[in] client the idle client
+		@param[in] receivedPacket the received packet
+		@param[in] status the status of Receive
+		@remark the packet is dropped since no proxy connection owns the client.
+		*/
+		void OnReceived(ClientInterface *client,const Packet*receivedPacket,ReceiveStatus status);
+
+	private:
+		/*!
+		@struct ForwardTarget epForwardClientPool.h
+		@brief the connections to a forward server.
+		*/
+		struct ForwardTarget{
+			/// idle clients
+			vector<AsyncTcpClient*> m_idleClientList;
+			/// multiplex links
+			vector<MultiplexLink*> m_linkList;
+		};
+
+		/*!
+		Get the key of the given forward server
+		@param[in] forwardServerInfo the forward server info
+		@return the key of the forward server
+		*/
+		static epl::EpTString getKey(const ForwardServerInfo &forwardServerInfo);
+
+		/*!
+		Default Copy Constructor
+
+		Initializes the Pool
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		ForwardClientPool(const ForwardClientPool& b){EP_ASSERT(0);}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		ForwardClientPool & operator=(const ForwardClientPool&b){EP_ASSERT(0);return *this;}
+
+	private:
+		/// maximum number of the idle clients for each forward server
+		unsigned int m_idleClientCount;
+
+		/// number of the links for each forward server
+		unsigned int m_linkCount;
+
+		/// connections by forward server
+		map<epl::EpTString,ForwardTarget> m_targetMap;
+
+		/// forward server of the clients acquired
+		map<ClientInterface*,epl::EpTString> m_acquiredClientMap;
+
+		/// remover of the disconnected clients, released on its own thread since their threads may still be in the callback
+		ServerObjectRemover m_clientRemover;
+
+		/// pool lock
+		epl::BaseLock *m_poolLock;
+
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+	};
+}
+
+#endif //__EP_FORWARD_CLIENT_POOL_H__
@@ -0,0 +1,220 @@
+/*! 
+@file epIocpCompletionPort.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief IOCP Completion Port Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for IOCP Completion Port.
+
+The completion port parks the receive jobs (or any other waiting
+object) until the kernel reports that the socket has data to read
+(zero-byte overlapped receive), or until the data is read into the
+given buffer (overlapped receive), and then hands each of them back
+to the delegate exactly once on the dispatch thread.
+The flush jobs are parked the same way until the given buffers are
+written to the socket (overlapped send).
+
+*/
+#ifndef __EP_IOCP_COMPLETION_PORT_H__
+#define __EP_IOCP_COMPLETION_PORT_H__
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif //WIN32_LEAN_AND_MEAN
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <map>
+
+using namespace std;
+
+// Need to link with Ws2_32.lib
+#pragma comment (lib, "Ws2_32.lib")
+
+namespace epse{
+
+	/*! 
+	@class IocpCompletionPortDelegate epIocpCompletionPort.h
+	@brief A delegate class for IOCP Completion Port.
+	*/
+	class EP_SERVER_ENGINE IocpCompletionPortDelegate{
+	public:
+		/*!
+		Call Back Function when the socket of the parked object is ready.
+		@param[in] context the object which was waiting for the socket
+		@param[in] transferredByte the byte size read into the buffer
+		@param[in] isSucceeded the flag whether the overlapped receive succeeded
+		*/
+		virtual void OnIoCompleted(epl::SmartObject *context,unsigned long transferredByte,bool isSucceeded)=0;
+
+		/*!
+		Call Back Function when the overlapped send of the parked object is completed.
+		@param[in] context the object which was waiting for the send
+		@param[in] transferredByte the byte size written to the socket
+		@param[in] isSucceeded the flag whether the overlapped send succeeded
+		*/
+		virtual void OnSendCompleted(epl::SmartObject *context,unsigned long transferredByte,bool isSucceeded){}
+	};
+
+	/*! 
+	@class IocpCompletionPort epIocpCompletionPort.h
+	@brief A class for IOCP Completion Port.
+	*/
+	class EP_SERVER_ENGINE IocpCompletionPort:protected epl::Thread{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Completion Port
+		@param[in] delegateObj the delegate object to call when I/O is completed
+		@param[in] waitTimeMilliSec wait time for the dispatch thread to terminate
+		@param[in] lockPolicyType The lock policy
+		*/
+		IocpCompletionPort(IocpCompletionPortDelegate *delegateObj,unsigned int waitTimeMilliSec=WAITTIME_INIFINITE,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Completion Port
+		*/
+		virtual ~IocpCompletionPort();
+
+		/*!
+		Create the completion port and start the dispatch thread
+		@return true if successfully created otherwise false
+		*/
+		bool Create();
+
+		/*!
+		Stop the dispatch thread and close the completion port
+		@remark the receives and the sends still pending are cancelled, and the dispatch thread drains
+		        their completions to release the parked objects before closing.
+		*/
+		void Close();
+
+		/*!
+		Associate the given socket with the completion port
+		@param[in] socket the socket to associate
+		@return true if successfully associated otherwise false
+		*/
+		bool Associate(SOCKET socket);
+
+		/*!
+		Park the given object until the socket is ready to receive
+		@param[in] socket the socket to wait for
+		@param[in] context the object to hand to the delegate when the socket is ready
+		@param[in] buffer the buffer to read into
+		@param[in] bufferByteSize the byte size of the buffer
+		@return true if the object is parked otherwise false
+		@remark if buffer is NULL, the object is resumed when the socket is readable without reading.
+		@remark if false is returned, the caller should process the object by itself.
+		*/
+		bool WaitForReceive(SOCKET socket,epl::SmartObject *context,char *buffer=NULL,unsigned int bufferByteSize=0);
+
+		/*!
+		Park the given object until the given buffers are written to the socket
+		@param[in] socket the socket to write to
+		@param[in] context the object to hand to the delegate when the send is completed
+		@param[in] bufferList the buffers to write, which must be kept until the send is completed
+		@param[in] bufferCount the number of the buffers
+		@return true if the object is parked otherwise false
+		@remark the send may complete with less bytes than given, so the object should send the rest.
+		@remark if false is returned, the caller should process the object by itself.
+		*/
+		bool WaitForSend(SOCKET socket,epl::SmartObject *context,WSABUF *bufferList,unsigned int bufferCount);
+
+	private:
+		/*!
+		Dispatch Loop Function
+		*/
+		virtual void execute();
+
+		/*!
+		Hand the completed object to the delegate and release it
+		@param[in] overlapped the completed overlapped
+		@param[in] transferredByte the byte size transferred
+		@param[in] isSucceeded the flag whether the overlapped I/O succeeded
+		@param[in] isStopped the flag whether the dispatch loop is stopped
+		*/
+		void completeJob(LPOVERLAPPED overlapped,unsigned long transferredByte,bool isSucceeded,bool isStopped);
+
+		/*!
+		Get the number of the overlapped I/O still pending
+		@return the number of the overlapped I/O still pending
+		*/
+		size_t getPendingCount() const;
+
+		/*!
+		Default Copy Constructor
+
+		Initializes the Completion Port
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		IocpCompletionPort(const IocpCompletionPort& b):Thread(b)
+		{}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		IocpCompletionPort & operator=(const IocpCompletionPort&b){return *this;}
+
+	private:
+		/// completion port handle
+		HANDLE m_completionPort;
+
+		/// delegate object
+		IocpCompletionPortDelegate *m_delegate;
+
+		/// wait time in millisecond for terminating thread
+		unsigned int m_waitTime;
+
+		/// sockets of the overlapped I/O still pending by overlapped
+		map<LPOVERLAPPED,SOCKET> m_pendingMap;
+
+		/// flag whether the completion port is closing
+		bool m_isClosing;
+
+		/// general lock
+		epl::BaseLock *m_portLock;
+
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+	};
+}
+
+#endif //__EP_IOCP_COMPLETION_PORT_H__
\ No newline at end of file
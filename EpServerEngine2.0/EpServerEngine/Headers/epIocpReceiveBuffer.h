@@ -0,0 +1,206 @@
+/*! 
+@file epIocpReceiveBuffer.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief IOCP Receive Buffer Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for IOCP Receive Buffer.
+
+The Receive Buffer is the pre-allocated per-connection buffer which
+the overlapped receive fills when IO_ENGINE_TYPE_COMPLETION is used.
+The packets are read from the buffer first, and only the remainder of
+a packet larger than the buffered data is read from the socket.
+
+*/
+#ifndef __EP_IOCP_RECEIVE_BUFFER_H__
+#define __EP_IOCP_RECEIVE_BUFFER_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include "epPacket.h"
+#include "epSocketHelper.h"
+#include <vector>
+
+using namespace std;
+
+namespace epse{
+
+	/*! 
+	@class IocpReceiveBuffer epIocpReceiveBuffer.h
+	@brief A class for IOCP Receive Buffer.
+	@remark the owner must guard the buffer with its own lock.
+	*/
+	class EP_SERVER_ENGINE IocpReceiveBuffer{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Receive Buffer
+		@param[in] bufferByteSize the byte size of the buffer
+		*/
+		IocpReceiveBuffer(unsigned int bufferByteSize=IOCP_RECEIVE_BUFFER_SIZE);
+
+		/*!
+		Default Destructor
+
+		Destroy the Receive Buffer
+		*/
+		virtual ~IocpReceiveBuffer();
+
+		/*!
+		Return the buffer for the overlapped receive
+		@return the pointer to the buffer
+		*/
+		char *GetBuffer();
+
+		/*!
+		Return the byte size of the buffer
+		@return the byte size of the buffer
+		*/
+		unsigned int GetBufferByteSize() const;
+
+		/*!
+		Return the byte size of the data which is not read yet
+		@return the byte size of the buffered data
+		*/
+		unsigned int GetDataByteSize() const;
+
+		/*!
+		Check if the overlapped receive is in flight
+		@return true if the overlapped receive is in flight otherwise false
+		*/
+		bool IsPending() const;
+
+		/*!
+		Check if the connection is closed or failed
+		@return true if the connection is closed otherwise false
+		*/
+		bool IsClosed() const;
+
+		/*!
+		Mark that the overlapped receive is posted
+		*/
+		void SetPending();
+
+		/*!
+		Add the job which waits for the overlapped receive in flight
+		@param[in] job the job to wait
+		@return true if the job is added otherwise false
+		@remark the job is added only when the overlapped receive is in flight.
+		*/
+		bool AddWaitingJob(BaseJob *job);
+
+		/*!
+		Wait for the overlapped receive in flight to complete
+		@param[in] waitTimeInMilliSec the wait time in millisecond
+		@return true if no overlapped receive is in flight otherwise false
+		@remark the owner must not hold its lock while waiting, since the completion takes it.
+		*/
+		bool WaitForComplete(unsigned int waitTimeInMilliSec);
+
+		/*!
+		Commit the result of the overlapped receive
+		@param[in] transferredByte the received byte size
+		@param[in] isSucceeded the flag whether the overlapped receive succeeded
+		@param[out] retWaitingJobList the jobs which were waiting for the receive
+		@remark the caller must push and call ReleaseObj() for the returned jobs.
+		*/
+		void Complete(unsigned long transferredByte,bool isSucceeded,vector<BaseJob*> &retWaitingJobList);
+
+		/*!
+		Read the buffered data only
+		@param[out] data the buffer to copy the data into
+		@param[in] byteSize the maximum byte size to read
+		@return the byte size read
+		*/
+		unsigned int Read(char *data,unsigned int byteSize);
+
+		/*!
+		Receive the packet from the buffer and the socket
+		@param[in] socket the socket to read the remainder from
+		@param[out] packet the packet received
+		@return received byte size
+		*/
+		int Receive(SOCKET socket,Packet &packet);
+
+		/*!
+		Reset the buffer
+		@param[out] retWaitingJobList the jobs which were waiting for the receive
+		@remark the caller must push and call ReleaseObj() for the returned jobs.
+		*/
+		void Reset(vector<BaseJob*> &retWaitingJobList);
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Receive Buffer
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		IocpReceiveBuffer(const IocpReceiveBuffer& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		IocpReceiveBuffer & operator=(const IocpReceiveBuffer&b){return *this;}
+
+	private:
+		/// buffer
+		char *m_buffer;
+
+		/// byte size of the buffer
+		unsigned int m_bufferByteSize;
+
+		/// offset of the data not read yet
+		unsigned int m_dataOffset;
+
+		/// byte size of the data not read yet
+		unsigned int m_dataByteSize;
+
+		/// flag for the overlapped receive in flight
+		bool m_isPending;
+
+		/// flag for the closed connection
+		bool m_isClosed;
+
+		/// jobs waiting for the overlapped receive in flight
+		vector<BaseJob*> m_waitingJobList;
+
+		/// event raised while no overlapped receive is in flight
+		epl::EventEx m_completeEvent;
+	};
+}
+
+#endif //__EP_IOCP_RECEIVE_BUFFER_H__
\ No newline at end of file
@@ -59,6 +59,8 @@ namespace epse{
 			IOCP_SERVER_JOB_TYPE_RECEIVE,
 			/// disconnect job
 			IOCP_SERVER_JOB_TYPE_DISCONNECT,
+			/// send queue flush job
+			IOCP_SERVER_JOB_TYPE_FLUSH,
 		}IocpServerJobType;
 
 		/*!
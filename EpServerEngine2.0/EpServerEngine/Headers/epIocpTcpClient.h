@@ -40,6 +40,9 @@ An Interface for IOCP TCP Client.
 
 #include "epServerEngine.h"
 #include "epBaseTcpClient.h"
+#include "epIocpCompletionPort.h"
+#include "epIocpReceiveBuffer.h"
+#include "epJobScheduler.h"
 
 #include <vector>
 #include <queue>
@@ -52,7 +55,7 @@ namespace epse{
 	@class IocpTcpClient epIocpTcpClient.h
 	@brief A class for IOCP TCP Client.
 	*/
-	class EP_SERVER_ENGINE IocpTcpClient:public BaseTcpClient, public WorkerThreadDelegate{
+	class EP_SERVER_ENGINE IocpTcpClient:public BaseTcpClient, public IocpCompletionPortDelegate{
 	public:
 		/*!
 		Default Constructor
@@ -136,6 +139,17 @@ namespace epse{
 		*/
 		int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 
+		/*!
+		Send the packets to the server with a single gathered write
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred
+		*/
+		int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
 		/*!
 		Receive the packet from the server
 		@param[in] waitTimeInMilliSec wait time for receiving the packet in millisecond
@@ -158,10 +172,33 @@ namespace epse{
 
 	private:
 		/*!
-		Call Back Function.
-		@param[in] p the argument for call back function.
+		Call Back Function when the socket of the parked job is ready.
+		@param[in] context the job which was waiting for the socket
+		@param[in] transferredByte the byte size read into the buffer
+		@param[in] isSucceeded the flag whether the overlapped receive succeeded
+		*/
+		virtual void OnIoCompleted(epl::SmartObject *context,unsigned long transferredByte,bool isSucceeded);
+
+		/*!
+		Park the receive job until the client is ready to receive
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the receive job to resume
 		*/
-		virtual void CallBackFunc(BaseWorkerThread *p);
+		virtual void waitForReceive(BaseWorkerThread *workerThread,BaseJob *job);
+
+		/*!
+		Hand the timed out send job back to the job scheduler
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the send job to resume
+		*/
+		virtual void retrySend(BaseWorkerThread *workerThread,BaseJob *job);
+
+		/*!
+		Receive the packet with the current I/O engine
+		@param[out] packet the packet received
+		@return received byte size
+		*/
+		int receivePacket(Packet &packet);
 
 		/*!
 		Add new job to the worker thread.
@@ -172,13 +209,17 @@ namespace epse{
 		/// Status for connection
 		bool m_isConnected;
 
-		/// general lock 
-		epl::BaseLock *m_workerLock;
+		/// job scheduler for the worker threads
+		JobScheduler *m_jobScheduler;
+
+		/// completion port for the parked receive jobs
+		IocpCompletionPort *m_completionPort;
+
+		/// I/O engine type
+		IoEngineType m_ioEngineType;
 
-		/// Worker thread list
-		vector<BaseWorkerThread*> m_workerList;
-		/// worker thread list with no job
-		queue<BaseWorkerThread*> m_emptyWorkerList;
+		/// receive buffer for IO_ENGINE_TYPE_COMPLETION
+		IocpReceiveBuffer m_recvBuffer;
 
 	};
 }
@@ -41,13 +41,15 @@ An Interface for IOCP TCP Server.
 
 #include "epServerEngine.h"
 #include "epBaseTcpServer.h"
+#include "epIocpCompletionPort.h"
+#include "epJobScheduler.h"
 
 namespace epse{
 		/*! 
 	@class IocpTcpServer epIocpTcpServer.h
 	@brief A class for IOCP TCP Server.
 	*/
-	class EP_SERVER_ENGINE IocpTcpServer:public BaseTcpServer, public WorkerThreadDelegate{
+	class EP_SERVER_ENGINE IocpTcpServer:public BaseTcpServer, public IocpCompletionPortDelegate{
 		public:
 		/*!
 		Default Constructor
@@ -95,10 +97,20 @@ namespace epse{
 
 			
 		/*!
-		Call Back Function.
-		@param[in] p the argument for call back function.
+		Call Back Function when the socket of the parked job is ready.
+		@param[in] context the job which was waiting for the socket
+		@param[in] transferredByte the byte size read into the buffer
+		@param[in] isSucceeded the flag whether the overlapped receive succeeded
 		*/
-		virtual void CallBackFunc(BaseWorkerThread *p);
+		virtual void OnIoCompleted(epl::SmartObject *context,unsigned long transferredByte,bool isSucceeded);
+
+		/*!
+		Call Back Function when the overlapped send of the parked flush job is completed.
+		@param[in] context the flush job which was waiting for the send
+		@param[in] transferredByte the byte size written to the socket
+		@param[in] isSucceeded the flag whether the overlapped send succeeded
+		*/
+		virtual void OnSendCompleted(epl::SmartObject *context,unsigned long transferredByte,bool isSucceeded);
 
 		friend class IocpTcpSocket;
 
@@ -109,17 +121,57 @@ namespace epse{
 		void pushJob(BaseJob * job);
 
 		/*!
-		Listening Loop Function
+		Park the receive job until the given socket is ready to receive.
+		@param[in] socket the socket to wait for
+		@param[in] job the receive job to resume
+		@param[in] buffer the buffer to read into
+		@param[in] bufferByteSize the byte size of the buffer
+		@return true if the job is parked otherwise false
+		@remark if the job cannot be parked, it is pushed to the worker thread directly.
+		*/
+		bool waitForReceive(SOCKET socket,BaseJob * job,char *buffer=NULL,unsigned int bufferByteSize=0);
+
+		/*!
+		Park the flush job until the given buffers are written to the socket.
+		@param[in] socket the socket to write to
+		@param[in] job the flush job to resume
+		@param[in] bufferList the buffers to write
+		@param[in] bufferCount the number of the buffers
+		@return true if the job is parked otherwise false
+		@remark if the job cannot be parked, the caller should process the job by itself.
+		*/
+		bool waitForSend(SOCKET socket,BaseJob * job,WSABUF *bufferList,unsigned int bufferCount);
+
+		/*!
+		Accept on the given listening socket until the server stops
+		@param[in] listenSocket the listening socket to loop on
+		*/
+		virtual void listenLoop(SOCKET listenSocket);
+
+		/*!
+		Start the broadcast worker threads
+		@return false always
+		@remark the sockets queue the broadcast packet to the worker threads, so no broadcast thread is started.
 		*/
-		virtual void execute() ;
+		virtual bool startBroadcaster(){return false;}
+
+		/// job scheduler for the worker threads
+		JobScheduler *m_jobScheduler;
+
+		/// completion port for the parked receive and flush jobs
+		IocpCompletionPort *m_completionPort;
+
+		/// I/O engine type
+		IoEngineType m_ioEngineType;
+
+		/// high watermark of the send queue of the sockets
+		unsigned int m_sendQueueHighWatermark;
 
-		/// general lock 
-		epl::BaseLock *m_workerLock;
+		/// low watermark of the send queue of the sockets
+		unsigned int m_sendQueueLowWatermark;
 
-		/// Worker thread list
-		vector<BaseWorkerThread*> m_workerList;
-		/// worker thread list with no job
-		queue<BaseWorkerThread*> m_emptyWorkerList;
+		/// policy of the send queue of the sockets
+		SendQueuePolicy m_sendQueuePolicy;
 
 	};
 }
@@ -40,6 +40,8 @@ An Interface for IOCP TCP Socket.
 
 #include "epServerEngine.h"
 #include "epBaseTcpSocket.h"
+#include "epIocpReceiveBuffer.h"
+#include "epSendQueue.h"
 
 namespace epse
 {
@@ -91,9 +93,17 @@ namespace epse
 		@param[in] callBackObj the object to callback when send is completed
 		@param[in] priority the priority of the send job
 		@remark if the completionEvent and callBackObj are set as NULL, it is ignored.
+		@remark the packet is queued to the send queue, and sent in the queued order.
+		@remark if the send queue is over the high watermark, the policy of the server is applied.
 		*/
 		void Send(Packet &packet,EventEx *completionEvent=NULL,ServerCallbackInterface *callBackObj=NULL,Priority priority=PRIORITY_NORMAL);
 
+		/*!
+		Get the byte size of the packets queued to send
+		@return the byte size of the packets queued to send
+		*/
+		unsigned int GetSendQueueByteSize() const;
+
 
 		/*!
 		Receive the packet from the client
@@ -118,6 +128,17 @@ namespace epse
 		*/
 		int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 
+		/*!
+		Send the packets to the client with a single gathered write
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred
+		*/
+		int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
 
 		/*!
 		Receive the packet from the client
@@ -139,6 +160,86 @@ namespace epse
 		*/
 		void killConnectionNoCallBack();
 
+		/*!
+		Queue the shared packet to the send queue without copying
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec wait time in millisecond for the room of the send queue
+		@return true always
+		@remark with SEND_QUEUE_POLICY_BLOCK, the packet is dropped if no room is made within the wait time.
+		*/
+		virtual bool queueSend(Packet &packet,unsigned int waitTimeInMilliSec);
+
+		/*!
+		Push the packet to the send queue, and start the flush if not flushing
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec wait time in millisecond for the room of the send queue
+		@param[in] completionEvent the event to set when send is completed
+		@param[in] callBackObj the object to callback when send is completed
+		@param[in] priority the priority of the flush job
+		*/
+		void pushSend(Packet &packet,unsigned int waitTimeInMilliSec,EventEx *completionEvent,ServerCallbackInterface *callBackObj,Priority priority);
+
+		/*!
+		Park the receive job until the socket is ready to receive
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the receive job to resume
+		*/
+		virtual void waitForReceive(BaseWorkerThread *workerThread,BaseJob *job);
+
+		/*!
+		Hand the timed out send job back to the job scheduler
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the send job to resume
+		*/
+		virtual void retrySend(BaseWorkerThread *workerThread,BaseJob *job);
+
+		/*!
+		Commit the result of the overlapped receive
+		@param[in] transferredByte the byte size read into the buffer
+		@param[in] isSucceeded the flag whether the overlapped receive succeeded
+		*/
+		void completeReceive(unsigned long transferredByte,bool isSucceeded);
+
+		/*!
+		Commit the result of the overlapped send posted by the flush
+		@param[in] transferredByte the byte size written to the socket
+		@param[in] isSucceeded the flag whether the overlapped send succeeded
+		@remark the flush job is resumed after this to pop the packets written.
+		*/
+		void completeSend(unsigned long transferredByte,bool isSucceeded);
+
+		/*!
+		Set the watermarks and the policy of the send queue
+		@param[in] highWatermark the queued byte size over which the policy is applied
+		@param[in] lowWatermark the queued byte size at which OnWritable is called
+		@param[in] policy the policy applied over the high watermark
+		*/
+		void setSendQueueWatermark(unsigned int highWatermark,unsigned int lowWatermark,SendQueuePolicy policy);
+
+		/*!
+		Send the packets in the send queue with a gathered overlapped write
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the flush job to resume
+		@remark the job is parked on the completion port until the write completes,
+		        so no worker thread waits for the slow reader.
+		*/
+		virtual void flushSendQueue(BaseWorkerThread *workerThread,BaseJob *job);
+
+		/*!
+		Notify the completion of the send
+		@param[in] completionEvent the event to set
+		@param[in] callBackObj the object to callback, or NULL for the callback object of the socket
+		@param[in] sendStatus the status of the send
+		*/
+		void notifySent(EventEx *completionEvent,ServerCallbackInterface *callBackObj,SendStatus sendStatus);
+
+		/*!
+		Receive the packet with the current I/O engine
+		@param[out] packet the packet received
+		@return received byte size
+		*/
+		int receivePacket(Packet &packet);
+
 		/*!
 		thread loop function
 		*/
@@ -169,6 +270,27 @@ namespace epse
 
 		/// Connection status
 		bool m_isConnected;
+
+		/// receive buffer for IO_ENGINE_TYPE_COMPLETION
+		IocpReceiveBuffer m_recvBuffer;
+
+		/// outbound queue
+		SendQueue m_sendQueue;
+
+		/// byte size of the framed front packet, length header included, already written by the previous sends
+		unsigned long m_sentOffset;
+
+		/// length headers of the posted packets, kept until the overlapped send completes
+		unsigned int m_sentLengthList[SEND_GATHER_PACKET_COUNT];
+
+		/// flag whether the overlapped send posted by the flush is completed
+		bool m_isSendCompleted;
+
+		/// flag whether the completed overlapped send succeeded
+		bool m_isSendSucceeded;
+
+		/// byte size written by the completed overlapped send
+		unsigned long m_sentByteSize;
 	};
 
 }
@@ -40,6 +40,7 @@ An Interface for IOCP UDP Client.
 
 #include "epServerEngine.h"
 #include "epBaseUdpClient.h"
+#include "epJobScheduler.h"
 
 #include <vector>
 #include <queue>
@@ -52,7 +53,7 @@ namespace epse{
 	@class IocpUdpClient epIocpUdpClient.h
 	@brief A class for IOCP UDP Client.
 	*/
-	class EP_SERVER_ENGINE IocpUdpClient:public BaseUdpClient, public WorkerThreadDelegate{
+	class EP_SERVER_ENGINE IocpUdpClient:public BaseUdpClient{
 
 	public:
 		/*!
@@ -137,6 +138,17 @@ namespace epse{
 		@remark return -1 if error occurred
 		*/
 		int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
+		/*!
+		Send the packets to the server as the datagrams
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred
+		*/
+		int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 	
 		/*!
 		Receive the packet from the server
@@ -160,10 +172,11 @@ namespace epse{
 
 	private:
 		/*!
-		Call Back Function.
-		@param[in] p the argument for call back function.
+		Hand the timed out send job back to the job scheduler
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the send job to resume
 		*/
-		virtual void CallBackFunc(BaseWorkerThread *p);
+		virtual void retrySend(BaseWorkerThread *workerThread,BaseJob *job);
 
 		/*!
 		Add new job to the worker thread.
@@ -174,13 +187,8 @@ namespace epse{
 		/// Flag for connection
 		bool m_isConnected;
 
-		/// general lock 
-		epl::BaseLock *m_workerLock;
-
-		/// Worker thread list
-		vector<BaseWorkerThread*> m_workerList;
-		/// worker thread list with no job
-		queue<BaseWorkerThread*> m_emptyWorkerList;
+		/// job scheduler for the worker threads
+		JobScheduler *m_jobScheduler;
 	};
 }
 
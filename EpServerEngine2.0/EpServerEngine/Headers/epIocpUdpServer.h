@@ -41,13 +41,14 @@ An Interface for IOCP UDP Server.
 
 #include "epServerEngine.h"
 #include "epBaseUdpServer.h"
+#include "epJobScheduler.h"
 
 namespace epse{
 		/*! 
 	@class IocpUdpServer epIocpUdpServer.h
 	@brief A class for IOCP UDP Server.
 	*/
-	class EP_SERVER_ENGINE IocpUdpServer:public BaseUdpServer, public WorkerThreadDelegate{
+	class EP_SERVER_ENGINE IocpUdpServer:public BaseUdpServer{
 		public:
 		/*!
 		Default Constructor
@@ -94,12 +95,6 @@ namespace epse{
 	private:
 
 			
-		/*!
-		Call Back Function.
-		@param[in] p the argument for call back function.
-		*/
-		virtual void CallBackFunc(BaseWorkerThread *p);
-
 		friend class IocpUdpSocket;
 
 		/*!
@@ -109,17 +104,22 @@ namespace epse{
 		void pushJob(BaseJob * job);
 
 		/*!
-		Listening Loop Function
+		Process the datagram received from the client
+		@param[in] packetData the received datagram
+		@param[in] recvLength the byte size of the datagram, or 0 or less if the receive failed
+		@param[in] clientSockAddr the socket address of the client
 		*/
-		virtual void execute() ;
+		virtual void processDatagram(const char *packetData,int recvLength,const sockaddr &clientSockAddr);
 
-		/// general lock 
-		epl::BaseLock *m_workerLock;
+		/*!
+		Start the broadcast worker threads
+		@return false always
+		@remark no broadcast thread is started for IOCP Server, so the broadcast packet is sent by the caller thread.
+		*/
+		virtual bool startBroadcaster(){return false;}
 
-		/// Worker thread list
-		vector<BaseWorkerThread*> m_workerList;
-		/// worker thread list with no job
-		queue<BaseWorkerThread*> m_emptyWorkerList;
+		/// job scheduler for the worker threads
+		JobScheduler *m_jobScheduler;
 
 	};
 }
@@ -108,6 +108,13 @@ namespace epse
 		friend class IocpUdpServer;
 		friend class IocpUdpProcessor;
 
+		/*!
+		Hand the timed out send job back to the job scheduler
+		@param[in] workerThread the worker thread which processed the job
+		@param[in] job the send job to resume
+		*/
+		virtual void retrySend(BaseWorkerThread *workerThread,BaseJob *job);
+
 		/*!
 		Send the packet to the server
 		@param[in] packet the packet to be sent
@@ -118,6 +125,17 @@ namespace epse
 		*/
 		int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 
+		/*!
+		Send the packets to the client as the datagrams
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred
+		*/
+		int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
 
 		/*!
 		Receive the packet from the client
@@ -139,6 +157,14 @@ namespace epse
 		*/
 		void killConnectionNoCallBack();
 
+		/*!
+		Queue the shared packet to the worker threads without copying
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec not used, since the job is queued without waiting
+		@return true always
+		*/
+		virtual bool queueSend(Packet &packet,unsigned int waitTimeInMilliSec);
+
 		/*!
 		thread loop function
 		*/
@@ -172,9 +198,6 @@ namespace epse
 	
 	
 	private:
-		/// Packet Received Event
-		epl::EventEx m_packetReceivedEvent;
-
 		/// Connection status
 		bool m_isConnected;
 	};
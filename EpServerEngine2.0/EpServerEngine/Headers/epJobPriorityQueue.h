@@ -0,0 +1,148 @@
+/*! 
+@file epJobPriorityQueue.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief JobPriorityQueue Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Job Priority Queue.
+
+*/
+#ifndef __EP_JOB_PRIORITY_QUEUE_H__
+#define __EP_JOB_PRIORITY_QUEUE_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include <map>
+#include <deque>
+#include <vector>
+#include <functional>
+
+using namespace std;
+
+namespace epse{
+
+	/*! 
+	@class JobPriorityQueue epJobPriorityQueue.h
+	@brief A class for Job Priority Queue which keeps a FIFO bucket for each priority.
+
+	Push takes O(log p) time and Pop takes O(p) time at worst, where p is the number of the
+	priorities ever pushed, and the jobs with the same priority are popped in the order they were pushed.
+	The emptied buckets are kept, so the steady state allocates no bucket.
+	@remark the queue is not thread safe, so the owner must guard it.
+	*/
+	class EP_SERVER_ENGINE JobPriorityQueue{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Queue
+		*/
+		JobPriorityQueue();
+
+		/*!
+		Default Destructor
+
+		Destroy the Queue
+		@remark the jobs left in the queue are not released.
+		*/
+		virtual ~JobPriorityQueue();
+
+		/*!
+		Insert the given job at the back of its priority bucket
+		@param[in] job the job to insert
+		*/
+		void Push(BaseJob *job);
+
+		/*!
+		Remove the oldest job with the highest priority
+		@return the job removed, or NULL if the queue is empty
+		*/
+		BaseJob *PopFront();
+
+		/*!
+		Remove the newest job with the highest priority
+		@return the job removed, or NULL if the queue is empty
+		*/
+		BaseJob *PopBack();
+
+		/*!
+		Move all the jobs in the queue to the given list
+		@param[out] retJobList the list to append the jobs
+		*/
+		void Clear(vector<BaseJob*> &retJobList);
+
+		/*!
+		Get the number of the jobs in the queue
+		@return the number of the jobs
+		*/
+		size_t Size() const;
+
+		/*!
+		Check if the queue is empty
+		@return true if the queue is empty otherwise false
+		*/
+		bool IsEmpty() const;
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Queue
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		JobPriorityQueue(const JobPriorityQueue& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		JobPriorityQueue & operator=(const JobPriorityQueue&b){return *this;}
+
+		/// bucket map type which orders the priorities from the highest
+		typedef map<Priority,deque<BaseJob*>,greater<Priority> > BucketMap;
+
+		/*!
+		Find the bucket of the highest priority which holds any job
+		@return the iterator to the bucket, or the end if the queue is empty
+		*/
+		BucketMap::iterator frontBucket();
+
+		/// job buckets for each priority
+		BucketMap m_bucketMap;
+		/// number of the jobs in the queue
+		size_t m_jobCount;
+	};
+}
+
+#endif //__EP_JOB_PRIORITY_QUEUE_H__
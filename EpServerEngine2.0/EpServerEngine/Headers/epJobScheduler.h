@@ -0,0 +1,240 @@
+/*! 
+@file epJobScheduler.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Job Scheduler Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Job Scheduler.
+
+The Job Scheduler keeps a job queue for each worker thread. The jobs are
+pushed to the queues in round robin without a global lock, and a worker
+thread which runs out of its own jobs steals from the back of the other
+queues, so the idle worker threads pull the load.
+The job queues are ordered by the job priority, and the jobs with the same
+priority are processed in the order they were pushed.
+
+*/
+#ifndef __EP_JOB_SCHEDULER_H__
+#define __EP_JOB_SCHEDULER_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include "epServerLockPolicy.h"
+#include "epJobPriorityQueue.h"
+
+using namespace std;
+
+namespace epse{
+
+	/*! 
+	@class JobScheduler epJobScheduler.h
+	@brief A class for Job Scheduler which balances the jobs over the worker threads by work stealing.
+
+	Each worker thread has its own job queue. The jobs are pushed to the queues in round robin
+	without the global lock, and the worker thread which runs out of its own jobs steals
+	the jobs from the other queues before it goes idle.
+	*/
+	class EP_SERVER_ENGINE JobScheduler{
+	public:
+		friend class JobSchedulerProcessor;
+
+		/*!
+		Default Constructor
+
+		Initializes the Scheduler
+		@param[in] waitTimeMilliSec wait time for the worker threads to terminate
+		@param[in] lockPolicyType The lock policy
+		*/
+		JobScheduler(unsigned int waitTimeMilliSec=WAITTIME_INIFINITE,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Scheduler
+		*/
+		virtual ~JobScheduler();
+
+		/*!
+		Start the worker threads
+		@param[in] workerThreadCount the number of worker threads
+		@param[in] jobProcessor the job processor which processes the jobs
+		@return true if successfully created otherwise false
+		@remark if workerThreadCount is 0, the number of the cores is used.
+		@remark the scheduler retains the job processor.
+		*/
+		bool Create(unsigned int workerThreadCount,BaseJobProcessor *jobProcessor);
+
+		/*!
+		Terminate the worker threads and release the jobs not processed
+		*/
+		void Close();
+
+		/*!
+		Get the number of worker threads
+		@return the number of worker threads
+		*/
+		unsigned int GetWorkerThreadCount() const;
+
+		/*!
+		Push the given job to the worker threads
+		@param[in] job the job to process
+		@return true if the job is pushed otherwise false
+		@remark the scheduler retains the job until it is processed.
+		@remark false is returned once Close is called, and the job is not retained.
+		*/
+		bool Push(BaseJob *job);
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Scheduler
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		JobScheduler(const JobScheduler& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		JobScheduler & operator=(const JobScheduler&b){return *this;}
+
+		/// Enumerator for the worker state
+		enum WorkerState{
+			/// the worker thread is idle
+			WORKER_STATE_IDLE=0,
+			/// the worker thread is signaled to check the job queues
+			WORKER_STATE_SIGNALED,
+			/// the worker thread is processing the jobs
+			WORKER_STATE_RUNNING,
+			/// the worker thread is closed
+			WORKER_STATE_CLOSED,
+		};
+
+		/*!
+		@class WakeUpJob epJobScheduler.h
+		@brief the job which wakes up the worker thread to run the job queues.
+		*/
+		class WakeUpJob:public BaseJob{
+		public:
+			/*!
+			Default Constructor
+
+			Initializes the Job
+			@param[in] lockPolicyType The lock policy
+			*/
+			WakeUpJob(epl::LockPolicy lockPolicyType):BaseJob(PRIORITY_NORMAL,lockPolicyType){}
+		};
+
+		/*!
+		@struct WorkerSlot epJobScheduler.h
+		@brief the job queue and the state of a worker thread.
+		*/
+		struct WorkerSlot{
+			/// worker thread
+			BaseWorkerThread *m_workerThread;
+			/// job which wakes up the worker thread
+			BaseJob *m_wakeUpJob;
+			/// job queue
+			JobPriorityQueue m_jobList;
+			/// job queue lock
+			ServerCriticalSection m_jobLock;
+			/// number of the jobs in the queue
+			volatile long m_jobCount;
+			/// worker state
+			volatile long m_state;
+		};
+
+		/*!
+		Signal the worker thread to check the job queues
+		@param[in] slot the slot of the worker thread
+		@return true if the idle worker thread is woken up otherwise false
+		*/
+		bool signal(WorkerSlot &slot);
+
+		/*!
+		Process the jobs until all the job queues are empty
+		@param[in] slotIndex the slot index of the worker thread
+		@param[in] workerThread the worker thread
+		*/
+		void run(unsigned int slotIndex,BaseWorkerThread *workerThread);
+
+		/*!
+		Pop the oldest job with the highest priority from the given slot
+		@param[in] slotIndex the slot index to pop from
+		@return the job popped, or NULL if the queue is empty
+		*/
+		BaseJob *popJob(unsigned int slotIndex);
+
+		/*!
+		Steal the newest job with the highest priority from the other slots
+		@param[in] slotIndex the slot index of the thief
+		@return the job stolen, or NULL if all the queues are empty
+		*/
+		BaseJob *stealJob(unsigned int slotIndex);
+
+		/*!
+		Release the jobs left in the job queues
+		*/
+		void clearJobs();
+
+		/*!
+		Delete the slots
+		*/
+		void deleteSlots();
+
+	private:
+		/// scheduler lock for Create and Close
+		epl::BaseLock *m_schedulerLock;
+		/// worker slots
+		WorkerSlot *m_slotList;
+		/// number of the worker slots accepting the jobs
+		volatile long m_slotCount;
+
+		/// number of the threads in Push, which Close waits for before releasing the slots
+		volatile long m_pushingCount;
+		/// number of the allocated worker slots
+		unsigned int m_allocatedSlotCount;
+		/// next slot to push the job
+		volatile long m_nextSlot;
+		/// job processor
+		BaseJobProcessor *m_jobProcessor;
+		/// wait time in millisecond for terminating thread
+		unsigned int m_waitTime;
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+	};
+}
+
+#endif //__EP_JOB_SCHEDULER_H__
@@ -0,0 +1,220 @@
+/*!
+@file epMultiplexLink.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Multiplex Link Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for the Multiplex Link.
+
+The Multiplex Link is a connection to the forward server shared by many sessions.
+Each packet on the link is prefixed with MultiplexHeader, so the forward server
+must read the header to tell the sessions apart, and prefix it to its replies.
+
+*/
+#ifndef __EP_MULTIPLEX_LINK_H__
+#define __EP_MULTIPLEX_LINK_H__
+
+#include "epServerEngine.h"
+#include "epClientInterfaces.h"
+#include "epProxyServerInterfaces.h"
+#include "epMultiplexSession.h"
+#include "epServerSmartObject.h"
+#include <map>
+
+using namespace std;
+
+namespace epse{
+
+	class AsyncTcpClient;
+
+	/// Enumerator for the type of the packet on the multiplex link
+	typedef enum _multiplexPacketType{
+		/// the session is opened
+		MULTIPLEX_PACKET_TYPE_OPEN=0,
+		/// the packet of the session
+		MULTIPLEX_PACKET_TYPE_DATA,
+		/// the session is closed
+		MULTIPLEX_PACKET_TYPE_CLOSE,
+	}MultiplexPacketType;
+
+	/*!
+	@struct MultiplexHeader epMultiplexLink.h
+	@brief the header prefixed to each packet on the multiplex link.
+
+	The header is 8 bytes on the wire, the 4 byte session ID followed by the 4 byte MultiplexPacketType,
+	both in the network byte order, so the forward server may run on a host of any byte order.
+	*/
+	struct MultiplexHeader{
+		/// session ID
+		unsigned int sessionId;
+		/// the type of the packet
+		unsigned int type;
+	};
+
+	/*!
+	@class MultiplexLink epMultiplexLink.h
+	@brief A class for the connection to the forward server shared by the sessions.
+
+	The link is kept alive by the reference of the pool and of each session,
+	so a session never outlives the link it points to.
+	*/
+	class EP_SERVER_ENGINE MultiplexLink:public ServerSmartObject, public ClientCallbackInterface{
+		friend class MultiplexSession;
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Link
+		@param[in] forwardServerInfo the forward server info
+		@param[in] lockPolicyType The lock policy
+		*/
+		MultiplexLink(const ForwardServerInfo &forwardServerInfo,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Open a new session over the link
+		@param[in] callBackObj the callback object of the session
+		@return the session with the reference count of 1
+		@remark the link is connected if not connected.<br/>
+		        The session is not opened if the link failed to connect or is closed.
+		*/
+		MultiplexSession *OpenSession(ClientCallbackInterface *callBackObj);
+
+		/*!
+		Get the number of the sessions opened
+		@return the number of the sessions opened
+		*/
+		unsigned int GetSessionCount() const;
+
+		/*!
+		Check if the link is connected
+		@return true if the link is connected otherwise false
+		*/
+		bool IsConnectionAlive() const;
+
+		/*!
+		Disconnect the link, closing all the sessions
+		*/
+		void Disconnect();
+
+		/*!
+		Close the link for good, closing all the sessions
+		@remark the link is not connected again by OpenSession once closed,
+		        and no callback runs on the thread of the link after this returns.
+		*/
+		void Close();
+
+	protected:
+		/*!
+		Received the packet from the forward server.
+		@param[in] client the client of the link
+		@param[in] receivedPacket the received packet
+		@param[in] status the status of Receive
+		*/
+		void OnReceived(ClientInterface *client,const Packet*receivedPacket,ReceiveStatus status);
+
+		/*!
+		The link is disconnected.
+		@param[in] client the client of the link
+		*/
+		void OnDisconnect(ClientInterface *client);
+
+	private:
+		/*!
+		Send the packet of the session with the header prefixed
+		@param[in] sessionId the ID of the session
+		@param[in] type the type of the packet
+		@param[in] packet the packet to send, or NULL for the header only
+		@param[in] waitTimeInMilliSec wait time for sending the packet in millisecond
+		@param[out] sendStatus the status of Send
+		@return sent byte size including the header
+		*/
+		int send(unsigned int sessionId,MultiplexPacketType type,const Packet *packet,unsigned int waitTimeInMilliSec,SendStatus *sendStatus);
+
+		/*!
+		Close the given session
+		@param[in] session the session to close
+		@remark nothing is done if the session is already closed.
+		*/
+		void closeSession(MultiplexSession *session);
+
+		/*!
+		Default Destructor
+
+		Destroy the Link
+		@remark the link is deleted by ReleaseObj when the pool and all the sessions released it.
+		*/
+		virtual ~MultiplexLink();
+
+		/*!
+		Default Copy Constructor
+
+		Initializes the Link
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		MultiplexLink(const MultiplexLink& b){EP_ASSERT(0);}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		MultiplexLink & operator=(const MultiplexLink&b){EP_ASSERT(0);return *this;}
+
+	private:
+		/// hostname of the forward server
+		epl::EpTString m_hostName;
+
+		/// port of the forward server
+		epl::EpTString m_port;
+
+		/// the client connected to the forward server
+		AsyncTcpClient *m_client;
+
+		/// opened sessions by ID
+		map<unsigned int,MultiplexSession*> m_sessionMap;
+
+		/// the ID for the next session
+		unsigned int m_nextSessionId;
+
+		/// flag whether the link is closed for good
+		bool m_isClosed;
+
+		/// link lock
+		epl::BaseLock *m_linkLock;
+
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+	};
+}
+
+#endif //__EP_MULTIPLEX_LINK_H__
@@ -0,0 +1,172 @@
+/*!
+@file epMultiplexSession.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Multiplex Session Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for the Multiplex Session.
+
+The Multiplex Session is the client of one proxy connection, whose packets
+are carried over the Multiplex Link shared with the other sessions.
+
+*/
+#ifndef __EP_MULTIPLEX_SESSION_H__
+#define __EP_MULTIPLEX_SESSION_H__
+
+#include "epServerEngine.h"
+#include "epClientInterfaces.h"
+#include "epServerSmartObject.h"
+
+namespace epse{
+
+	class MultiplexLink;
+
+	/*!
+	@class MultiplexSession epMultiplexSession.h
+	@brief A class for the client session multiplexed over the shared link.
+	*/
+	class EP_SERVER_ENGINE MultiplexSession:public ServerSmartObject, public ClientInterface{
+		friend class MultiplexLink;
+	public:
+		/*!
+		Set the wait time for the send
+		@param[in] milliSec the time for waiting in millisecond
+		*/
+		void SetWaitTime(unsigned int milliSec);
+
+		/*!
+		Get the wait time for the send
+		@return the current time for waiting in millisecond
+		*/
+		unsigned int GetWaitTime() const;
+
+		/*!
+		Connect to the server
+		@param[in] ops the client options
+		@return true if the session is opened otherwise false
+		@remark the session is opened by the link, and cannot be opened again once closed.
+		*/
+		bool Connect(const ClientOps &ops=ClientOps::defaultClientOps);
+
+		/*!
+		Close the session
+		@remark the link is not disconnected.
+		*/
+		void Disconnect();
+
+		/*!
+		Check if the session is opened
+		@return true if the session is opened otherwise false
+		*/
+		bool IsConnectionAlive() const;
+
+		/*!
+		Send the packet to the server over the link
+		@param[in] packet the packet to be sent
+		@param[in] waitTimeInMilliSec wait time for sending the packet in millisecond
+		@param[out] sendStatus the status of Send
+		@return sent byte size
+		*/
+		int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
+		/*!
+		Set the Callback Object for the session.
+		@param[in] callBackObj The Callback Object to set.
+		*/
+		void SetCallbackObject(ClientCallbackInterface *callBackObj);
+
+		/*!
+		Get the Callback Object of the session
+		@return the current Callback Object
+		*/
+		ClientCallbackInterface *GetCallbackObject();
+
+		/*!
+		Get the ID of the session
+		@return the ID of the session unique in the link
+		*/
+		unsigned int GetSessionId() const;
+
+	private:
+		/*!
+		Default Constructor
+
+		Initializes the Session
+		@param[in] link the link carrying the session
+		@param[in] sessionId the ID of the session
+		@param[in] callBackObj the callback object
+		@param[in] lockPolicyType The lock policy
+		*/
+		MultiplexSession(MultiplexLink *link,unsigned int sessionId,ClientCallbackInterface *callBackObj,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Session
+		*/
+		virtual ~MultiplexSession();
+
+		/*!
+		Default Copy Constructor
+
+		Initializes the Session
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		MultiplexSession(const MultiplexSession& b){EP_ASSERT(0);}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		MultiplexSession & operator=(const MultiplexSession&b){EP_ASSERT(0);return *this;}
+
+	private:
+		/// the link carrying the session
+		MultiplexLink *m_link;
+
+		/// session ID
+		unsigned int m_sessionId;
+
+		/// callback object
+		ClientCallbackInterface *m_callBackObj;
+
+		/// wait time in millisecond for the send
+		unsigned int m_waitTime;
+
+		/// flag whether the session is opened
+		bool m_isConnected;
+	};
+}
+
+#endif //__EP_MULTIPLEX_SESSION_H__
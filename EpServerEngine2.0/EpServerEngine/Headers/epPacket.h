@@ -39,6 +39,9 @@ An Interface for Packet.
 #define __EP_PACKET_H__
 
 #include "epServerEngine.h"
+#include "epPacketPool.h"
+#include "epPacketBuffer.h"
+#include "epServerSmartObject.h"
 
 namespace epse{
 
@@ -46,7 +49,7 @@ namespace epse{
 	@class Packet epPacket.h
 	@brief A class for Packet.
 	*/
-	class EP_SERVER_ENGINE Packet:public epl::SmartObject{
+	class EP_SERVER_ENGINE Packet:public ServerSmartObject{
 
 	public:
 		/*!
@@ -65,15 +68,29 @@ namespace epse{
 
 		Initializes the Packet
 		@param[in] b the original Packet object
+		@remark the allocated memory is shared with b without copying.
 		*/
 		Packet(const Packet& b);
 
+		/*!
+		Slice Constructor
+
+		Initializes the Packet as the view of the part of the given packet
+		@param[in] b the original Packet object
+		@param[in] offset the byte offset of the view in b
+		@param[in] byteSize the byte size of the view
+		@param[in] lockPolicyType The lock policy
+		@remark the allocated memory is shared with b without copying.
+		*/
+		Packet(const Packet& b, unsigned int offset, unsigned int byteSize, epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
 		/*!
 		Assignment Operator Overloading
 
 		the Packet set as given packet b
 		@param[in] b right side of packet
 		@return this object
+		@remark the allocated memory is shared with b without copying.
 		*/
 		Packet & operator=(const Packet&b);
 
@@ -92,7 +109,7 @@ namespace epse{
 
 		/*!
 		Get the flag whether memory is allocated or not
-		@return true if the memory is allocated by this object, otherwise false
+		@return true if the memory is allocated by this object or shared with the other Packet, otherwise false
 		*/
 		bool IsAllocated() const
 		{
@@ -102,6 +119,7 @@ namespace epse{
 		/*!
 		Return the currently holding packet
 		@return holding packet
+		@remark the memory may be shared with the other Packets, so it must not be changed once copied or sliced.
 		*/
 		const char *GetPacket() const;
 
@@ -109,15 +127,52 @@ namespace epse{
 		Set the packet as given
 		@param[in] packet the packet data
 		@param[in] packetByteSize the size of packet given
+		@remark the shared memory is left to the other Packets, and the new memory is allocated.
 		*/
 		void SetPacket(const void* packet, unsigned int packetByteSize);
 
+		/*!
+		Allocate the Packet object from the Packet Pool
+		@param[in] size the byte size of the object
+		@return the pointer to the memory allocated
+		*/
+		static void *operator new(size_t size);
+
+		/*!
+		Return the Packet object to the Packet Pool
+		@param[in] p the pointer to the object
+		*/
+		static void operator delete(void *p);
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+		/*!
+		Allocate the Packet object from the Packet Pool for DEBUG_NEW
+		@param[in] size the byte size of the object
+		@param[in] blockType the block type
+		@param[in] fileName the file name of the caller
+		@param[in] lineNumber the line number of the caller
+		@return the pointer to the memory allocated
+		*/
+		static void *operator new(size_t size,int blockType,const char *fileName,int lineNumber);
+
+		/*!
+		Return the Packet object to the Packet Pool for DEBUG_NEW
+		@param[in] p the pointer to the object
+		@param[in] blockType the block type
+		@param[in] fileName the file name of the caller
+		@param[in] lineNumber the line number of the caller
+		*/
+		static void operator delete(void *p,int blockType,const char *fileName,int lineNumber);
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
 	private:
 
 		/*!
 		Reset Packet
 		*/
 		void resetPacket();
+		/// shared memory of the packet, or NULL if not allocated
+		PacketBuffer *m_buffer;
 		/// packet
 		char *m_packet;
 		/// packet Byte Size
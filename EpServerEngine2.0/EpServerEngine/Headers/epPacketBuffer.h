@@ -0,0 +1,132 @@
+/*! 
+@file epPacketBuffer.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Packet Buffer Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for the Packet Buffer.
+
+The packet buffer is the memory shared by the Packets copied or sliced from one another,
+so the payload is not copied when it is forwarded to the many destinations.
+
+*/
+#ifndef __EP_PACKET_BUFFER_H__
+#define __EP_PACKET_BUFFER_H__
+
+#include "epServerEngine.h"
+#include "epPacketPool.h"
+#include "epServerSmartObject.h"
+
+namespace epse{
+
+	/*! 
+	@class PacketBuffer epPacketBuffer.h
+	@brief A class for the memory of the packet shared by the reference count.
+
+	The object and its memory are allocated from the Packet Pool as one block.
+	*/
+	class EP_SERVER_ENGINE PacketBuffer:public ServerSmartObject{
+
+	public:
+		/*!
+		Create the buffer of the given byte size
+		@param[in] byteSize the byte size of the buffer
+		@param[in] lockPolicyType The lock policy
+		@return the buffer created with the reference count of 1
+		*/
+		static PacketBuffer *Create(unsigned int byteSize,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Return the memory of the buffer
+		@return the memory of the buffer
+		*/
+		char *GetBuffer()
+		{
+			return reinterpret_cast<char*>(this+1);
+		}
+
+		/*!
+		Return the byte size of the buffer
+		@return the byte size of the buffer
+		*/
+		unsigned int GetByteSize() const
+		{
+			return m_byteSize;
+		}
+
+		/*!
+		Return the buffer to the Packet Pool
+		@param[in] p the pointer to the object
+		*/
+		static void operator delete(void *p);
+
+	protected:
+		/*!
+		Default Constructor
+
+		Initializes the Buffer
+		@param[in] byteSize the byte size of the buffer
+		@param[in] lockPolicyType The lock policy
+		*/
+		PacketBuffer(unsigned int byteSize,epl::LockPolicy lockPolicyType);
+
+		/*!
+		Default Destructor
+
+		Destroy the Buffer
+		*/
+		virtual ~PacketBuffer();
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Buffer
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		PacketBuffer(const PacketBuffer& b):ServerSmartObject(b){EP_ASSERT(0);}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		PacketBuffer & operator=(const PacketBuffer&b){EP_ASSERT(0);return *this;}
+
+	private:
+		/// byte size of the buffer
+		unsigned int m_byteSize;
+	};
+}
+
+#endif //__EP_PACKET_BUFFER_H__
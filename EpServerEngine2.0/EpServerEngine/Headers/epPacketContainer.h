@@ -43,14 +43,19 @@ Sang Yong Yoon <flyingshiri@gmail.com>
 #define __EP_PACKET_CONTAINER_H__
 
 #include "epServerEngine.h"
+#include "epPacketPool.h"
+#include "epServerLockPolicy.h"
 
 namespace epse
 {
 	/*! 
 	@class PacketContainer epPacketContainer.h
 	@brief A class for Packet Container with variable length array.
+	@remark LockType is the lock policy of the container. By default, the lock policy given to the constructor selects the lock,
+	        which is the compile-time lock of EP_LOCK_POLICY without the allocation, or the runtime lock for the other lock policies.<br/>
+	        ServerNoLock, ServerCriticalSection or ServerMutex fixes the lock at compile time, ignoring the lock policy given.
 	*/
-	template<typename PacketStruct, typename ArrayType=char>
+	template<typename PacketStruct, typename ArrayType=char, typename LockType=ServerPolicyLock<epl::EP_LOCK_POLICY> >
 	class PacketContainer
 	{
 	public:
@@ -228,7 +233,7 @@ namespace epse
 		/// flag whether memory is allocated in this object or now
 		bool m_isAllocated;
 		/// lock
-		epl::BaseLock *m_packetContainerLock;
+		mutable LockType m_packetContainerLock;
 		/// Lock Policy
 		epl::LockPolicy m_lockPolicy;
 	};
@@ -236,12 +241,12 @@ namespace epse
 
 
 
-	template<typename PacketStruct, typename ArrayType>
-	PacketContainer<PacketStruct,ArrayType>::PacketContainer(unsigned int arraySize, bool shouldAllocate, epl::LockPolicy lockPolicyType)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	PacketContainer<PacketStruct,ArrayType,LockType>::PacketContainer(unsigned int arraySize, bool shouldAllocate, epl::LockPolicy lockPolicyType):m_packetContainerLock(lockPolicyType)
 	{
 		if(shouldAllocate)
 		{
-			m_packetContainer=reinterpret_cast<PacketContainerStruct*>(EP_Malloc(sizeof(PacketContainerStruct) + (arraySize*sizeof(ArrayType)) ));
+			m_packetContainer=reinterpret_cast<PacketContainerStruct*>(PACKET_POOL_INSTANCE.Allocate(sizeof(PacketContainerStruct) + (arraySize*sizeof(ArrayType)) ));
 			EP_ASSERT(m_packetContainer);
 			m_length=arraySize;
 		}
@@ -252,29 +257,14 @@ namespace epse
 		}
 		m_isAllocated=shouldAllocate;
 		m_lockPolicy=lockPolicyType;
-		switch(lockPolicyType)
-		{
-		case epl::LOCK_POLICY_CRITICALSECTION:
-			m_packetContainerLock=EP_NEW epl::CriticalSectionEx();
-			break;
-		case epl::LOCK_POLICY_MUTEX:
-			m_packetContainerLock=EP_NEW epl::Mutex();
-			break;
-		case epl::LOCK_POLICY_NONE:
-			m_packetContainerLock=EP_NEW epl::NoLock();
-			break;
-		default:
-			m_packetContainerLock=NULL;
-			break;
-		}
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	PacketContainer<PacketStruct,ArrayType>::PacketContainer(const PacketStruct & packet, unsigned int arraySize, bool shouldAllocate, epl::LockPolicy lockPolicyType)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	PacketContainer<PacketStruct,ArrayType,LockType>::PacketContainer(const PacketStruct & packet, unsigned int arraySize, bool shouldAllocate, epl::LockPolicy lockPolicyType):m_packetContainerLock(lockPolicyType)
 	{
 		if(shouldAllocate)
 		{
-			m_packetContainer=reinterpret_cast<PacketContainerStruct*>( EP_Malloc(sizeof(PacketContainerStruct) + (arraySize*sizeof(ArrayType)) ) );
+			m_packetContainer=reinterpret_cast<PacketContainerStruct*>( PACKET_POOL_INSTANCE.Allocate(sizeof(PacketContainerStruct) + (arraySize*sizeof(ArrayType)) ) );
 			EP_ASSERT(m_packetContainer);
 			epl::System::Memcpy(m_packetContainer,&packet,sizeof(PacketContainerStruct) + (arraySize*sizeof(ArrayType)));
 			m_length=arraySize;
@@ -286,25 +276,10 @@ namespace epse
 		}
 		m_isAllocated=shouldAllocate;
 		m_lockPolicy=lockPolicyType;
-		switch(lockPolicyType)
-		{
-		case epl::LOCK_POLICY_CRITICALSECTION:
-			m_packetContainerLock=EP_NEW epl::CriticalSectionEx();
-			break;
-		case epl::LOCK_POLICY_MUTEX:
-			m_packetContainerLock=EP_NEW epl::Mutex();
-			break;
-		case epl::LOCK_POLICY_NONE:
-			m_packetContainerLock=EP_NEW epl::NoLock();
-			break;
-		default:
-			m_packetContainerLock=NULL;
-			break;
-		}
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	PacketContainer<PacketStruct,ArrayType>::PacketContainer(const void * rawData, unsigned int byteSize, bool shouldAllocate, epl::LockPolicy lockPolicyType)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	PacketContainer<PacketStruct,ArrayType,LockType>::PacketContainer(const void * rawData, unsigned int byteSize, bool shouldAllocate, epl::LockPolicy lockPolicyType):m_packetContainerLock(lockPolicyType)
 	{
 
 
@@ -318,7 +293,7 @@ namespace epse
 
 		if(m_isAllocated)
 		{
-			m_packetContainer=reinterpret_cast<PacketContainerStruct*>( EP_Malloc(byteSize) );
+			m_packetContainer=reinterpret_cast<PacketContainerStruct*>( PACKET_POOL_INSTANCE.Allocate(byteSize) );
 			EP_ASSERT(m_packetContainer);
 			epl::System::Memcpy(m_packetContainer,rawData,byteSize);
 			m_length=(byteSize-sizeof(PacketContainerStruct))/sizeof(ArrayType);
@@ -329,47 +304,17 @@ namespace epse
 			m_length=(byteSize-sizeof(PacketContainerStruct))/sizeof(ArrayType);
 		}
 		m_lockPolicy=lockPolicyType;
-		switch(lockPolicyType)
-		{
-		case epl::LOCK_POLICY_CRITICALSECTION:
-			m_packetContainerLock=EP_NEW epl::CriticalSectionEx();
-			break;
-		case epl::LOCK_POLICY_MUTEX:
-			m_packetContainerLock=EP_NEW epl::Mutex();
-			break;
-		case epl::LOCK_POLICY_NONE:
-			m_packetContainerLock=EP_NEW epl::NoLock();
-			break;
-		default:
-			m_packetContainerLock=NULL;
-			break;
-		}
 	}
 
 
-	template<typename PacketStruct, typename ArrayType>
-	PacketContainer<PacketStruct,ArrayType>::PacketContainer(const PacketContainer<PacketStruct,ArrayType>& orig)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	PacketContainer<PacketStruct,ArrayType,LockType>::PacketContainer(const PacketContainer<PacketStruct,ArrayType,LockType>& orig):m_packetContainerLock(orig.m_lockPolicy)
 	{	
 		m_lockPolicy=orig.m_lockPolicy;
-		switch(m_lockPolicy)
-		{
-		case epl::LOCK_POLICY_CRITICALSECTION:
-			m_packetContainerLock=EP_NEW epl::CriticalSectionEx();
-			break;
-		case epl::LOCK_POLICY_MUTEX:
-			m_packetContainerLock=EP_NEW epl::Mutex();
-			break;
-		case epl::LOCK_POLICY_NONE:
-			m_packetContainerLock=EP_NEW epl::NoLock();
-			break;
-		default:
-			m_packetContainerLock=NULL;
-			break;
-		}
-		LockObj lock(orig.m_packetContainerLock);
+		ServerLockObj<LockType> lock(orig.m_packetContainerLock);
 		if(orig.m_isAllocated)
 		{
-			m_packetContainer=reinterpret_cast<PacketContainerStruct*>( EP_Malloc(sizeof(PacketContainerStruct) + (orig.m_length*sizeof(ArrayType)) ) );
+			m_packetContainer=reinterpret_cast<PacketContainerStruct*>( PACKET_POOL_INSTANCE.Allocate(sizeof(PacketContainerStruct) + (orig.m_length*sizeof(ArrayType)) ) );
 			EP_ASSERT(m_packetContainer);
 			m_packetContainer->m_packet=orig.m_packetContainer->m_packet;
 			m_length=orig.m_length;
@@ -386,43 +331,40 @@ namespace epse
 		m_isAllocated=orig.m_isAllocated;
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	PacketContainer<PacketStruct,ArrayType>::~PacketContainer()
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	PacketContainer<PacketStruct,ArrayType,LockType>::~PacketContainer()
 	{
-		m_packetContainerLock->Lock();
+		m_packetContainerLock.Lock();
 		if(m_isAllocated && m_packetContainer)
-			EP_Free(m_packetContainer);	
+			PACKET_POOL_INSTANCE.Free(m_packetContainer);	
 		m_packetContainer=NULL;
-		m_packetContainerLock->Unlock();
-		if(m_packetContainerLock)
-			EP_DELETE m_packetContainerLock;
-		m_packetContainerLock=NULL;
+		m_packetContainerLock.Unlock();
 	}
 	
 
-	template<typename PacketStruct, typename ArrayType>
-	PacketStruct *PacketContainer<PacketStruct,ArrayType>::GetPacketPtr() const
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	PacketStruct *PacketContainer<PacketStruct,ArrayType,LockType>::GetPacketPtr() const
 	{
 		return reinterpret_cast<PacketStruct*>(m_packetContainer);
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	bool PacketContainer<PacketStruct,ArrayType>::IsAllocated() const
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	bool PacketContainer<PacketStruct,ArrayType,LockType>::IsAllocated() const
 	{
 		return m_isAllocated;
 	}
 	
-	template<typename PacketStruct, typename ArrayType>
-	void PacketContainer<PacketStruct,ArrayType>::SetPacket(const PacketStruct & packet, unsigned int arraySize)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	void PacketContainer<PacketStruct,ArrayType,LockType>::SetPacket(const PacketStruct & packet, unsigned int arraySize)
 	{
-		epl::LockObj lock(m_packetContainerLock);
+		ServerLockObj<LockType> lock(m_packetContainerLock);
 		if(m_isAllocated && m_packetContainer)
-			EP_Free(m_packetContainer);
+			PACKET_POOL_INSTANCE.Free(m_packetContainer);
 		m_packetContainer=NULL;
 
 		if(m_isAllocated)
 		{
-			m_packetContainer=reinterpret_cast<PacketContainerStruct*>( EP_Malloc(sizeof(PacketContainerStruct) + (arraySize*sizeof(ArrayType)) ) );
+			m_packetContainer=reinterpret_cast<PacketContainerStruct*>( PACKET_POOL_INSTANCE.Allocate(sizeof(PacketContainerStruct) + (arraySize*sizeof(ArrayType)) ) );
 			EP_ASSERT(m_packetContainer);
 			epl::System::Memcpy(m_packetContainer,&packet,sizeof(PacketContainerStruct) + (arraySize*sizeof(ArrayType)));
 			m_length=arraySize;
@@ -434,10 +376,10 @@ namespace epse
 		}
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	bool PacketContainer<PacketStruct,ArrayType>::SetPacket(const void * rawData, unsigned int byteSize)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	bool PacketContainer<PacketStruct,ArrayType,LockType>::SetPacket(const void * rawData, unsigned int byteSize)
 	{
-		epl::LockObj lock(m_packetContainerLock);
+		ServerLockObj<LockType> lock(m_packetContainerLock);
 		if(byteSize<sizeof(PacketStruct))
 		{
 			EP_ASSERT_EXPR(byteSize>=sizeof(PacketStruct),_T("byteSize is smaller than PacketStruct size.\r\nbyteSize must be greater than sizeof(PacketStruct)=%d.\r\nbyteSize = %d\r\n"),sizeof(PacketStruct),byteSize);
@@ -445,12 +387,12 @@ namespace epse
 
 
 		if(m_isAllocated && m_packetContainer)
-			EP_Free(m_packetContainer);
+			PACKET_POOL_INSTANCE.Free(m_packetContainer);
 		m_packetContainer=NULL;
 
 		if(m_isAllocated)
 		{
-			m_packetContainer=reinterpret_cast<PacketContainerStruct*>( EP_Malloc(byteSize) );
+			m_packetContainer=reinterpret_cast<PacketContainerStruct*>( PACKET_POOL_INSTANCE.Allocate(byteSize) );
 			EP_ASSERT(m_packetContainer);
 			epl::System::Memcpy(m_packetContainer,rawData,byteSize);
 			m_length=(byteSize-sizeof(PacketContainerStruct))/sizeof(ArrayType);
@@ -463,18 +405,18 @@ namespace epse
 		return true;
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	ArrayType* PacketContainer<PacketStruct,ArrayType>::GetArray() const
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	ArrayType* PacketContainer<PacketStruct,ArrayType,LockType>::GetArray() const
 	{
 		if(m_packetContainer && m_length>0)
 			return m_packetContainer->m_array;
 		return NULL;
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	bool PacketContainer<PacketStruct,ArrayType>::SetArray(const ArrayType *arr,unsigned int arraySize, unsigned int offset)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	bool PacketContainer<PacketStruct,ArrayType,LockType>::SetArray(const ArrayType *arr,unsigned int arraySize, unsigned int offset)
 	{
-		epl::LockObj lock(m_packetContainerLock);
+		ServerLockObj<LockType> lock(m_packetContainerLock);
 		if(m_isAllocated)
 		{
 			if(m_length<arraySize+offset)
@@ -502,76 +444,57 @@ namespace epse
 		}
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	unsigned int PacketContainer<PacketStruct,ArrayType>::GetArrayLength() const
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	unsigned int PacketContainer<PacketStruct,ArrayType,LockType>::GetArrayLength() const
 	{
 		return m_length;
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	unsigned int PacketContainer<PacketStruct,ArrayType>::GetPacketByteSize() const
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	unsigned int PacketContainer<PacketStruct,ArrayType,LockType>::GetPacketByteSize() const
 	{
 		return (sizeof(PacketStruct)+(sizeof(ArrayType)*m_length));
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	bool PacketContainer<PacketStruct,ArrayType>::SetArraySize(unsigned int arrSize)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	bool PacketContainer<PacketStruct,ArrayType,LockType>::SetArraySize(unsigned int arrSize)
 	{
-		epl::LockObj lock(m_packetContainerLock);
+		ServerLockObj<LockType> lock(m_packetContainerLock);
 		return setArraySize(arrSize);
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	ArrayType & PacketContainer<PacketStruct,ArrayType>::operator[](unsigned int index)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	ArrayType & PacketContainer<PacketStruct,ArrayType,LockType>::operator[](unsigned int index)
 	{
 		EP_ASSERT_EXPR(m_packetContainer,_T("Actual packet is NULL."));
 		EP_ASSERT(index<m_length);
 		return m_packetContainer->m_array[index];
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	const ArrayType & PacketContainer<PacketStruct,ArrayType>::operator[](unsigned int index) const
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	const ArrayType & PacketContainer<PacketStruct,ArrayType,LockType>::operator[](unsigned int index) const
 	{
 		EP_ASSERT_EXPR(m_packetContainer,_T("Actual packet is NULL."));
 		EP_ASSERT(index<m_length);
 		return m_packetContainer->m_array[index];
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	PacketContainer<PacketStruct,ArrayType>& PacketContainer<PacketStruct,ArrayType>::operator =(const PacketContainer<PacketStruct,ArrayType>& b)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	PacketContainer<PacketStruct,ArrayType,LockType>& PacketContainer<PacketStruct,ArrayType,LockType>::operator =(const PacketContainer<PacketStruct,ArrayType,LockType>& b)
 	{
 		if(this!=&b)
 		{
-			m_packetContainerLock->Lock();
+			m_packetContainerLock.Lock();
 			if(m_isAllocated && m_packetContainer)
-				EP_Free(m_packetContainer);	
+				PACKET_POOL_INSTANCE.Free(m_packetContainer);	
 			m_packetContainer=NULL;
-			m_packetContainerLock->Unlock();
-			if(m_packetContainerLock)
-				EP_DELETE m_packetContainerLock;
-			m_packetContainerLock=NULL;
+			m_packetContainerLock.Unlock();
 
-			
-			m_lockPolicy=b.m_lockPolicy;
-			switch(m_lockPolicy)
-			{
-			case epl::LOCK_POLICY_CRITICALSECTION:
-				m_packetContainerLock=EP_NEW epl::CriticalSectionEx();
-				break;
-			case epl::LOCK_POLICY_MUTEX:
-				m_packetContainerLock=EP_NEW epl::Mutex();
-				break;
-			case epl::LOCK_POLICY_NONE:
-				m_packetContainerLock=EP_NEW epl::NoLock();
-				break;
-			default:
-				m_packetContainerLock=NULL;
-				break;
-			}
-			LockObj lock(b.m_packetContainerLock);
+			// the lock of this object is kept, so the lock policy of this object does not change.
+			ServerLockObj<LockType> lock(b.m_packetContainerLock);
 			if(b.m_isAllocated)
 			{
-				m_packetContainer=reinterpret_cast<PacketContainerStruct*>( EP_Malloc(sizeof(PacketContainerStruct) + (b.m_length*sizeof(ArrayType)) ) );
+				m_packetContainer=reinterpret_cast<PacketContainerStruct*>( PACKET_POOL_INSTANCE.Allocate(sizeof(PacketContainerStruct) + (b.m_length*sizeof(ArrayType)) ) );
 				EP_ASSERT(m_packetContainer);
 				m_packetContainer->m_packet=b.m_packetContainer->m_packet;
 				m_length=b.m_length;
@@ -590,10 +513,10 @@ namespace epse
 		return *this;
 	}
 
-	template<typename PacketStruct, typename ArrayType>
-	PacketContainer<PacketStruct,ArrayType>& PacketContainer<PacketStruct,ArrayType>::operator =(const PacketStruct& b)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	PacketContainer<PacketStruct,ArrayType,LockType>& PacketContainer<PacketStruct,ArrayType,LockType>::operator =(const PacketStruct& b)
 	{
-		epl::LockObj lock(m_packetContainerLock);
+		ServerLockObj<LockType> lock(m_packetContainerLock);
 		if(m_isAllocated)
 			m_packetContainer->m_packet=b;
 		else
@@ -602,8 +525,8 @@ namespace epse
 	}
 	
 
-	template<typename PacketStruct, typename ArrayType>
-	bool PacketContainer<PacketStruct,ArrayType>::setArraySize(unsigned int arrSize)
+	template<typename PacketStruct, typename ArrayType, typename LockType>
+	bool PacketContainer<PacketStruct,ArrayType,LockType>::setArraySize(unsigned int arrSize)
 	{
 		if(m_isAllocated)
 		{
@@ -615,7 +538,7 @@ namespace epse
 				EP_ASSERT_EXPR(arrSize>=m_length,_T("Given size = %d is smaller than the original = %d.\r\nNew array size must be (greater than/equal to) original array size."),arrSize,m_length);
 			}
 			
-			m_packetContainer=reinterpret_cast<PacketContainerStruct*>(EP_Realloc(m_packetContainer,sizeof(PacketContainerStruct)+ (arrSize*sizeof(ArrayType))));
+			m_packetContainer=reinterpret_cast<PacketContainerStruct*>(PACKET_POOL_INSTANCE.Reallocate(m_packetContainer,sizeof(PacketContainerStruct)+ (arrSize*sizeof(ArrayType))));
 			epl::System::Memset(((char*)m_packetContainer)+sizeof(PacketContainerStruct)+ (m_length*sizeof(ArrayType)),0,((arrSize-m_length)*sizeof(ArrayType)));
 			EP_ASSERT(m_packetContainer);
 			m_length=arrSize;
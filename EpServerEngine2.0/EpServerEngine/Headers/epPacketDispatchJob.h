@@ -0,0 +1,125 @@
+/*! 
+@file epPacketDispatchJob.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Packet Dispatch Job Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Packet Dispatch Job.
+
+*/
+#ifndef __EP_PACKET_DISPATCH_JOB_H__
+#define __EP_PACKET_DISPATCH_JOB_H__
+
+#include "epServerEngine.h"
+#include "epPacket.h"
+#include "epBaseServerObject.h"
+#include "epPacketDispatcher.h"
+
+namespace epse{
+	class PacketDispatchQueue;
+
+	/*! 
+	@class PacketDispatchJob epPacketDispatchJob.h
+	@brief A class for Packet Dispatch Job.
+	*/
+	class EP_SERVER_ENGINE PacketDispatchJob:public BaseJob{
+
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Job
+		@param[in] owner the owner object of the packet
+		@param[in] delegateObj the delegate object to process the packet
+		@param[in] packet the received packet
+		@param[in] dispatchQueue the dispatch queue to notify when the job is done
+		@param[in] priority the priority of the job
+		@param[in] lockPolicyType The lock policy
+		*/
+		PacketDispatchJob(BaseServerObject *owner=NULL,PacketDispatchDelegate *delegateObj=NULL,Packet *packet=NULL,PacketDispatchQueue *dispatchQueue=NULL,Priority priority=PRIORITY_NORMAL,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Job
+		*/
+		virtual ~PacketDispatchJob();
+
+		/*!
+		Get the received packet
+		@return the received packet
+		*/
+		Packet *GetPacket();
+
+		/*!
+		Get the delegate object
+		@return the delegate object
+		*/
+		PacketDispatchDelegate *GetDelegate();
+
+		/*!
+		Get the dispatch queue
+		@return the dispatch queue
+		*/
+		PacketDispatchQueue *GetDispatchQueue();
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Job
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		PacketDispatchJob(const PacketDispatchJob& b):BaseJob(b)
+		{}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		PacketDispatchJob & operator=(const PacketDispatchJob&b){return *this;}
+
+	private:
+		/// owner object
+		BaseServerObject *m_owner;
+		/// delegate object
+		PacketDispatchDelegate *m_delegate;
+		/// received packet
+		Packet *m_packet;
+		/// dispatch queue
+		PacketDispatchQueue *m_dispatchQueue;
+	};
+}
+
+#endif //__EP_PACKET_DISPATCH_JOB_H__
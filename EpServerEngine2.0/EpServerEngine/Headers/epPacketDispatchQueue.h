@@ -0,0 +1,184 @@
+/*! 
+@file epPacketDispatchQueue.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Packet Dispatch Queue Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Packet Dispatch Queue.
+
+*/
+#ifndef __EP_PACKET_DISPATCH_QUEUE_H__
+#define __EP_PACKET_DISPATCH_QUEUE_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include "epPacket.h"
+#include "epBaseServerObject.h"
+#include "epPacketDispatcher.h"
+#include "epPacketDispatchJob.h"
+#include <queue>
+
+using namespace std;
+
+namespace epse{
+
+	/*! 
+	@class PacketDispatchQueue epPacketDispatchQueue.h
+	@brief A class for the per-connection Packet Dispatch Queue.
+	*/
+	class EP_SERVER_ENGINE PacketDispatchQueue{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Queue
+		@param[in] lockPolicyType The lock policy
+		*/
+		PacketDispatchQueue(epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Queue
+		*/
+		virtual ~PacketDispatchQueue();
+
+		/*!
+		Set the dispatcher to process the packets with
+		@param[in] dispatcher the dispatcher
+		@param[in] isOrdered the flag whether the packets are processed in the received order
+		*/
+		void SetDispatcher(PacketDispatcher *dispatcher,bool isOrdered=false);
+
+		/*!
+		Get the dispatcher
+		@return the dispatcher
+		*/
+		PacketDispatcher *GetDispatcher() const;
+
+		/*!
+		Get the flag whether the packets are processed in the received order
+		@return true if the packets are processed in the received order otherwise false
+		*/
+		bool GetIsOrdered() const;
+
+		/*!
+		Dispatch the given packet to the worker threads
+		@param[in] owner the owner object of the packet
+		@param[in] delegateObj the delegate object to process the packet
+		@param[in] packet the received packet
+		@param[in] maximumPendingCount the maximum number of packets which are not processed yet
+		@return true if the packet is dispatched otherwise false
+		@remark this function blocks while the number of the pending packets reaches maximumPendingCount.
+		*/
+		bool Push(BaseServerObject *owner,PacketDispatchDelegate *delegateObj,Packet *packet,unsigned int maximumPendingCount=PROCESSOR_LIMIT_INFINITE);
+
+		/*!
+		Get the number of packets which are not processed yet
+		@return the number of pending packets
+		*/
+		unsigned int GetPendingCount() const;
+
+		/*!
+		Drop the packets which are not handed to the worker threads yet
+		*/
+		void Clear();
+
+	private:
+		friend class PacketDispatchProcessor;
+
+		/*!
+		Hand the next packet to the worker threads if any
+		@param[in] delegateObj the delegate object of the processed packet
+		*/
+		void completeJob(PacketDispatchDelegate *delegateObj);
+
+		/*!
+		Count the processed packet out and get the next job for the ordered dispatch
+		@param[in] delegateObj the delegate object of the processed packet
+		@return the next job to dispatch if any, otherwise NULL
+		*/
+		PacketDispatchJob *finishJob(PacketDispatchDelegate *delegateObj);
+
+		/*!
+		Push the given job to the dispatcher
+		@param[in] job the job to push
+		@remark if the dispatcher has no worker thread, the job is processed in the calling thread.<br/>
+		        The reference of the given job is released.
+		*/
+		void dispatchJob(PacketDispatchJob *job);
+
+		/*!
+		Default Copy Constructor
+
+		Initializes the Queue
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		PacketDispatchQueue(const PacketDispatchQueue& b)
+		{}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		PacketDispatchQueue & operator=(const PacketDispatchQueue&b){return *this;}
+
+	private:
+		/// dispatcher
+		PacketDispatcher *m_dispatcher;
+
+		/// flag whether the packets are processed in the received order
+		bool m_isOrdered;
+
+		/// flag whether the job is handed to the worker threads for the ordered dispatch
+		bool m_isRunning;
+
+		/// number of packets which are not processed yet
+		unsigned int m_pendingCount;
+
+		/// jobs waiting for the previous job for the ordered dispatch
+		queue<PacketDispatchJob*> m_jobQueue;
+
+		/// event raised when the pending count decreased
+		epl::EventEx m_pendingEvent;
+
+		/// queue lock
+		epl::BaseLock *m_queueLock;
+
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+	};
+}
+
+#endif //__EP_PACKET_DISPATCH_QUEUE_H__
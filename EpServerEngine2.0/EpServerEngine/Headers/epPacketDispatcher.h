@@ -0,0 +1,152 @@
+/*! 
+@file epPacketDispatcher.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Packet Dispatcher Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Packet Dispatcher.
+
+The Packet Dispatcher is a thin wrapper of JobScheduler, so the dispatched packets
+are kept in the priority queue of the scheduler instead of the queue of each worker thread.
+
+*/
+#ifndef __EP_PACKET_DISPATCHER_H__
+#define __EP_PACKET_DISPATCHER_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include "epPacket.h"
+#include "epJobScheduler.h"
+
+using namespace std;
+
+namespace epse{
+
+	/*! 
+	@class PacketDispatchDelegate epPacketDispatcher.h
+	@brief A delegate class for Packet Dispatcher.
+	*/
+	class EP_SERVER_ENGINE PacketDispatchDelegate{
+	public:
+		/*!
+		Call Back Function when the dispatched packet is processed by the worker thread.
+		@param[in] packet the received packet
+		*/
+		virtual void OnPacketDispatched(Packet *packet)=0;
+
+		/*!
+		Call Back Function when the processed packet is no longer counted as pending.
+		*/
+		virtual void OnPacketCompleted(){}
+	};
+
+	/*! 
+	@class PacketDispatcher epPacketDispatcher.h
+	@brief A class for Packet Dispatcher which processes the received packets with the shared worker threads.
+	*/
+	class EP_SERVER_ENGINE PacketDispatcher{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Dispatcher
+		@param[in] waitTimeMilliSec wait time for the worker threads to terminate
+		@param[in] lockPolicyType The lock policy
+		*/
+		PacketDispatcher(unsigned int waitTimeMilliSec=WAITTIME_INIFINITE,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Dispatcher
+		*/
+		virtual ~PacketDispatcher();
+
+		/*!
+		Start the worker threads
+		@param[in] workerThreadCount the number of worker threads
+		@return true if successfully created otherwise false
+		@remark if workerThreadCount is 0, the number of the cores is used.
+		*/
+		bool Create(unsigned int workerThreadCount=0);
+
+		/*!
+		Terminate the worker threads
+		*/
+		void Close();
+
+		/*!
+		Get the number of worker threads
+		@return the number of worker threads
+		*/
+		unsigned int GetWorkerThreadCount() const;
+
+		/*!
+		Push the given job to the worker threads
+		@param[in] job the job to process
+		@return true if the job is pushed otherwise false
+		@remark if false is returned, the caller should process the job by itself.<br/>
+		        The job goes to the worker thread chosen by JobScheduler, in the order of its priority.
+		*/
+		bool Push(BaseJob *job);
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Dispatcher
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		PacketDispatcher(const PacketDispatcher& b)
+		{}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		PacketDispatcher & operator=(const PacketDispatcher&b){return *this;}
+
+	private:
+		/// job scheduler for the worker threads
+		JobScheduler m_jobScheduler;
+
+		/// wait time in millisecond for terminating thread
+		unsigned int m_waitTime;
+
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+	};
+}
+
+#endif //__EP_PACKET_DISPATCHER_H__
@@ -0,0 +1,249 @@
+/*! 
+@file epPacketPool.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Packet Pool Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Packet Pool.
+
+The Packet Pool caches the freed blocks by size class so that the packets,
+the packet containers and their locks reuse the memory instead of going to
+the heap for every message. The free lists are split into shards selected
+by the thread id, so the threads rarely contend on the same lock.
+A freed block goes back to the shard which allocated it.
+
+*/
+#ifndef __EP_PACKET_POOL_H__
+#define __EP_PACKET_POOL_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include "epServerLockPolicy.h"
+
+/*!
+@def PACKET_POOL_INSTANCE
+@brief The Packet Pool Instance
+
+Macro for the Packet Pool Instance.
+*/
+#define PACKET_POOL_INSTANCE epl::SingletonHolder<epse::PacketPool>::Instance()
+
+namespace epse{
+
+	/*! 
+	@struct PacketPoolStats epPacketPool.h
+	@brief A class for Packet Pool Statistics.
+	*/
+	struct EP_SERVER_ENGINE PacketPoolStats{
+		/// number of the allocations
+		unsigned long long allocateCount;
+		/// number of the allocations served from the cached blocks
+		unsigned long long hitCount;
+		/// number of the allocations served from the heap
+		unsigned long long missCount;
+		/// number of the blocks returned to the pool
+		unsigned long long freeCount;
+		/// byte size of the cached blocks
+		unsigned long long cachedByteSize;
+
+		/*!
+		Default Constructor
+
+		Initializes the Statistics
+		*/
+		PacketPoolStats()
+		{
+			allocateCount=0;
+			hitCount=0;
+			missCount=0;
+			freeCount=0;
+			cachedByteSize=0;
+		}
+
+		/*!
+		Return the ratio of the allocations served from the cached blocks
+		@return the hit rate between 0.0 and 1.0
+		*/
+		double GetHitRate() const
+		{
+			if(!allocateCount)
+				return 0.0;
+			return (double)hitCount/(double)allocateCount;
+		}
+	};
+
+	/*! 
+	@class PacketPool epPacketPool.h
+	@brief A class for Packet Pool.
+	*/
+	class EP_SERVER_ENGINE PacketPool{
+	public:
+		friend class epl::SingletonHolder<PacketPool>;
+
+		/*!
+		Allocate the block of the given byte size
+		@param[in] byteSize the byte size to allocate
+		@return the pointer to the block allocated
+		*/
+		void *Allocate(unsigned int byteSize);
+
+		/*!
+		Resize the block allocated by this pool
+		@param[in] block the block to resize (NULL to allocate the new block)
+		@param[in] byteSize the new byte size
+		@return the pointer to the block resized
+		@remark the contents are kept up to the smaller of the old and the new size.
+		*/
+		void *Reallocate(void *block,unsigned int byteSize);
+
+		/*!
+		Return the block allocated by this pool
+		@param[in] block the block to return
+		*/
+		void Free(void *block);
+
+		/*!
+		Create the lock of the given lock policy from the pool
+		@param[in] lockPolicyType the lock policy
+		@return the lock created, or NULL if the lock policy is unknown
+		*/
+		epl::BaseLock *CreateLock(epl::LockPolicy lockPolicyType);
+
+		/*!
+		Destroy the lock created by CreateLock
+		@param[in] lock the lock to destroy
+		*/
+		void DestroyLock(epl::BaseLock *lock);
+
+		/*!
+		Return the statistics of the pool
+		@return the statistics of the pool
+		*/
+		PacketPoolStats GetStats() const;
+
+		/*!
+		Release all the cached blocks to the heap
+		*/
+		void Clear();
+
+	private:
+		/*!
+		Default Constructor
+
+		Initializes the Pool
+		*/
+		PacketPool();
+
+		/*!
+		Default Destructor
+
+		Destroy the Pool
+		*/
+		~PacketPool();
+
+		/*!
+		Default Copy Constructor
+
+		Initializes the Pool
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		PacketPool(const PacketPool& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		PacketPool & operator=(const PacketPool&b){return *this;}
+
+		/*!
+		@union BlockHeader epPacketPool.h
+		@brief the header placed in front of every block.
+		*/
+		union BlockHeader{
+			struct{
+				/// next free block in the shard
+				BlockHeader *m_next;
+				/// size class of the block
+				unsigned short m_classIndex;
+				/// shard which allocated the block, and caches it when freed
+				unsigned short m_shardIndex;
+				/// byte size of the block excluding the header
+				unsigned int m_blockByteSize;
+			} m_info;
+			/// keeps the block aligned as the heap does
+			double m_align[2];
+		};
+
+		/*!
+		@struct PoolShard epPacketPool.h
+		@brief the free lists used by the threads mapped to the shard.
+		*/
+		struct PoolShard{
+			/// lock
+			mutable ServerCriticalSection m_lock;
+			/// free block list for each size class
+			BlockHeader *m_freeList[PACKET_POOL_CLASS_COUNT];
+			/// byte size of the cached blocks
+			unsigned int m_cachedByteSize;
+			/// statistics of the shard
+			PacketPoolStats m_stats;
+		};
+
+		/*!
+		Return the index of the shard for the calling thread
+		@return the index of the shard for the calling thread
+		*/
+		static unsigned int getShardIndex();
+
+		/*!
+		Return the size class of the given byte size
+		@param[in] byteSize the byte size
+		@return the size class, or PACKET_POOL_CLASS_COUNT if too large to cache
+		*/
+		static unsigned int getClassIndex(unsigned int byteSize);
+
+		/*!
+		Release the cached blocks of the shard to the heap
+		@param[in] shard the shard to release
+		@remark the caller must hold the lock of the shard.
+		*/
+		static void clearShard(PoolShard &shard);
+
+	private:
+		/// shards
+		PoolShard m_shards[PACKET_POOL_SHARD_COUNT];
+	};
+}
+
+#endif //__EP_PACKET_POOL_H__
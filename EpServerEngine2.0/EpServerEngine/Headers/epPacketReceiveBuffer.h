@@ -0,0 +1,145 @@
+/*! 
+@file epPacketReceiveBuffer.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Packet Receive Buffer Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Packet Receive Buffer.
+
+The Packet Receive Buffer is the per-connection buffer which the socket
+thread fills with a single recv call, and every complete packet in the
+received data is parsed out of it before the next recv call.
+
+*/
+#ifndef __EP_PACKET_RECEIVE_BUFFER_H__
+#define __EP_PACKET_RECEIVE_BUFFER_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include "epPacket.h"
+#include "epSocketHelper.h"
+
+namespace epse{
+
+	/*! 
+	@class PacketReceiveBuffer epPacketReceiveBuffer.h
+	@brief A class for Packet Receive Buffer.
+	@remark the owner must guard the buffer with its own lock.
+	*/
+	class EP_SERVER_ENGINE PacketReceiveBuffer{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Receive Buffer
+		@param[in] bufferByteSize the byte size of the buffer
+		*/
+		PacketReceiveBuffer(unsigned int bufferByteSize=RECEIVE_BUFFER_SIZE);
+
+		/*!
+		Default Destructor
+
+		Destroy the Receive Buffer
+		*/
+		virtual ~PacketReceiveBuffer();
+
+		/*!
+		Receive the data available from the socket with a single recv call
+		@param[in] socket the socket to receive from
+		@return received byte size, 0 if the connection is closed, and negative if failed
+		@remark Pop() must be called until it returns NULL before calling Fill() again.
+		*/
+		int Fill(SOCKET socket);
+
+		/*!
+		Return the next complete packet in the buffer
+		@return the packet received, or NULL if no complete packet is buffered
+		@remark the caller must call ReleaseObj() for the returned packet.
+		*/
+		Packet *Pop();
+
+		/*!
+		Return the byte size of the data which is not parsed yet
+		@return the byte size of the buffered data
+		*/
+		unsigned int GetDataByteSize() const;
+
+		/*!
+		Reset the buffer
+		*/
+		void Reset();
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Receive Buffer
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		PacketReceiveBuffer(const PacketReceiveBuffer& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		PacketReceiveBuffer & operator=(const PacketReceiveBuffer&b){return *this;}
+
+		/*!
+		Copy the buffered data into the packet being assembled
+		@return true if the packet is complete otherwise false
+		*/
+		bool fillPacket();
+
+	private:
+		/// buffer
+		char *m_buffer;
+
+		/// byte size of the buffer
+		unsigned int m_bufferByteSize;
+
+		/// offset of the data not parsed yet
+		unsigned int m_dataOffset;
+
+		/// byte size of the data not parsed yet
+		unsigned int m_dataByteSize;
+
+		/// packet larger than the buffer being assembled
+		Packet *m_packet;
+
+		/// received byte size of the packet being assembled
+		unsigned int m_packetOffset;
+	};
+}
+
+#endif //__EP_PACKET_RECEIVE_BUFFER_H__
@@ -80,6 +80,26 @@ namespace epse{
 		const TCHAR *port;
 		///The maximum possible number of client connection
 		unsigned int maximumConnectionCount;
+		/*!
+		Flag for the relay mode, which moves the bytes between the client and the forward server as they are
+		@remark for Proxy TCP Server Use Only!<br/>
+		        OnReceivedFromClient and OnReceivedFromForwardServer are not called in the relay mode.
+		*/
+		bool isRelay;
+		/*!
+		The maximum number of the idle connections to each forward server, kept for the next client
+		@remark 0 means the connection to forward server is not pooled.
+		@remark the connection is kept only if ProxyServerCallbackInterface::IsForwardServerClientReusable returns true.
+		@remark for Proxy TCP Server Use Only!
+		*/
+		unsigned int forwardPoolSize;
+		/*!
+		The number of the connections to each forward server, shared by the clients with the session ID
+		@remark 0 means the clients are not multiplexed. Otherwise forwardPoolSize is ignored.
+		@remark The forward server must read MultiplexHeader prefixed to each packet, and prefix it to the replies.
+		@remark for Proxy TCP Server Use Only!
+		*/
+		unsigned int forwardLinkCount;
 
 		/*!
 		Default Constructor
@@ -91,6 +111,9 @@ namespace epse{
 			callBackObj=NULL;
 			port=_T(DEFAULT_PORT);
 			maximumConnectionCount=CONNECTION_LIMIT_INFINITE;
+			isRelay=false;
+			forwardPoolSize=0;
+			forwardLinkCount=0;
 		}
 
 		/// Default Proxy Server Options
@@ -190,6 +213,7 @@ namespace epse{
 		@param[in] forwardServerClient the connected server for forwarding
 		@param[in] receivedPacket the received packet
 		@remark The default is just forwarding the packet to forward server.
+		@remark To keep the packet or a part of it after the call, copy or slice it with the constructor of Packet, which shares the memory without copying.
 		*/
 		virtual void OnReceivedFromClient(SocketInterface *clientSocket,ClientInterface *forwardServerClient, const Packet*receivedPacket)
 		{
@@ -203,6 +227,7 @@ namespace epse{
 		@param[in] forwardServerClient the forward server which the packet is received from
 		@param[in] receivedPacket the received packet
 		@remark The default is just forwarding the packet to the client.
+		@remark To keep the packet or a part of it after the call, copy or slice it with the constructor of Packet, which shares the memory without copying.
 		*/
 		virtual void OnReceivedFromForwardServer(SocketInterface *clientSocket,ClientInterface *forwardServerClient, const Packet*receivedPacket)
 		{
@@ -216,6 +241,19 @@ namespace epse{
 		*/
 		virtual void OnDisconnect(sockaddr sockAddr){}
 
+		/*!
+		Check if the connection to the forward server can be given to the next client.
+		@param[in] forwardServerClient the connection to the forward server of the disconnected client
+		@return true to keep the connection idle for the next client, false to disconnect it.
+		@remark called when the client is disconnected, only if the connection is pooled.
+		@remark The replies for the disconnected client may still be in flight, and the next client would receive them.
+		        Return true only at the protocol-level boundary, where every request of the client has been answered.
+		*/
+		virtual bool IsForwardServerClientReusable(ClientInterface *forwardServerClient)
+		{
+			return false;
+		}
+
 		/*!
 		Get the forward server info
 		@param[in] socketAddr the sockaddr of the client which tries to connect
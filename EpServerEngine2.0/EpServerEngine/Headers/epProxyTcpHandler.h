@@ -60,9 +60,12 @@ namespace epse{
 		@param[in] callBack the callback object
 		@param[in] forwardServerInfo the forward server info
 		@param[in] socket the client socket
+		@param[in] isRelay flag for the relay mode
+		@param[in] forwardClientPool the pool to get the client connected to forward server from, or NULL to connect its own
 		@param[in] lockPolicyType The lock policy
+		@remark in the relay mode, the forward server is connected by relay().
 		*/
-		ProxyTcpHandler(ProxyServerCallbackInterface *callBack,const ForwardServerInfo& forwardServerInfo, SocketInterface *socket, epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+		ProxyTcpHandler(ProxyServerCallbackInterface *callBack,const ForwardServerInfo& forwardServerInfo, SocketInterface *socket, bool isRelay=false, ForwardClientPool *forwardClientPool=NULL, epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
 
 
 		/*!
@@ -72,6 +75,29 @@ namespace epse{
 		*/
 		virtual ~ProxyTcpHandler();
 
+		/*!
+		Connect to the forward server and relay the bytes until the connection is closed
+		@param[in] forwardServerInfo the forward server info
+		@return true if the relay is closed gracefully otherwise false
+		@remark must be called on the thread of the client socket, before it starts receiving.<br/>
+		        The client socket is shut down on return, so its receive loop kills the connection.
+		*/
+		bool relay(const ForwardServerInfo& forwardServerInfo);
+
+		/*!
+		Connect to the forward server
+		@param[in] forwardServerInfo the forward server info
+		@return the connected socket if successful otherwise INVALID_SOCKET
+		*/
+		SOCKET connectForwardServer(const ForwardServerInfo& forwardServerInfo);
+
+		/*!
+		The client connected to forward server is disconnected.
+		@param[in] client the client, disconnected.
+		@remark the session of the shared link only shuts down the client socket,
+		        so the link does not wait for the client socket to be killed.
+		*/
+		void OnDisconnect(ClientInterface *client);
 
 	};
 }
@@ -0,0 +1,191 @@
+/*! 
+@file epSendQueue.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Send Queue Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for the Per-Connection Send Queue.
+
+*/
+#ifndef __EP_SEND_QUEUE_H__
+#define __EP_SEND_QUEUE_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include "epPacket.h"
+#include "epServerInterfaces.h"
+#include <deque>
+#include <vector>
+
+using namespace std;
+
+namespace epse{
+
+	/*! 
+	@class SendQueue epSendQueue.h
+	@brief A class for the per-connection outbound queue bounded by the byte watermarks.
+	*/
+	class EP_SERVER_ENGINE SendQueue{
+	public:
+		/// Enumerator for the result of Push
+		typedef enum _pushResult{
+			/// the packet is queued
+			PUSH_RESULT_QUEUED=0,
+			/// the packet is dropped since the queue is full
+			PUSH_RESULT_DROPPED,
+			/// the packet is dropped and the connection should be killed
+			PUSH_RESULT_DISCONNECT,
+		}PushResult;
+
+		/*!
+		@struct SendUnit epSendQueue.h
+		@brief the queued packet with its completion notification.
+		*/
+		struct SendUnit{
+			/// the packet to send
+			Packet *m_packet;
+			/// the event to set when sent
+			EventEx *m_completionEvent;
+			/// the object to callback when sent
+			ServerCallbackInterface *m_callBackObj;
+		};
+
+		/*!
+		Default Constructor
+
+		Initializes the Queue
+		@param[in] lockPolicyType The lock policy
+		*/
+		SendQueue(epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Queue
+		*/
+		virtual ~SendQueue();
+
+		/*!
+		Set the watermarks and the policy for the slow reader
+		@param[in] highWatermark the queued byte size over which the policy is applied, or SEND_QUEUE_WATERMARK_INFINITE
+		@param[in] lowWatermark the queued byte size at which the queue is writable again
+		@param[in] policy the policy applied over the high watermark
+		*/
+		void SetWatermark(unsigned int highWatermark,unsigned int lowWatermark,SendQueuePolicy policy);
+
+		/*!
+		Push the packet to the end of the queue
+		@param[in] packet the packet to send
+		@param[in] completionEvent the event to set when sent
+		@param[in] callBackObj the object to callback when sent
+		@param[in] waitTimeMilliSec wait time in millisecond for SEND_QUEUE_POLICY_BLOCK
+		@param[out] retShouldFlush set to true if the caller should start the flush
+		@return the result of the push
+		@remark a packet is always queued into the empty queue, however large it is.
+		*/
+		PushResult Push(Packet *packet,EventEx *completionEvent,ServerCallbackInterface *callBackObj,unsigned int waitTimeMilliSec,bool &retShouldFlush);
+
+		/*!
+		Get the packets at the front of the queue without removing them
+		@param[out] retUnitList the packets at the front
+		@param[in] maxCount the maximum number of the packets to get
+		@remark only the flushing thread may call this.
+		*/
+		void Front(vector<SendUnit> &retUnitList,unsigned int maxCount);
+
+		/*!
+		Remove the sent packets from the front of the queue
+		@param[in] count the number of the packets sent
+		@param[out] retIsWritable set to true if the queue dropped to the low watermark from over the high watermark
+		@param[out] retIsDrained set to true if the queue became empty
+		@return true if the flush should go on, false if the queue is empty and the flush is over
+		@remark only the flushing thread may call this.
+		*/
+		bool Pop(unsigned int count,bool &retIsWritable,bool &retIsDrained);
+
+		/*!
+		Get the queued byte size
+		@return the queued byte size
+		*/
+		unsigned int GetByteSize() const;
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Queue
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		SendQueue(const SendQueue& b){EP_ASSERT(0);}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		SendQueue & operator=(const SendQueue&b){EP_ASSERT(0);return *this;}
+
+	private:
+		/// queued packets
+		deque<SendUnit> m_unitList;
+
+		/// queued byte size
+		unsigned int m_byteSize;
+
+		/// high watermark
+		unsigned int m_highWatermark;
+
+		/// low watermark
+		unsigned int m_lowWatermark;
+
+		/// policy over the high watermark
+		SendQueuePolicy m_policy;
+
+		/// flag whether the queue went over the high watermark
+		bool m_isOverHighWatermark;
+
+		/// flag whether the flush is in flight
+		bool m_isFlushing;
+
+		/// queue lock
+		epl::BaseLock *m_queueLock;
+
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+
+		/// event raised while the queue is writable
+		epl::EventEx m_writableEvent;
+	};
+}
+
+#endif //__EP_SEND_QUEUE_H__
@@ -0,0 +1,124 @@
+/*! 
+@file epServerAcceptor.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Server Acceptor Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for the Server Acceptor.
+
+*/
+#ifndef __EP_SERVER_ACCEPTOR_H__
+#define __EP_SERVER_ACCEPTOR_H__
+
+#include "epServerEngine.h"
+#include "epSocketHelper.h"
+
+namespace epse{
+
+	class BaseServer;
+
+	/*! 
+	@class ServerAcceptor epServerAcceptor.h
+	@brief A class for the additional accept/receive loop thread of the server.
+	*/
+	class EP_SERVER_ENGINE ServerAcceptor:public epl::Thread{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Acceptor
+		@param[in] owner the server which runs the listening loop
+		@param[in] listenSocket the listening socket of this acceptor
+		@param[in] isOwnSocket flag whether the listening socket is owned by this acceptor
+		@param[in] coreIndex the index of the core to run on
+		@param[in] lockPolicyType The lock policy
+		*/
+		ServerAcceptor(BaseServer *owner,SOCKET listenSocket,bool isOwnSocket,unsigned int coreIndex,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Acceptor
+		*/
+		virtual ~ServerAcceptor();
+
+		/*!
+		Close the listening socket if owned and wait for the loop to end
+		@param[in] waitTimeMilliSec the wait time in millisecond for terminating
+		*/
+		void Close(unsigned int waitTimeMilliSec);
+
+		/*!
+		Run the calling thread on the given core only
+		@param[in] coreIndex the index of the core, which wraps around the number of the cores
+		@return true if successful otherwise false
+		*/
+		static bool SetCurrentThreadAffinity(unsigned int coreIndex);
+
+	private:
+		/*!
+		Listening Loop Function
+		*/
+		virtual void execute();
+
+		/*!
+		Default Copy Constructor
+
+		Initializes the Acceptor
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		ServerAcceptor(const ServerAcceptor& b):Thread(b){EP_ASSERT(0);}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		ServerAcceptor & operator=(const ServerAcceptor&b){EP_ASSERT(0);return *this;}
+
+	private:
+		/// the server which runs the listening loop
+		BaseServer *m_owner;
+
+		/// listening socket
+		SOCKET m_listenSocket;
+
+		/// flag whether the listening socket is owned by this acceptor
+		bool m_isOwnSocket;
+
+		/// index of the core to run on
+		unsigned int m_coreIndex;
+	};
+}
+
+#endif //__EP_SERVER_ACCEPTOR_H__
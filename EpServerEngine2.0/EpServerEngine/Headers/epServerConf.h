@@ -74,6 +74,215 @@ namespace epse{
 	*/
 	#define PROCESSOR_LIMIT_INFINITE 0
 
+	/*!
+	@def IOCP_RECEIVE_BUFFER_SIZE
+	@brief byte size of the per-connection receive buffer
+
+	Macro for the byte size of the per-connection receive buffer for IO_ENGINE_TYPE_COMPLETION.
+	*/
+	#define IOCP_RECEIVE_BUFFER_SIZE 8192
+
+	/*!
+	@def RECEIVE_BUFFER_SIZE
+	@brief byte size of the per-connection receive buffer for the socket thread
+
+	Macro for the byte size of the per-connection receive buffer which the socket thread fills with a single recv call.
+	*/
+	#define RECEIVE_BUFFER_SIZE 16384
+
+	/*!
+	@def EP_SERVER_ATOMIC_REFERENCE_COUNT
+	@brief flag for the atomic reference count of ServerSmartObject
+
+	Macro to count the references of ServerSmartObject with the interlocked operations.
+	Define it as 0 to guard the reference count with the lock of the lock policy instead.
+	*/
+	#ifndef EP_SERVER_ATOMIC_REFERENCE_COUNT
+	#define EP_SERVER_ATOMIC_REFERENCE_COUNT 1
+	#endif //EP_SERVER_ATOMIC_REFERENCE_COUNT
+
+	/*!
+	@def PACKET_POOL_SHARD_COUNT
+	@brief number of the shards of the packet pool
+
+	Macro for the number of the shards of the packet pool, which the threads are mapped to by their thread id.
+	*/
+	#define PACKET_POOL_SHARD_COUNT 16
+
+	/*!
+	@def PACKET_POOL_MIN_BLOCK_SIZE
+	@brief byte size of the smallest size class of the packet pool
+
+	Macro for the byte size of the smallest size class of the packet pool.
+	*/
+	#define PACKET_POOL_MIN_BLOCK_SIZE 32
+
+	/*!
+	@def PACKET_POOL_CLASS_COUNT
+	@brief number of the size classes of the packet pool
+
+	Macro for the number of the size classes of the packet pool. (32 bytes to 64KB by default)
+	*/
+	#define PACKET_POOL_CLASS_COUNT 12
+
+	/*!
+	@def PACKET_POOL_SHARD_CACHE_SIZE
+	@brief maximum byte size of the blocks cached in a shard of the packet pool
+
+	Macro for the maximum byte size of the blocks cached in a shard of the packet pool.
+	*/
+	#define PACKET_POOL_SHARD_CACHE_SIZE 1048576
+
+	/*!
+	@def IOCP_COMPLETION_BATCH_COUNT
+	@brief maximum number of completions dequeued at once
+
+	Macro for the maximum number of completions dequeued at once.
+	*/
+	#define IOCP_COMPLETION_BATCH_COUNT 64
+
+	/*!
+	@def SEND_GATHER_PACKET_COUNT
+	@brief maximum number of packets gathered into one send call
+
+	Macro for the maximum number of packets gathered into one send call.
+	*/
+	#define SEND_GATHER_PACKET_COUNT 32
+
+	/*!
+	@def UDP_RECEIVE_QUEUE_SIZE
+	@brief maximum number of received datagrams queued for a UDP socket
+
+	Macro for the maximum number of received datagrams queued for a UDP socket.
+	@remark the datagrams received while the queue is full are dropped.
+	*/
+	#define UDP_RECEIVE_QUEUE_SIZE 4096
+
+	/*!
+	@def SERVER_OBJECT_REMOVER_QUEUE_SIZE
+	@brief maximum number of server objects queued for the release
+
+	Macro for the maximum number of server objects queued for the release.
+	*/
+	#define SERVER_OBJECT_REMOVER_QUEUE_SIZE 1024
+
+	/*!
+	@def UDP_OFFLOAD_MAX_SEGMENT_COUNT
+	@brief maximum number of datagrams sent with one offloaded send call
+
+	Macro for the maximum number of datagrams sent with one offloaded send call.
+	*/
+	#define UDP_OFFLOAD_MAX_SEGMENT_COUNT 64
+
+	/*!
+	@def UDP_OFFLOAD_MAX_BYTE_SIZE
+	@brief maximum byte size of the datagrams sent or received with one offloaded call
+
+	Macro for the maximum byte size of the datagrams sent or received with one offloaded call.
+	*/
+	#define UDP_OFFLOAD_MAX_BYTE_SIZE 65000
+
+	/*!
+	@def TIMER_WHEEL_TICK_MILLISEC
+	@brief resolution of the timer wheel in millisecond
+
+	Macro for the resolution of the timer wheel in millisecond.
+	*/
+	#define TIMER_WHEEL_TICK_MILLISEC 10
+
+	/*!
+	@def TIMER_WHEEL_SLOT_BITS
+	@brief number of the bits of the slot index in a level of the timer wheel
+
+	Macro for the number of the bits of the slot index in a level of the timer wheel. (64 slots by default)
+	*/
+	#define TIMER_WHEEL_SLOT_BITS 6
+
+	/*!
+	@def TIMER_WHEEL_LEVEL_COUNT
+	@brief number of the levels of the timer wheel
+
+	Macro for the number of the levels of the timer wheel.
+	@remark the wheel covers 2^(TIMER_WHEEL_SLOT_BITS*TIMER_WHEEL_LEVEL_COUNT) ticks. (about 46 hours by default)
+	*/
+	#define TIMER_WHEEL_LEVEL_COUNT 4
+
+	/*!
+	@def TIMEOUT_NONE
+	@brief No timeout
+
+	Macro for no idle timeout or keepalive.
+	*/
+	#define TIMEOUT_NONE 0
+
+	/*!
+	@def SEND_QUEUE_WATERMARK_INFINITE
+	@brief No limit for the send queue
+
+	Macro for no limit for the queued byte size of the send queue.
+	*/
+	#define SEND_QUEUE_WATERMARK_INFINITE 0
+
+	/*!
+	@def BROADCAST_JOB_SOCKET_COUNT
+	@brief maximum number of sockets a broadcast job sends to
+
+	Macro for the maximum number of sockets a broadcast job sends to, so a slow socket only delays its own group.
+	*/
+	#define BROADCAST_JOB_SOCKET_COUNT 64
+
+	/*!
+	@def TOPIC_SEPARATOR
+	@brief separator of the topic levels
+
+	Macro for the separator of the levels of the hierarchical topic.
+	*/
+	#define TOPIC_SEPARATOR '/'
+
+	/*!
+	@def TOPIC_WILDCARD
+	@brief wildcard for the topic levels
+
+	Macro for the wildcard which matches the remaining levels of the topic, when placed as the last level.
+	*/
+	#define TOPIC_WILDCARD '#'
+
+	/*!
+	@def RELAY_BUFFER_BYTE_SIZE
+	@brief maximum byte size the relay moves at once
+
+	Macro for the maximum byte size the relay of the proxy moves at once for each direction.
+	*/
+	#define RELAY_BUFFER_BYTE_SIZE 65536
+
+	/// I/O Engine Type
+	typedef enum _ioEngineType{
+		/// Wait until readable, then read with recv
+		IO_ENGINE_TYPE_READINESS=0,
+		/// Read into the per-connection buffer with the overlapped receive
+		IO_ENGINE_TYPE_COMPLETION,
+	}IoEngineType;
+
+	/// Packet Dispatch Type
+	typedef enum _packetDispatchType{
+		/// Start a new processor thread for each received packet
+		PACKET_DISPATCH_TYPE_THREAD=0,
+		/// Process the received packets with the shared worker threads
+		PACKET_DISPATCH_TYPE_POOL,
+		/// Process the received packets with the shared worker threads in the received order per connection
+		PACKET_DISPATCH_TYPE_POOL_ORDERED,
+	}PacketDispatchType;
+
+	/// Send Queue Policy
+	typedef enum _sendQueuePolicy{
+		/// Block the sender until the send queue drops to the low watermark
+		SEND_QUEUE_POLICY_BLOCK=0,
+		/// Drop the packet which exceeds the high watermark
+		SEND_QUEUE_POLICY_DROP,
+		/// Drop the packet which exceeds the high watermark and kill the connection
+		SEND_QUEUE_POLICY_DISCONNECT,
+	}SendQueuePolicy;
+
 	/// Receive Status
 	typedef enum _receiveStatus{
 		/// Success
@@ -105,6 +314,8 @@ namespace epse{
 		SEND_STATUS_FAIL_SEND_FAILED,
 		/// Not connected
 		SEND_STATUS_FAIL_NOT_CONNECTED,
+		/// Send queue is over the high watermark
+		SEND_STATUS_FAIL_QUEUE_FULL,
 
 	}SendStatus;
 	
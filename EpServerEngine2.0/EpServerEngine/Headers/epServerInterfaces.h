@@ -44,6 +44,7 @@ An Interface for Server Interfaces.
 #include "epBaseServerObject.h"
 namespace epse{
 	class ServerCallbackInterface;
+	class SocketInterface;
 
 	/*! 
 	@struct ServerOps epServerInterfaces.h
@@ -66,10 +67,100 @@ namespace epse{
 
 		/*!
 		The number of worker thread.
-		@remark For IOCP Use Only!
+		@remark For IOCP and the event loop mode Use Only!
 		*/
 		unsigned int workerThreadCount;
 
+		/*!
+		The flag for the event loop mode.
+		@remark if true, workerThreadCount event loop threads drive all the sockets instead of a thread per socket.
+		@remark For Asynchronous TCP Server Use Only!
+		*/
+		bool isEventLoop;
+
+		/*!
+		The packet dispatch type.
+		@remark If isAsynchronousReceive is false then this value is ignored!
+		@remark For Asynchronous Server Use Only!
+		*/
+		PacketDispatchType packetDispatchType;
+
+		/*!
+		The number of packet dispatch worker thread.
+		@remark if 0, the number of the cores is used.
+		@remark For PACKET_DISPATCH_TYPE_POOL and PACKET_DISPATCH_TYPE_POOL_ORDERED Use Only!
+		*/
+		unsigned int dispatchThreadCount;
+
+		/*!
+		The I/O engine type.
+		@remark For IOCP Use Only!
+		*/
+		IoEngineType ioEngineType;
+
+		/*!
+		Flag for the UDP segmentation and receive coalescing offload.
+		@remark the offload is used only if the platform supports it.
+		@remark For UDP Server Use Only!
+		*/
+		bool isUdpOffload;
+
+		/*!
+		The number of the accept/receive loops, each running on its own core.
+		@remark each loop has its own listening socket with SO_REUSEPORT where supported,
+		        otherwise the TCP loops share the listening socket and the UDP server runs one loop.
+		@remark the callback object is called from all the loops concurrently.
+		*/
+		unsigned int acceptorCount;
+
+		/*!
+		The idle time in millisecond after which the connection is timed out.
+		@remark the time is reset whenever a packet is received.
+		@remark TIMEOUT_NONE means the connection never times out.
+		*/
+		unsigned int idleTimeoutMilliSec;
+
+		/*!
+		The quiet time in millisecond after which OnKeepAlive is called to send a heartbeat.
+		@remark TIMEOUT_NONE means no keepalive.
+		*/
+		unsigned int keepAliveMilliSec;
+
+		/*!
+		The time in millisecond within which the packets at the front of the send queue must be written.
+		@remark OnSendTimeout is called if the peer does not read them in time.
+		@remark TIMEOUT_NONE means no send deadline.
+		@remark For IOCP TCP Server Use Only!
+		*/
+		unsigned int sendTimeoutMilliSec;
+
+		/*!
+		The queued byte size of the per-connection send queue over which sendQueuePolicy is applied.
+		@remark SEND_QUEUE_WATERMARK_INFINITE means the send queue is unbounded.
+		@remark For IOCP TCP Server Use Only!
+		*/
+		unsigned int sendQueueHighWatermark;
+
+		/*!
+		The queued byte size of the per-connection send queue at which OnWritable is called.
+		@remark For IOCP TCP Server Use Only!
+		*/
+		unsigned int sendQueueLowWatermark;
+
+		/*!
+		The policy applied when the send queue is over the high watermark.
+		@remark SEND_QUEUE_POLICY_BLOCK must not be used when sending from the worker threads.
+		@remark For IOCP TCP Server Use Only!
+		*/
+		SendQueuePolicy sendQueuePolicy;
+
+		/*!
+		The number of the broadcast worker thread.
+		@remark if 0, the number of the cores is used.
+		@remark For Synchronous and Asynchronous Server Use Only! IOCP Server broadcasts with its worker threads.
+		*/
+		unsigned int broadcastThreadCount;
+
 		/*!
 		Default Constructor
 
@@ -83,6 +174,19 @@ namespace epse{
 			waitTimeMilliSec=WAITTIME_INIFINITE;
 			maximumConnectionCount=CONNECTION_LIMIT_INFINITE;
 			workerThreadCount=0;
+			isEventLoop=false;
+			packetDispatchType=PACKET_DISPATCH_TYPE_THREAD;
+			dispatchThreadCount=0;
+			ioEngineType=IO_ENGINE_TYPE_READINESS;
+			isUdpOffload=false;
+			acceptorCount=1;
+			idleTimeoutMilliSec=TIMEOUT_NONE;
+			keepAliveMilliSec=TIMEOUT_NONE;
+			sendTimeoutMilliSec=TIMEOUT_NONE;
+			sendQueueHighWatermark=SEND_QUEUE_WATERMARK_INFINITE;
+			sendQueueLowWatermark=0;
+			sendQueuePolicy=SEND_QUEUE_POLICY_BLOCK;
+			broadcastThreadCount=0;
 
 		}
 
@@ -156,6 +260,56 @@ namespace epse{
 		*/
 		virtual void ShutdownAllClient()=0;
 
+		/*!
+		Send the packet to all clients' socket connected.
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec wait time for sending the packet to each socket
+		@remark the packet is shared by all the sockets, so it must not be changed after the call.
+		*/
+		virtual void Broadcast(Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE)=0;
+
+		/*!
+		Send the packet to the given clients' socket.
+		@param[in] socketList the list of the sockets to send the packet to
+		@param[in] socketCount the number of the sockets in the list
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec wait time for sending the packet to each socket
+		@remark the packet is shared by all the sockets, so it must not be changed after the call.
+		*/
+		virtual void Multicast(SocketInterface *const*socketList,unsigned int socketCount,Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE)=0;
+
+		/*!
+		Subscribe the client's socket to the topic.
+		@param[in] socket the socket to subscribe
+		@param[in] topic the topic, which may end with TOPIC_WILDCARD to subscribe to all the topics under it
+		@return true if subscribed, false if already subscribed or the topic is invalid
+		@remark the socket is unsubscribed from all the topics when disconnected.
+		*/
+		virtual bool Subscribe(SocketInterface *socket,const TCHAR *topic)=0;
+
+		/*!
+		Unsubscribe the client's socket from the topic.
+		@param[in] socket the socket to unsubscribe
+		@param[in] topic the topic subscribed
+		@return true if unsubscribed, false if not subscribed
+		*/
+		virtual bool Unsubscribe(SocketInterface *socket,const TCHAR *topic)=0;
+
+		/*!
+		Unsubscribe the client's socket from all the topics.
+		@param[in] socket the socket to unsubscribe
+		*/
+		virtual void UnsubscribeAll(SocketInterface *socket)=0;
+
+		/*!
+		Send the packet to the clients' socket subscribing to the topic.
+		@param[in] topic the topic to publish to
+		@param[in] packet the packet to send
+		@param[in] waitTimeInMilliSec wait time for sending the packet to each socket
+		@remark the packet is shared by all the sockets, so it must not be changed after the call.
+		*/
+		virtual void Publish(const TCHAR *topic,Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE)=0;
+
 		/*!
 		Get the maximum packet byte size
 		@return the maximum packet byte size
@@ -205,6 +359,38 @@ namespace epse{
 		*/
 		virtual int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL)=0;
 
+		/*!
+		Send the packets to the client
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending each packet in millisecond
+		@param[in] sendStatus the status of send.
+		@return sent byte size
+		@remark return -1 if error occurred
+		@remark TCP sockets send the packets with a single gathered write.
+		@remark UDP sockets wait for the socket once for all the packets.
+		*/
+		virtual int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL)
+		{
+			int writeLength=0;
+			SendStatus status=SEND_STATUS_SUCCESS;
+			for(unsigned int trav=0;trav<packetCount;trav++)
+			{
+				if(!packetList[trav])
+					continue;
+				int sentLength=Send(*packetList[trav],waitTimeInMilliSec,&status);
+				if(status!=SEND_STATUS_SUCCESS)
+				{
+					writeLength=sentLength;
+					break;
+				}
+				writeLength+=sentLength;
+			}
+			if(sendStatus)
+				*sendStatus=status;
+			return writeLength;
+		}
+
 		/*!
 		Receive the packet from the client
 		@param[in] waitTimeInMilliSec wait time for receiving the packet in millisecond
@@ -316,6 +502,13 @@ namespace epse{
 		*/
 		virtual unsigned int GetMaxPacketByteSize() const{return 0;}
 
+		/*!
+		Get the byte size of the packets queued to send
+		@return the byte size of the packets queued to send
+		@remark for IOCP TCP Socket Use Only!
+		*/
+		virtual unsigned int GetSendQueueByteSize() const{return 0;}
+
 		
 
 	};
@@ -363,6 +556,43 @@ namespace epse{
 		@param[in] socket the client socket, disconnected.
 		*/
 		virtual void OnDisconnect(SocketInterface *socket){}
+
+		/*!
+		The client has not sent any packet for the idle timeout.
+		@param[in] socket the idle client socket
+		@return true to kill the connection, false to keep it for another idle timeout.
+		@remark called from the timer thread of the server.
+		*/
+		virtual bool OnIdleTimeout(SocketInterface *socket){return true;}
+
+		/*!
+		The connection has been quiet for the keepalive time.
+		@param[in] socket the quiet client socket
+		@remark called from the timer thread of the server, so the heartbeat should be sent without blocking.
+		*/
+		virtual void OnKeepAlive(SocketInterface *socket){}
+
+		/*!
+		The packets at the front of the send queue have not been written for the send timeout.
+		@param[in] socket the client socket which is slow to read
+		@return true to kill the connection, false to wait for another send timeout.
+		@remark called from the timer thread of the server.
+		*/
+		virtual bool OnSendTimeout(SocketInterface *socket){return true;}
+
+		/*!
+		The send queue dropped to the low watermark after it went over the high watermark.
+		@param[in] socket the client socket which is writable again
+		@remark for IOCP TCP Server Use Only!
+		*/
+		virtual void OnWritable(SocketInterface *socket){}
+
+		/*!
+		All the queued packets are sent.
+		@param[in] socket the client socket whose send queue is empty
+		@remark for IOCP TCP Server Use Only!
+		*/
+		virtual void OnSendQueueDrained(SocketInterface *socket){}
 	};
 
 }
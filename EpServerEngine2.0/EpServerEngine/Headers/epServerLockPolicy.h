@@ -0,0 +1,440 @@
+/*! 
+@file epServerLockPolicy.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Server Lock Policy Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Server Lock Policy.
+
+The Server Lock Policy provides the lock types chosen at compile time.
+Unlike epl::BaseLock selected by the runtime lock policy, the lock is held
+as a member and called without the virtual call, and ServerNoLock compiles
+to nothing.
+
+*/
+#ifndef __EP_SERVER_LOCK_POLICY_H__
+#define __EP_SERVER_LOCK_POLICY_H__
+
+#include "epServerEngine.h"
+
+namespace epse{
+
+	/*! 
+	@class ServerNoLock epServerLockPolicy.h
+	@brief A compile-time lock policy which does not lock at all.
+	*/
+	class ServerNoLock{
+	public:
+		/*!
+		Default Constructor
+		@param[in] lockPolicyType ignored
+		*/
+		ServerNoLock(epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY){}
+
+		/*!
+		Lock (does nothing)
+		*/
+		void Lock(){}
+
+		/*!
+		Unlock (does nothing)
+		*/
+		void Unlock(){}
+
+	private:
+		/*!
+		Default Copy Constructor
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		ServerNoLock(const ServerNoLock& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		ServerNoLock & operator=(const ServerNoLock&b){return *this;}
+	};
+
+	/*! 
+	@class ServerCriticalSection epServerLockPolicy.h
+	@brief A compile-time lock policy with the critical section held as a member.
+	*/
+	class ServerCriticalSection{
+	public:
+		/*!
+		Default Constructor
+		@param[in] lockPolicyType ignored
+		*/
+		ServerCriticalSection(epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY)
+		{
+			InitializeCriticalSection(&m_criticalSection);
+		}
+
+		/*!
+		Default Destructor
+		*/
+		~ServerCriticalSection()
+		{
+			DeleteCriticalSection(&m_criticalSection);
+		}
+
+		/*!
+		Enter the critical section
+		*/
+		void Lock()
+		{
+			EnterCriticalSection(&m_criticalSection);
+		}
+
+		/*!
+		Leave the critical section
+		*/
+		void Unlock()
+		{
+			LeaveCriticalSection(&m_criticalSection);
+		}
+
+	private:
+		/*!
+		Default Copy Constructor
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		ServerCriticalSection(const ServerCriticalSection& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		ServerCriticalSection & operator=(const ServerCriticalSection&b){return *this;}
+
+		/// critical section
+		CRITICAL_SECTION m_criticalSection;
+	};
+
+	/*! 
+	@class ServerMutex epServerLockPolicy.h
+	@brief A compile-time lock policy with the mutex held as a member.
+	*/
+	class ServerMutex{
+	public:
+		/*!
+		Default Constructor
+		@param[in] lockPolicyType ignored
+		*/
+		ServerMutex(epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY)
+		{
+			m_mutex=CreateMutex(NULL,FALSE,NULL);
+		}
+
+		/*!
+		Default Destructor
+		*/
+		~ServerMutex()
+		{
+			if(m_mutex)
+				CloseHandle(m_mutex);
+		}
+
+		/*!
+		Lock the mutex
+		*/
+		void Lock()
+		{
+			WaitForSingleObject(m_mutex,INFINITE);
+		}
+
+		/*!
+		Unlock the mutex
+		*/
+		void Unlock()
+		{
+			ReleaseMutex(m_mutex);
+		}
+
+	private:
+		/*!
+		Default Copy Constructor
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		ServerMutex(const ServerMutex& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		ServerMutex & operator=(const ServerMutex&b){return *this;}
+
+		/// mutex
+		HANDLE m_mutex;
+	};
+
+	/*! 
+	@class ServerRuntimeLock epServerLockPolicy.h
+	@brief A lock policy which selects the lock by the runtime lock policy as the rest of the engine does.
+	@remark the lock is allocated for each object, so it must be chosen explicitly where the lock policy is known only at runtime.
+	*/
+	class ServerRuntimeLock{
+	public:
+		/*!
+		Default Constructor
+		@param[in] lockPolicyType The lock policy
+		*/
+		ServerRuntimeLock(epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY)
+		{
+			switch(lockPolicyType)
+			{
+			case epl::LOCK_POLICY_CRITICALSECTION:
+				m_lock=EP_NEW epl::CriticalSectionEx();
+				break;
+			case epl::LOCK_POLICY_MUTEX:
+				m_lock=EP_NEW epl::Mutex();
+				break;
+			case epl::LOCK_POLICY_NONE:
+				m_lock=EP_NEW epl::NoLock();
+				break;
+			default:
+				m_lock=NULL;
+				break;
+			}
+		}
+
+		/*!
+		Default Destructor
+		*/
+		~ServerRuntimeLock()
+		{
+			if(m_lock)
+				EP_DELETE m_lock;
+			m_lock=NULL;
+		}
+
+		/*!
+		Lock
+		*/
+		void Lock()
+		{
+			if(m_lock)
+				m_lock->Lock();
+		}
+
+		/*!
+		Unlock
+		*/
+		void Unlock()
+		{
+			if(m_lock)
+				m_lock->Unlock();
+		}
+
+	private:
+		/*!
+		Default Copy Constructor
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		ServerRuntimeLock(const ServerRuntimeLock& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		ServerRuntimeLock & operator=(const ServerRuntimeLock&b){return *this;}
+
+		/// lock
+		epl::BaseLock *m_lock;
+	};
+
+	/*! 
+	@struct ServerLockPolicy epServerLockPolicy.h
+	@brief Maps the lock policy to the compile-time lock type.
+
+	ex) ServerLockPolicy<epl::LOCK_POLICY_NONE>::LockType is ServerNoLock.
+	*/
+	template<epl::LockPolicy lockPolicyType>
+	struct ServerLockPolicy{
+		/// lock type for the lock policy
+		typedef ServerRuntimeLock LockType;
+	};
+
+	template<>
+	struct ServerLockPolicy<epl::LOCK_POLICY_NONE>{
+		/// lock type for the lock policy
+		typedef ServerNoLock LockType;
+	};
+
+	template<>
+	struct ServerLockPolicy<epl::LOCK_POLICY_CRITICALSECTION>{
+		/// lock type for the lock policy
+		typedef ServerCriticalSection LockType;
+	};
+
+	template<>
+	struct ServerLockPolicy<epl::LOCK_POLICY_MUTEX>{
+		/// lock type for the lock policy
+		typedef ServerMutex LockType;
+	};
+
+	/*! 
+	@class ServerPolicyLock epServerLockPolicy.h
+	@brief A lock policy which uses the compile-time lock for the default lock policy, and the runtime lock for the others.
+	@remark the lock policy given to the constructor is always honoured,
+	        while the object with the default lock policy does not allocate the lock.
+	*/
+	template<epl::LockPolicy defaultLockPolicyType>
+	class ServerPolicyLock{
+	public:
+		/*!
+		Default Constructor
+		@param[in] lockPolicyType The lock policy
+		*/
+		ServerPolicyLock(epl::LockPolicy lockPolicyType=defaultLockPolicyType)
+		{
+			m_runtimeLock=NULL;
+			if(lockPolicyType!=defaultLockPolicyType)
+				m_runtimeLock=EP_NEW ServerRuntimeLock(lockPolicyType);
+		}
+
+		/*!
+		Default Destructor
+		*/
+		~ServerPolicyLock()
+		{
+			if(m_runtimeLock)
+				EP_DELETE m_runtimeLock;
+			m_runtimeLock=NULL;
+		}
+
+		/*!
+		Lock
+		*/
+		void Lock()
+		{
+			if(m_runtimeLock)
+				m_runtimeLock->Lock();
+			else
+				m_defaultLock.Lock();
+		}
+
+		/*!
+		Unlock
+		*/
+		void Unlock()
+		{
+			if(m_runtimeLock)
+				m_runtimeLock->Unlock();
+			else
+				m_defaultLock.Unlock();
+		}
+
+	private:
+		/*!
+		Default Copy Constructor
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		ServerPolicyLock(const ServerPolicyLock& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		ServerPolicyLock & operator=(const ServerPolicyLock&b){return *this;}
+
+		/// the compile-time lock for the default lock policy
+		typename ServerLockPolicy<defaultLockPolicyType>::LockType m_defaultLock;
+
+		/// the runtime lock for the lock policy other than the default
+		ServerRuntimeLock *m_runtimeLock;
+	};
+
+	/*! 
+	@class ServerLockObj epServerLockPolicy.h
+	@brief A class which locks the compile-time lock for the scope.
+	*/
+	template<typename LockType>
+	class ServerLockObj{
+	public:
+		/*!
+		Default Constructor
+
+		Lock the given lock
+		@param[in] lock the lock to hold for the scope
+		*/
+		ServerLockObj(LockType &lock):m_lock(lock)
+		{
+			m_lock.Lock();
+		}
+
+		/*!
+		Default Destructor
+
+		Unlock the lock
+		*/
+		~ServerLockObj()
+		{
+			m_lock.Unlock();
+		}
+
+	private:
+		/*!
+		Default Copy Constructor
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		ServerLockObj(const ServerLockObj& b):m_lock(b.m_lock){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		ServerLockObj & operator=(const ServerLockObj&b){return *this;}
+
+		/// lock held
+		LockType &m_lock;
+	};
+}
+
+#endif //__EP_SERVER_LOCK_POLICY_H__
@@ -42,6 +42,8 @@ An Interface for Server Object List.
 #include "epBaseServerObject.h"
 #include "epServerObjectRemover.h"
 #include <vector>
+#include <string>
+#include <hash_map>
 #include "epPacket.h"
 
 using namespace std;
@@ -52,6 +54,11 @@ namespace epse{
 	/*! 
 	@class ServerObjectList epServerObjectList.h
 	@brief A class for Server Object List.
+
+	The objects are kept in a dense list and each object remembers its index in the list,
+	so Push and Remove take O(1) time by moving the last object into the removed slot.
+	Thus the objects are not kept in the pushed order once an object is removed.
+	The objects pushed with the key are also kept in the hash map, so FindByKey takes O(1) time.
 	*/
 	class EP_SERVER_ENGINE ServerObjectList{
 
@@ -124,7 +131,8 @@ namespace epse{
 		/*!
 		Remove the given object from the list
 		@param[in] serverObj the server object to remove
-		@remark it also releases the object
+		@remark it also releases the object.<br/>
+		        The last object is moved into the removed slot, so the order of the list changes.
 		*/
 		virtual bool Remove(const BaseServerObject* serverObj);
 
@@ -140,13 +148,38 @@ namespace epse{
 		@param[in] obj the object to push in
 		*/
 		virtual void Push(BaseServerObject* obj);
+
+		/*!
+		Push the new object to the list with the given key
+		@param[in] obj the object to push in
+		@param[in] key the key to find the object
+		@param[in] keyByteSize the byte size of the key
+		@remark if the key is already in the list, the key is moved to the new object.
+		*/
+		virtual void Push(BaseServerObject* obj,const void *key,size_t keyByteSize);
+
+		/*!
+		Find the object with given key pushed together
+		@param[in] key the key to find
+		@param[in] keyByteSize the byte size of the key
+		@return the found BaseServerObject, or NULL if not found
+		*/
+		BaseServerObject *FindByKey(const void *key,size_t keyByteSize) const;
 		
 		/*!
 		Returns the list in vector
 		@return the list of the objects
+		@remark the objects are not in the pushed order once an object is removed.
 		*/
 		vector<BaseServerObject*> GetList() const;
 
+		/*!
+		Returns the list in vector with all the objects retained
+		@return the list of the retained objects
+		@remark the caller must call ReleaseObj() for each object to avoid the memory leak.
+		*/
+		vector<BaseServerObject*> GetRetainedList() const;
+
 		/*!
 		Returns the number of element in the list
 		@return the number of element in the list
@@ -157,6 +190,7 @@ namespace epse{
 		Do the action given by input function for all elements
 		@param[in] DoFunc the action for each element
 		@param[in] argCount the number of arguments
+		@remark the objects are not visited in the pushed order once an object is removed.
 		*/
 		void Do(void (__cdecl *DoFunc)(BaseServerObject*,unsigned int,va_list),unsigned int argCount,...);
 
@@ -165,6 +199,7 @@ namespace epse{
 		@param[in] DoFunc the action for each element
 		@param[in] argCount the number of arguments
 		@param[in] args the argument list
+		@remark the objects are not visited in the pushed order once an object is removed.
 		*/
 		void Do(void (__cdecl *DoFunc)(BaseServerObject*,unsigned int,va_list),unsigned int argCount,va_list args);
 
@@ -199,6 +234,18 @@ namespace epse{
 		Reset the list
 		*/
 		void resetList();
+
+		/*!
+		Copy the list from the given list
+		@param[in] b the list to copy from
+		*/
+		void copyList(const ServerObjectList &b);
+
+		/*!
+		Remove the object at the given index by moving the last object into the slot
+		@param[in] idx the index of the object to remove
+		*/
+		void removeAt(size_t idx);
 	
 		/// list lock
 		epl::BaseLock *m_listLock;
@@ -206,6 +253,13 @@ namespace epse{
 		/// parser thread list
 		vector<BaseServerObject*> m_objectList;
 
+		/// key list parallel to the object list
+		/// @remark empty if the object is pushed without the key
+		vector<string> m_keyList;
+
+		/// object map by key
+		stdext::hash_map<string,BaseServerObject*> m_keyMap;
+
 		/// wait time in millisecond for terminating thread
 		/// @remark for ParserList and ServerObjectRemover
 		unsigned int m_waitTime;
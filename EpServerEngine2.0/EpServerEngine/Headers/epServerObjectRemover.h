@@ -40,11 +40,9 @@ An Interface for Server Object Remover.
 
 #include "epServerEngine.h"
 #include "epBaseServerObject.h"
-#include <queue>
+#include "epServerRingQueue.h"
 
 
-using namespace std;
-
 
 namespace epse{
 
@@ -57,6 +55,7 @@ namespace epse{
 	private:
 		friend class ServerObjectList;
 		friend class ParserList;
+		friend class ForwardClientPool;
 		/*!
 		Default Constructor
 
@@ -102,6 +101,8 @@ namespace epse{
 		/*!
 		Push the new object to the list
 		@param[in] obj the object to push in
+		@remark waits for the room if the list is full.<br/>
+		        The object is released at once if the remover is stopped with the list full.
 		*/
 		void Push(BaseServerObject* obj);
 
@@ -119,14 +120,14 @@ namespace epse{
 		/// wait time in millisecond for terminating thread
 		unsigned int m_waitTime;
 
-		/// list lock
-		epl::BaseLock *m_listLock;
+		/// wait time lock
+		epl::BaseLock *m_waitTimeLock;
 
 		/// stop lock
 		epl::BaseLock *m_stopLock;
 
 		/// parser thread list
-		queue<BaseServerObject*> m_objectList;
+		ServerRingQueue<BaseServerObject*> m_objectList;
 
 		/// Lock Policy
 		epl::LockPolicy m_lockPolicy;
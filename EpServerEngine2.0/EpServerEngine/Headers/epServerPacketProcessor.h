@@ -41,6 +41,7 @@ An Interface for Server Packet Processor.
 #include "epServerEngine.h"
 #include "epServerInterfaces.h"
 #include "epBasePacketProcessor.h"
+#include "epPacketDispatcher.h"
 
 namespace epse
 {
@@ -105,6 +106,9 @@ namespace epse
 		/// Callback Object
 		ServerCallbackInterface *m_callBackObj;
 
+		/// delegate object to notify when the packet is processed
+		PacketDispatchDelegate *m_completionDelegate;
+
 
 	};
 
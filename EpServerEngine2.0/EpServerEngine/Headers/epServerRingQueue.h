@@ -0,0 +1,422 @@
+/*! 
+@file epServerRingQueue.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief ServerRingQueue Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Server Ring Queue.
+
+The Server Ring Queue is a bounded lock-free queue for handing off the
+data between the threads, with the optional wait for the data or the room.
+
+*/
+#ifndef __EP_SERVER_RING_QUEUE_H__
+#define __EP_SERVER_RING_QUEUE_H__
+
+#include "epServerEngine.h"
+
+namespace epse{
+
+	/// Enumerator for the ring queue type
+	typedef enum _ringQueueType{
+		/// multiple producers and multiple consumers
+		RING_QUEUE_TYPE_MPMC=0,
+		/// multiple producers and a single consumer
+		RING_QUEUE_TYPE_MPSC,
+		/// a single producer and a single consumer
+		RING_QUEUE_TYPE_SPSC,
+	}RingQueueType;
+
+	/*! 
+	@class ServerRingQueue epServerRingQueue.h
+	@brief A bounded lock-free ring queue template for handing off the data between the threads.
+
+	Each cell of the ring carries a sequence number, so the producers and the consumers
+	claim the cells with a single interlocked operation instead of a lock.
+	The single producer and the single consumer sides claim the cells without the interlocked operation.
+	@remark the capacity is rounded up to the power of 2.
+	*/
+	template <typename DataType, RingQueueType queueType=RING_QUEUE_TYPE_MPMC>
+	class ServerRingQueue{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Queue
+		@param[in] capacity the maximum number of the data in the queue
+		*/
+		ServerRingQueue(unsigned int capacity);
+
+		/*!
+		Default Destructor
+
+		Destroy the Queue
+		*/
+		virtual ~ServerRingQueue();
+
+		/*!
+		Insert the given data without waiting
+		@param[in] data the data to insert
+		@return true if inserted, false if the queue is full
+		*/
+		bool TryPush(const DataType &data);
+
+		/*!
+		Remove the oldest data without waiting
+		@param[out] retData the data removed
+		@return true if removed, false if the queue is empty
+		*/
+		bool TryPop(DataType &retData);
+
+		/*!
+		Insert the given data, waiting for the room if the queue is full
+		@param[in] data the data to insert
+		@param[in] waitTimeMilliSec the wait time in millisecond
+		@return true if inserted otherwise false
+		@remark the room is waited for until the wait time elapses, or until WakeUp is called.
+		*/
+		bool Push(const DataType &data,unsigned int waitTimeMilliSec=WAITTIME_INIFINITE);
+
+		/*!
+		Remove the oldest data, waiting for the data if the queue is empty
+		@param[out] retData the data removed
+		@param[in] waitTimeMilliSec the wait time in millisecond
+		@return true if removed otherwise false
+		@remark the data is waited for until the wait time elapses, or until WakeUp is called.
+		*/
+		bool Pop(DataType &retData,unsigned int waitTimeMilliSec=WAITTIME_INIFINITE);
+
+		/*!
+		Wake up the threads waiting in Push or Pop
+		@remark Push and Pop do not wait any more until ClearWakeUp is called.
+		*/
+		void WakeUp();
+
+		/*!
+		Let Push and Pop wait again after WakeUp
+		*/
+		void ClearWakeUp();
+
+		/*!
+		Get the number of the data in the queue
+		@return the number of the data
+		@remark the number may be already changed by the other threads.
+		*/
+		unsigned int Size() const;
+
+		/*!
+		Check if the queue is empty
+		@return true if the queue is empty otherwise false
+		@remark the result may be already changed by the other threads.
+		*/
+		bool IsEmpty() const;
+
+		/*!
+		Get the maximum number of the data in the queue
+		@return the capacity of the queue
+		*/
+		unsigned int GetCapacity() const;
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Queue
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		ServerRingQueue(const ServerRingQueue& b){}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		ServerRingQueue & operator=(const ServerRingQueue&b){return *this;}
+
+		/*!
+		Raise the given event if there is the waiting thread
+		@param[in] waitEvent the event to raise
+		@param[in] waiterCount the number of the waiting threads for the event
+		*/
+		void notify(epl::EventEx &waitEvent,volatile long &waiterCount);
+
+		/*!
+		Get the time left to wait
+		@param[in] startTime the tick count when the wait started
+		@param[in] waitTimeMilliSec the wait time in millisecond
+		@param[out] retRemainTime the time left to wait in millisecond
+		@return true if time is left otherwise false
+		*/
+		static bool getRemainTime(unsigned int startTime,unsigned int waitTimeMilliSec,unsigned int &retRemainTime);
+
+		/*!
+		@struct Cell epServerRingQueue.h
+		@brief the cell of the ring.
+		*/
+		struct Cell{
+			/// sequence number which tells if the cell is ready to push or pop
+			volatile long m_sequence;
+			/// data
+			DataType m_data;
+		};
+
+		/// ring of the cells
+		Cell *m_ring;
+		/// capacity - 1 to mask the position
+		unsigned long m_mask;
+		/// padding to keep the producer position on its own cache line
+		char m_pad0[64];
+		/// position to push
+		volatile long m_pushPos;
+		/// padding to keep the consumer position on its own cache line
+		char m_pad1[64];
+		/// position to pop
+		volatile long m_popPos;
+		/// padding to keep the waiter counts off the consumer cache line
+		char m_pad2[64];
+		/// number of the threads waiting for the data
+		volatile long m_popWaiterCount;
+		/// number of the threads waiting for the room
+		volatile long m_pushWaiterCount;
+		/// flag which tells if WakeUp is called
+		volatile long m_isWokenUp;
+		/// event raised when the data is pushed
+		epl::EventEx m_notEmptyEvent;
+		/// event raised when the data is popped
+		epl::EventEx m_notFullEvent;
+	};
+
+	template <typename DataType, RingQueueType queueType>
+	ServerRingQueue<DataType,queueType>::ServerRingQueue(unsigned int capacity):m_notEmptyEvent(false,false),m_notFullEvent(false,false)
+	{
+		unsigned long ringSize=2;
+		while(ringSize<capacity)
+			ringSize<<=1;
+		m_ring=EP_NEW Cell[ringSize];
+		for(unsigned long trav=0;trav<ringSize;trav++)
+			m_ring[trav].m_sequence=(long)trav;
+		m_mask=ringSize-1;
+		m_pushPos=0;
+		m_popPos=0;
+		m_popWaiterCount=0;
+		m_pushWaiterCount=0;
+		m_isWokenUp=0;
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	ServerRingQueue<DataType,queueType>::~ServerRingQueue()
+	{
+		EP_DELETE[] m_ring;
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	bool ServerRingQueue<DataType,queueType>::TryPush(const DataType &data)
+	{
+		Cell *cell;
+		unsigned long pos=(unsigned long)m_pushPos;
+		while(1)
+		{
+			cell=&m_ring[pos&m_mask];
+			long diff=(long)((unsigned long)cell->m_sequence-pos);
+			if(diff==0)
+			{
+				if(queueType==RING_QUEUE_TYPE_SPSC)
+				{
+					m_pushPos=(long)(pos+1);
+					break;
+				}
+				if(InterlockedCompareExchange(&m_pushPos,(long)(pos+1),(long)pos)==(long)pos)
+					break;
+				pos=(unsigned long)m_pushPos;
+			}
+			else if(diff<0)
+				return false;
+			else
+				pos=(unsigned long)m_pushPos;
+		}
+		cell->m_data=data;
+		// publish the data to the consumers
+		InterlockedExchange(&cell->m_sequence,(long)(pos+1));
+		notify(m_notEmptyEvent,m_popWaiterCount);
+		return true;
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	bool ServerRingQueue<DataType,queueType>::TryPop(DataType &retData)
+	{
+		Cell *cell;
+		unsigned long pos=(unsigned long)m_popPos;
+		while(1)
+		{
+			cell=&m_ring[pos&m_mask];
+			long diff=(long)((unsigned long)cell->m_sequence-(pos+1));
+			if(diff==0)
+			{
+				if(queueType!=RING_QUEUE_TYPE_MPMC)
+				{
+					m_popPos=(long)(pos+1);
+					break;
+				}
+				if(InterlockedCompareExchange(&m_popPos,(long)(pos+1),(long)pos)==(long)pos)
+					break;
+				pos=(unsigned long)m_popPos;
+			}
+			else if(diff<0)
+				return false;
+			else
+				pos=(unsigned long)m_popPos;
+		}
+		retData=cell->m_data;
+		// hand the cell back to the producers one lap later
+		InterlockedExchange(&cell->m_sequence,(long)(pos+m_mask+1));
+		notify(m_notFullEvent,m_pushWaiterCount);
+		return true;
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	bool ServerRingQueue<DataType,queueType>::Push(const DataType &data,unsigned int waitTimeMilliSec)
+	{
+		if(TryPush(data))
+			return true;
+		if(waitTimeMilliSec==WAITTIME_IGNORE)
+			return false;
+
+		unsigned int startTime=epl::System::GetTickCount();
+		unsigned int remainTime=waitTimeMilliSec;
+		bool ret=false;
+		InterlockedIncrement(&m_pushWaiterCount);
+		// check again after registering as a waiter, so the notification is not missed
+		while(!(ret=TryPush(data)))
+		{
+			if(m_isWokenUp || !getRemainTime(startTime,waitTimeMilliSec,remainTime))
+				break;
+			// the room may be taken by the other producer after the wake, so retry until the time is up
+			m_notFullEvent.WaitForEvent(remainTime);
+		}
+		InterlockedDecrement(&m_pushWaiterCount);
+		// the auto reset event wakes one thread per raise, so pass it on if room is left or woken up
+		if((ret && Size()<GetCapacity()) || m_isWokenUp)
+			notify(m_notFullEvent,m_pushWaiterCount);
+		return ret;
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	bool ServerRingQueue<DataType,queueType>::Pop(DataType &retData,unsigned int waitTimeMilliSec)
+	{
+		if(TryPop(retData))
+			return true;
+		if(waitTimeMilliSec==WAITTIME_IGNORE)
+			return false;
+
+		unsigned int startTime=epl::System::GetTickCount();
+		unsigned int remainTime=waitTimeMilliSec;
+		bool ret=false;
+		InterlockedIncrement(&m_popWaiterCount);
+		// check again after registering as a waiter, so the notification is not missed
+		while(!(ret=TryPop(retData)))
+		{
+			if(m_isWokenUp || !getRemainTime(startTime,waitTimeMilliSec,remainTime))
+				break;
+			// the data may be taken by the other consumer after the wake, so retry until the time is up
+			m_notEmptyEvent.WaitForEvent(remainTime);
+		}
+		InterlockedDecrement(&m_popWaiterCount);
+		// the auto reset event wakes one thread per raise, so pass it on if data is left or woken up
+		if((ret && !IsEmpty()) || m_isWokenUp)
+			notify(m_notEmptyEvent,m_popWaiterCount);
+		return ret;
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	void ServerRingQueue<DataType,queueType>::WakeUp()
+	{
+		InterlockedExchange(&m_isWokenUp,1);
+		m_notEmptyEvent.SetEvent();
+		m_notFullEvent.SetEvent();
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	void ServerRingQueue<DataType,queueType>::ClearWakeUp()
+	{
+		InterlockedExchange(&m_isWokenUp,0);
+		m_notEmptyEvent.ResetEvent();
+		m_notFullEvent.ResetEvent();
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	unsigned int ServerRingQueue<DataType,queueType>::Size() const
+	{
+		long size=(long)((unsigned long)m_pushPos-(unsigned long)m_popPos);
+		if(size<0)
+			return 0;
+		return (unsigned int)size;
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	bool ServerRingQueue<DataType,queueType>::IsEmpty() const
+	{
+		return Size()==0;
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	unsigned int ServerRingQueue<DataType,queueType>::GetCapacity() const
+	{
+		return (unsigned int)(m_mask+1);
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	void ServerRingQueue<DataType,queueType>::notify(epl::EventEx &waitEvent,volatile long &waiterCount)
+	{
+		// the cell sequence is published before the waiter count is read
+		MemoryBarrier();
+		if(waiterCount)
+			waitEvent.SetEvent();
+	}
+
+	template <typename DataType, RingQueueType queueType>
+	bool ServerRingQueue<DataType,queueType>::getRemainTime(unsigned int startTime,unsigned int waitTimeMilliSec,unsigned int &retRemainTime)
+	{
+		if(waitTimeMilliSec==WAITTIME_INIFINITE)
+		{
+			retRemainTime=WAITTIME_INIFINITE;
+			return true;
+		}
+		unsigned int elapsedTime=epl::System::GetTickCount()-startTime;
+		if(elapsedTime>=waitTimeMilliSec)
+			return false;
+		retRemainTime=waitTimeMilliSec-elapsedTime;
+		return true;
+	}
+}
+
+#endif //__EP_SERVER_RING_QUEUE_H__
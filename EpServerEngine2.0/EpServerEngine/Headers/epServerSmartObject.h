@@ -0,0 +1,207 @@
+/*! 
+@file epServerSmartObject.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Server Smart Object Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Server Smart Object.
+
+The Server Smart Object is the reference counted base of the engine objects
+which are handed off between the threads for every message. The reference
+count is updated with the interlocked operations so that no lock is
+allocated or acquired per object.
+
+*/
+#ifndef __EP_SERVER_SMART_OBJECT_H__
+#define __EP_SERVER_SMART_OBJECT_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+
+namespace epse{
+
+	/*! 
+	@class ServerSmartObject epServerSmartObject.h
+	@brief This is a base class for the engine objects counting the references without the lock.
+
+	The interface is identical to epl::SmartObject.
+	When EP_SERVER_ATOMIC_REFERENCE_COUNT is 0, the reference count is guarded by the lock of the lock policy as epl::SmartObject does.
+	*/
+	class EP_SERVER_ENGINE ServerSmartObject{
+	public:
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark the reference count is not copied.
+		*/
+		ServerSmartObject & operator=(const ServerSmartObject&b)
+		{
+			return *this;
+		}
+
+		/*!
+		Returns the current reference count.
+		@return the current reference count.
+		*/
+		int GetReferenceCount()
+		{
+#if EP_SERVER_ATOMIC_REFERENCE_COUNT
+			return (int)m_refCount;
+#else //EP_SERVER_ATOMIC_REFERENCE_COUNT
+			epl::LockObj lock(m_refCounterLock);
+			return (int)m_refCount;
+#endif //EP_SERVER_ATOMIC_REFERENCE_COUNT
+		}
+
+	#if !defined(_DEBUG)
+		/*!
+		Increment this object's reference count
+		*/
+		void RetainObj();
+
+		/*!
+		Decrement this object's reference count
+		if the reference count is 0 then delete this object.
+		*/
+		void ReleaseObj();
+
+	protected:
+		/*!
+		Default Contructor
+		@param[in] lockPolicyType The lock policy
+		*/
+		ServerSmartObject(epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Copy Constructor
+		@param[in] b the second object
+		*/
+		ServerSmartObject(const ServerSmartObject& b);
+
+		/*!
+		Default Destructor
+		*/
+		virtual ~ServerSmartObject();
+	#else //!defined(_DEBUG)
+		/*!
+		Increment this object's reference count
+		*/
+		void RetainObj(TCHAR *fileName, TCHAR *funcName, unsigned int lineNum)
+		{
+			long refCount=incrementRefCount();
+			LOG_THIS_MSG(_T("%s::%s(%d) Retained Object : %d (Current Reference Count = %d)"),fileName,funcName,lineNum,this, refCount);
+		}
+
+		/*!
+		Decrement this object's reference count
+		if the reference count is 0 then delete this object.
+		*/
+		void ReleaseObj(TCHAR *fileName, TCHAR *funcName, unsigned int lineNum)
+		{
+			long refCount=decrementRefCount();
+			LOG_THIS_MSG(_T("%s::%s(%d) Released Object : %d (Current Reference Count = %d)"),fileName,funcName,lineNum,this, refCount);
+			if(refCount==0)
+			{
+				EP_DELETE this;
+				return;
+			}
+			EP_ASSERT_EXPR(refCount>=0, _T("Reference Count is negative Value! Reference Count : %d"),refCount);
+		}
+
+	protected:
+		/*!
+		Default Contructor
+		@param[in] lockPolicyType The lock policy
+		*/
+		ServerSmartObject(epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY)
+		{
+			initialize(lockPolicyType);
+			LOG_THIS_MSG(_T("Allocated Object : %d (Current Reference Count = %d)"),this, m_refCount);
+		}
+
+		/*!
+		Default Copy Constructor
+		@param[in] b the second object
+		*/
+		ServerSmartObject(const ServerSmartObject& b)
+		{
+			initialize(b.m_lockPolicy);
+			LOG_THIS_MSG(_T("Allocated Object : %d (Current Reference Count = %d)"),this, m_refCount);
+		}
+
+		/*!
+		Default Destructor
+		*/
+		virtual ~ServerSmartObject()
+		{
+			LOG_THIS_MSG(_T("Deleted Object : %d (Current Reference Count = %d)"),this, m_refCount);
+			EP_ASSERT_EXPR(m_refCount<=1,_T("The Reference Count is not 0!! Reference Count : %d"),m_refCount);
+			destroy();
+		}
+	#endif //!defined(_DEBUG)
+
+	private:
+		/*!
+		Initialize the reference count and the lock
+		@param[in] lockPolicyType The lock policy
+		*/
+		void initialize(epl::LockPolicy lockPolicyType);
+
+		/*!
+		Delete the lock
+		*/
+		void destroy();
+
+		/*!
+		Increment the reference count
+		@return the reference count incremented
+		*/
+		long incrementRefCount();
+
+		/*!
+		Decrement the reference count
+		@return the reference count decremented
+		*/
+		long decrementRefCount();
+
+		/// Reference Counter
+		volatile long m_refCount;
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+#if !EP_SERVER_ATOMIC_REFERENCE_COUNT
+		/// Lock
+		epl::BaseLock *m_refCounterLock;
+#endif //!EP_SERVER_ATOMIC_REFERENCE_COUNT
+	};
+}
+
+#endif //__EP_SERVER_SMART_OBJECT_H__
@@ -0,0 +1,292 @@
+/*! 
+@file epSocketHelper.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Socket Helper Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for Socket Helper.
+
+The Socket Helper gathers the platform dependent socket calls
+(initialization, close, error code, blocking mode and readiness wait)
+so that the transport classes do not call winsock directly.
+On POSIX, the readiness wait uses poll() which has no FD_SETSIZE limit.
+On Linux, the relay pipe moves the bytes between the sockets with splice().
+
+*/
+#ifndef __EP_SOCKET_HELPER_H__
+#define __EP_SOCKET_HELPER_H__
+
+#include "epServerEngine.h"
+
+#if defined(_WIN32)
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif //WIN32_LEAN_AND_MEAN
+
+#include <winsock2.h>
+#include <ws2tcpip.h>
+
+// Need to link with Ws2_32.lib
+#pragma comment (lib, "Ws2_32.lib")
+
+#else //defined(_WIN32)
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <errno.h>
+#include <limits.h>
+#include <sys/uio.h>
+
+/// Socket handle type
+typedef int SOCKET;
+/// Invalid socket handle
+#define INVALID_SOCKET (-1)
+/// Socket function failure return value
+#define SOCKET_ERROR (-1)
+/// Shutdown the receive operation
+#define SD_RECEIVE SHUT_RD
+/// Shutdown the send operation
+#define SD_SEND SHUT_WR
+/// Shutdown both the receive and send operation
+#define SD_BOTH SHUT_RDWR
+
+#endif //defined(_WIN32)
+
+namespace epse{
+
+	/*! 
+	@class SocketHelper epSocketHelper.h
+	@brief A class for platform dependent socket functions.
+	*/
+	class EP_SERVER_ENGINE SocketHelper{
+	public:
+		/// Enumerator for socket wait type
+		typedef enum _SocketWaitType{
+			/// wait until the socket is readable
+			SOCKET_WAIT_READ=0,
+			/// wait until the socket is writable
+			SOCKET_WAIT_WRITE,
+		}SocketWaitType;
+
+#if defined(_WIN32)
+		/// Buffer descriptor for the gathered send
+		typedef WSABUF SocketBuffer;
+#else //defined(_WIN32)
+		/// Buffer descriptor for the gathered send
+		typedef struct iovec SocketBuffer;
+#endif //defined(_WIN32)
+
+		/*!
+		@struct RelayPipe epSocketHelper.h
+		@brief the channel which moves the bytes from a socket to another.
+		*/
+		struct RelayPipe{
+			/// read and write end of the kernel pipe, or -1 if the user buffer is used
+			int m_pipe[2];
+			/// user buffer, or NULL if the kernel pipe is used
+			char *m_buffer;
+			/// maximum byte size moved at once
+			unsigned int m_byteSize;
+			/// offset of the bytes not sent yet in the user buffer
+			unsigned int m_offset;
+			/// byte size of the bytes received but not sent yet
+			unsigned int m_pendingByteSize;
+		};
+
+		/*!
+		Initialize the socket library
+		@return true if successfully initialized otherwise false
+		@remark every successful call must be paired with Cleanup().
+		*/
+		static bool Startup();
+
+		/*!
+		Clean up the socket library
+		*/
+		static void Cleanup();
+
+		/*!
+		Close the given socket
+		@param[in] socket the socket to close
+		@return 0 if successful otherwise SOCKET_ERROR
+		*/
+		static int CloseSocket(SOCKET socket);
+
+		/*!
+		Return the last socket error code of the calling thread
+		@return the last socket error code
+		*/
+		static int GetLastSocketError();
+
+		/*!
+		Set the blocking mode of the given socket
+		@param[in] socket the socket to set
+		@param[in] isNonBlocking true to make the socket non-blocking otherwise false
+		@return true if successful otherwise false
+		*/
+		static bool SetNonBlocking(SOCKET socket,bool isNonBlocking);
+
+		/*!
+		Wait until the given socket is ready
+		@param[in] socket the socket to wait for
+		@param[in] waitType the type of readiness to wait for
+		@param[in] waitTimeInMilliSec wait time in millisecond
+		@return positive value if the socket is ready, 0 if timed out, SOCKET_ERROR if failed
+		*/
+		static int WaitForSocket(SOCKET socket,SocketWaitType waitType,unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE);
+
+		/*!
+		Set the given buffer descriptor
+		@param[out] buffer the buffer descriptor to set
+		@param[in] data the data to send
+		@param[in] byteSize the byte size of the data
+		*/
+		static void SetSocketBuffer(SocketBuffer &buffer,const char *data,unsigned int byteSize);
+
+		/*!
+		Send the given buffers with a single gathered send call
+		@param[in] socket the socket to send to
+		@param[in] bufferList the buffer descriptors to send in order
+		@param[in] bufferCount the number of buffer descriptors
+		@return the total sent byte size if successful, 0 if the connection is closed, SOCKET_ERROR if failed
+		@remark the call is repeated for the remaining data on partial send, and bufferList is modified.
+		*/
+		static int SendGather(SOCKET socket,SocketBuffer *bufferList,unsigned int bufferCount);
+
+		/*!
+		Let the given socket bind to the port already bound, balancing the load over the sockets
+		@param[in] socket the socket to set before bind
+		@return true if successful, false if not supported
+		*/
+		static bool SetReusePort(SOCKET socket);
+
+		/*!
+		Check if the UDP send offload is supported for the given socket
+		@param[in] socket the UDP socket
+		@return true if SendSegments can be used otherwise false
+		*/
+		static bool IsSendOffloadSupported(SOCKET socket);
+
+		/*!
+		Enable the UDP receive offload which coalesces the datagrams from the same peer
+		@param[in] socket the UDP socket
+		@param[in] maxCoalescedByteSize the maximum byte size of the coalesced datagram
+		@return true if enabled, false if not supported
+		@remark the socket must be read with ReceiveSegments once enabled.
+		*/
+		static bool EnableReceiveOffload(SOCKET socket,unsigned int maxCoalescedByteSize);
+
+		/*!
+		Send the datagrams with a single send call using the UDP send offload
+		@param[in] socket the UDP socket
+		@param[in] bufferList the datagrams to send in order
+		@param[in] bufferCount the number of the datagrams
+		@param[in] segmentSize the byte size of each datagram
+		@param[in] sockAddr the socket address to send to
+		@param[in] sockAddrSize the byte size of the socket address
+		@return the total sent byte size if successful, SOCKET_ERROR if failed
+		@remark all the datagrams must be segmentSize bytes except the last, which may be shorter.
+		*/
+		static int SendSegments(SOCKET socket,SocketBuffer *bufferList,unsigned int bufferCount,unsigned int segmentSize,const sockaddr *sockAddr,int sockAddrSize);
+
+		/*!
+		Receive the datagram, which may be coalesced by the UDP receive offload
+		@param[in] socket the UDP socket
+		@param[out] buffer the buffer to receive into
+		@param[in] bufferSize the byte size of the buffer
+		@param[out] retSockAddr the socket address of the sender
+		@param[in,out] sockAddrSize the byte size of the socket address
+		@param[out] retSegmentSize the byte size of each coalesced datagram, or 0 if not coalesced
+		@return the received byte size if successful, SOCKET_ERROR if failed
+		*/
+		static int ReceiveSegments(SOCKET socket,char *buffer,unsigned int bufferSize,sockaddr *retSockAddr,int *sockAddrSize,unsigned int *retSegmentSize);
+
+		/*!
+		Wait until any of the given sockets is ready
+		@param[in] socketList the sockets to wait for
+		@param[in] waitTypeList the type of readiness to wait for, for each socket
+		@param[out] retIsReadyList set to true for each socket ready, closed or failed
+		@param[in] socketCount the number of the sockets
+		@param[in] waitTimeInMilliSec wait time in millisecond
+		@return the number of the sockets ready, 0 if timed out, SOCKET_ERROR if failed
+		*/
+		static int WaitForSocketList(const SOCKET *socketList,const SocketWaitType *waitTypeList,bool *retIsReadyList,unsigned int socketCount,unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE);
+
+		/*!
+		Check if the given error code means that the non-blocking call would block
+		@param[in] errorCode the socket error code
+		@return true if the call would block otherwise false
+		*/
+		static bool IsWouldBlock(int errorCode);
+
+		/*!
+		Create the relay pipe
+		@param[out] retPipe the relay pipe to create
+		@param[in] byteSize the maximum byte size moved at once
+		@return true if successfully created otherwise false
+		@remark On Linux, the bytes are moved with splice through a kernel pipe, never copied to the user space.<br/>
+		        Otherwise, or if the kernel pipe is not available, the bytes are moved through a user buffer.
+		*/
+		static bool CreateRelayPipe(RelayPipe &retPipe,unsigned int byteSize);
+
+		/*!
+		Destroy the given relay pipe
+		@param[in] pipe the relay pipe to destroy
+		*/
+		static void DestroyRelayPipe(RelayPipe &pipe);
+
+		/*!
+		Receive the bytes from the given socket into the relay pipe
+		@param[in] socket the non-blocking socket to receive from
+		@param[in] pipe the empty relay pipe
+		@return the received byte size, 0 if the connection is closed, SOCKET_ERROR if failed
+		*/
+		static int RelayReceive(SOCKET socket,RelayPipe &pipe);
+
+		/*!
+		Send the bytes in the relay pipe to the given socket
+		@param[in] socket the non-blocking socket to send to
+		@param[in] pipe the relay pipe holding the bytes received
+		@return the sent byte size, SOCKET_ERROR if failed
+		@remark the bytes not sent remain in the pipe for the next call.
+		*/
+		static int RelaySend(SOCKET socket,RelayPipe &pipe);
+	};
+}
+
+#endif //__EP_SOCKET_HELPER_H__
\ No newline at end of file
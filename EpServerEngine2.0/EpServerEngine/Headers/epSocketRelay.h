@@ -0,0 +1,138 @@
+/*!
+@file epSocketRelay.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Socket Relay Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for the Socket Relay.
+
+The Socket Relay moves the bytes between two connected TCP sockets as they are,
+in both directions, on the calling thread with the non-blocking sockets.
+On Linux, the bytes are moved with splice() and never copied to the user space.
+
+*/
+#ifndef __EP_SOCKET_RELAY_H__
+#define __EP_SOCKET_RELAY_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include "epSocketHelper.h"
+
+namespace epse{
+
+	/*!
+	@class SocketRelay epSocketRelay.h
+	@brief A class for relaying the bytes between two TCP sockets.
+	*/
+	class EP_SERVER_ENGINE SocketRelay{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Relay
+		@param[in] byteSize the maximum byte size moved at once for each direction
+		@param[in] lockPolicyType The lock policy
+		*/
+		SocketRelay(unsigned int byteSize=RELAY_BUFFER_BYTE_SIZE,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Relay
+		*/
+		virtual ~SocketRelay();
+
+		/*!
+		Relay the bytes between the given sockets until both directions are closed
+		@param[in] clientSocket the connected socket
+		@param[in] serverSocket the other connected socket
+		@return true if both directions are closed gracefully, false if failed or stopped
+		@remark the call blocks until the relay is over.<br/>
+		        The sockets are made non-blocking while relaying, and are not closed.
+		*/
+		bool Run(SOCKET clientSocket,SOCKET serverSocket);
+
+		/*!
+		Stop the relay
+		@remark both sockets are shut down so that Run returns.
+		*/
+		void Stop();
+
+	private:
+		/*!
+		Move the bytes in one direction
+		@param[in] fromSocket the socket to receive from
+		@param[in] toSocket the socket to send to
+		@param[in] pipe the relay pipe of the direction
+		@param[out] retIsClosed set to true if fromSocket is closed
+		@return true if successful otherwise false
+		*/
+		bool relay(SOCKET fromSocket,SOCKET toSocket,SocketHelper::RelayPipe &pipe,bool &retIsClosed);
+
+		/*!
+		Default Copy Constructor
+
+		Initializes the Relay
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		SocketRelay(const SocketRelay& b){EP_ASSERT(0);}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		SocketRelay & operator=(const SocketRelay&b){EP_ASSERT(0);return *this;}
+
+	private:
+		/// maximum byte size moved at once
+		unsigned int m_byteSize;
+
+		/// the socket relaying
+		SOCKET m_clientSocket;
+
+		/// the other socket relaying
+		SOCKET m_serverSocket;
+
+		/// flag whether the relay is stopped
+		bool m_isStopped;
+
+		/// relay lock
+		epl::BaseLock *m_relayLock;
+
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+	};
+}
+
+#endif //__EP_SOCKET_RELAY_H__
@@ -40,6 +40,7 @@ An Interface for Synchronous TCP Client.
 
 #include "epServerEngine.h"
 #include "epBaseTcpClient.h"
+#include "epPacketReceiveBuffer.h"
 
 namespace epse{
 
@@ -108,6 +109,17 @@ namespace epse{
 		*/
 		int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 
+		/*!
+		Send the packets to the server with a single gathered write
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred
+		*/
+		int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
 		/*!
 		Receive the packet from the server
 		@param[in] waitTimeInMilliSec wait time for receiving the packet in millisecond
@@ -135,6 +147,9 @@ namespace epse{
 		/// Status for connection
 		bool m_isConnected;
 
+		/// receive buffer keeping the packets read ahead by Receive
+		PacketReceiveBuffer m_packetRecvBuffer;
+
 
 	};
 }
@@ -85,9 +85,10 @@ namespace epse{
 	private:
 
 		/*!
-		Listening Loop Function
+		Accept on the given listening socket until the server stops
+		@param[in] listenSocket the listening socket to loop on
 		*/
-		virtual void execute() ;
+		virtual void listenLoop(SOCKET listenSocket);
 	
 	};
 }
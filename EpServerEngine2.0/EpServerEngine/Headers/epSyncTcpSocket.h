@@ -40,6 +40,7 @@ An Interface for Synchronous TCP Socket.
 
 #include "epServerEngine.h"
 #include "epBaseTcpSocket.h"
+#include "epPacketReceiveBuffer.h"
 
 namespace epse
 {
@@ -89,6 +90,17 @@ namespace epse
 		*/
 		int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 
+		/*!
+		Send the packets to the client with a single gathered write
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred
+		*/
+		int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
 
 		/*!
 		Receive the packet from the client
@@ -137,6 +149,9 @@ namespace epse
 
 		/// Connection status
 		bool m_isConnected;
+
+		/// receive buffer keeping the packets read ahead by Receive
+		PacketReceiveBuffer m_packetRecvBuffer;
 	};
 
 }
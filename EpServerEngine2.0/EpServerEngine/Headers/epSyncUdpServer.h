@@ -85,9 +85,12 @@ namespace epse{
 	private:
 
 		/*!
-		Listening Loop Function
+		Process the datagram received from the client
+		@param[in] packetData the received datagram
+		@param[in] recvLength the byte size of the datagram, or 0 or less if the receive failed
+		@param[in] clientSockAddr the socket address of the client
 		*/
-		virtual void execute() ;
+		virtual void processDatagram(const char *packetData,int recvLength,const sockaddr &clientSockAddr);
 		
 	};
 }
@@ -91,6 +91,17 @@ namespace epse
 		*/
 		int Send(const Packet &packet, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
 
+		/*!
+		Send the packets to the client as the datagrams
+		@param[in] packetList the packets to be sent in order
+		@param[in] packetCount the number of packets
+		@param[in] waitTimeInMilliSec wait time for sending the packets in millisecond
+		@param[in] sendStatus the status of Send
+		@return sent byte size
+		@remark return -1 if error occurred
+		*/
+		int BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec=WAITTIME_INIFINITE,SendStatus *sendStatus=NULL);
+
 
 		/*!
 		Receive the packet from the client
@@ -143,9 +154,6 @@ namespace epse
 		SyncUdpSocket & operator=(const SyncUdpSocket&b){return *this;}
 
 	private:
-		/// Packet Received Event
-		epl::EventEx m_packetReceivedEvent;
-
 		/// Connection status
 		bool m_isConnected;
 	};
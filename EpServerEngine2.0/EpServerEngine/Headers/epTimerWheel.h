@@ -0,0 +1,268 @@
+/*! 
+@file epTimerWheel.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Timer Wheel Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for the Hierarchical Timing Wheel.
+
+*/
+#ifndef __EP_TIMER_WHEEL_H__
+#define __EP_TIMER_WHEEL_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include <vector>
+
+using namespace std;
+
+namespace epse{
+
+	/*! 
+	@class TimerWheel epTimerWheel.h
+	@brief A class for the hierarchical timing wheel which arms and cancels the timers in constant time.
+	*/
+	class EP_SERVER_ENGINE TimerWheel:protected epl::Thread{
+	public:
+		/*! 
+		@class Timer epTimerWheel.h
+		@brief A class for the timer which is armed on the TimerWheel.
+		*/
+		class EP_SERVER_ENGINE Timer{
+			friend class TimerWheel;
+		public:
+			/*!
+			Default Constructor
+
+			Initializes the Timer
+			@param[in] target the object retained while the timer is armed
+			*/
+			Timer(epl::SmartObject *target=NULL);
+
+			/*!
+			Default Destructor
+
+			Destroy the Timer
+			@remark the timer must not be armed.
+			*/
+			virtual ~Timer();
+
+			/*!
+			Check if the timer is armed
+			@return true if armed otherwise false
+			*/
+			bool IsArmed() const;
+
+		protected:
+			/*!
+			Set the object retained while the timer is armed
+			@param[in] target the object to retain
+			@remark the timer must not be armed.
+			*/
+			void setTarget(epl::SmartObject *target);
+
+			/*!
+			Called from the wheel thread when the timer expires
+			@remark the timer may be armed again in this function.
+			*/
+			virtual void onExpired()=0;
+
+		private:
+			/*!
+			Default Copy Constructor
+
+			Initializes the Timer
+			@param[in] b the second object
+			@remark Copy Constructor prohibited
+			*/
+			Timer(const Timer& b){EP_ASSERT(0);}
+
+			/*!
+			Assignment operator overloading
+			@param[in] b the second object
+			@return the new copied object
+			@remark Copy Operator prohibited
+			*/
+			Timer & operator=(const Timer&b){EP_ASSERT(0);return *this;}
+
+		private:
+			/// previous timer in the slot
+			Timer *m_prev;
+			/// next timer in the slot
+			Timer *m_next;
+			/// tick when the timer expires
+			unsigned int m_expireTick;
+			/// level of the slot
+			unsigned int m_level;
+			/// index of the slot
+			unsigned int m_slot;
+			/// flag whether the timer is linked in a slot
+			bool m_isArmed;
+			/// flag whether the timer is expired and its onExpired is not called yet
+			bool m_isExpiring;
+			/// object retained while the timer is armed
+			epl::SmartObject *m_target;
+		};
+
+		/*!
+		Default Constructor
+
+		Initializes the Timer Wheel
+		@param[in] tickMilliSec the resolution of the wheel in millisecond
+		@param[in] waitTimeMilliSec the wait time in millisecond for terminating
+		@param[in] lockPolicyType The lock policy
+		*/
+		TimerWheel(unsigned int tickMilliSec=TIMER_WHEEL_TICK_MILLISEC,unsigned int waitTimeMilliSec=WAITTIME_INIFINITE,epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Timer Wheel
+		*/
+		virtual ~TimerWheel();
+
+		/*!
+		Start the wheel thread
+		@return true if successfully started otherwise false
+		*/
+		bool Create();
+
+		/*!
+		Stop the wheel thread and cancel all the armed timers
+		*/
+		void Close();
+
+		/*!
+		Arm the timer, or re-arm it if already armed
+		@param[in] timer the timer to arm
+		@param[in] delayMilliSec the delay in millisecond until the timer expires
+		@remark the delay is rounded up to the tick, and clamped to the range of the wheel.
+		*/
+		void Arm(Timer *timer,unsigned int delayMilliSec);
+
+		/*!
+		Cancel the timer
+		@param[in] timer the timer to cancel
+		@return true if cancelled, false if not armed
+		@remark the timer expired but not yet called back is cancelled as well,
+		        while the timer already running its onExpired is not stopped.
+		*/
+		bool Cancel(Timer *timer);
+
+		/*!
+		Get the current tick of the wheel
+		@return the ticks passed since the wheel was created
+		*/
+		unsigned int GetCurrentTick() const;
+
+		/*!
+		Get the resolution of the wheel
+		@return the resolution in millisecond
+		*/
+		unsigned int GetTickMilliSec() const;
+
+		/*!
+		Convert the time to the number of the ticks
+		@param[in] milliSec the time in millisecond
+		@return the number of the ticks, rounded up
+		*/
+		unsigned int ToTick(unsigned int milliSec) const;
+
+	private:
+		/*!
+		Tick Loop Function
+		*/
+		virtual void execute();
+
+		/*!
+		Link the timer into the slot for its expire tick
+		@param[in] timer the timer to link
+		*/
+		void link(Timer *timer);
+
+		/*!
+		Unlink the timer from its slot
+		@param[in] timer the timer to unlink
+		*/
+		void unlink(Timer *timer);
+
+		/*!
+		Advance the wheel by one tick
+		@param[out] retExpiredList the timers expired on the tick
+		*/
+		void advance(vector<Timer*> &retExpiredList);
+
+		/*!
+		Default Copy Constructor
+
+		Initializes the Timer Wheel
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		TimerWheel(const TimerWheel& b):Thread(b){EP_ASSERT(0);}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		TimerWheel & operator=(const TimerWheel&b){EP_ASSERT(0);return *this;}
+
+	private:
+		/// the number of the slots in a level
+		static const unsigned int SLOT_COUNT=1<<TIMER_WHEEL_SLOT_BITS;
+
+		/// slots of each level
+		Timer *m_slotList[TIMER_WHEEL_LEVEL_COUNT][SLOT_COUNT];
+
+		/// current tick
+		volatile unsigned int m_currentTick;
+
+		/// resolution in millisecond
+		unsigned int m_tickMilliSec;
+
+		/// wait time in millisecond for terminating thread
+		unsigned int m_waitTime;
+
+		/// timer lock
+		epl::BaseLock *m_timerLock;
+
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+
+		/// Thread Stop Event
+		/// @remark if this is raised, the thread should quickly stop.
+		epl::EventEx m_threadStopEvent;
+	};
+}
+
+#endif //__EP_TIMER_WHEEL_H__
@@ -0,0 +1,183 @@
+/*! 
+@file epTopicRouter.h
+@author Woong Gyu La a.k.a Chris. <juhgiyo@gmail.com>
+		<http://github.com/juhgiyo/epserverengine>
+@date October 16, 2026
+@brief Topic Router Interface
+@version 1.0
+
+@section LICENSE
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+@section DESCRIPTION
+
+An Interface for the Topic Router.
+
+*/
+#ifndef __EP_TOPIC_ROUTER_H__
+#define __EP_TOPIC_ROUTER_H__
+
+#include "epServerEngine.h"
+#include "epServerConf.h"
+#include "epPatriciaTrie.h"
+#include <map>
+#include <set>
+#include <vector>
+
+using namespace std;
+
+namespace epse{
+
+	class BaseSocket;
+
+	/*! 
+	@class TopicRouter epTopicRouter.h
+	@brief A class for the index of the sockets subscribing to the hierarchical topics.
+
+	A topic is the levels separated by TOPIC_SEPARATOR such as "room/1/chat".
+	A subscription ending with TOPIC_WILDCARD such as "room/#" also matches "room" and all the topics under it,
+	and TOPIC_WILDCARD alone matches all the topics.
+	*/
+	class EP_SERVER_ENGINE TopicRouter{
+	public:
+		/*!
+		Default Constructor
+
+		Initializes the Router
+		@param[in] lockPolicyType The lock policy
+		*/
+		TopicRouter(epl::LockPolicy lockPolicyType=epl::EP_LOCK_POLICY);
+
+		/*!
+		Default Destructor
+
+		Destroy the Router
+		*/
+		virtual ~TopicRouter();
+
+		/*!
+		Subscribe the socket to the topic
+		@param[in] socket the socket to subscribe
+		@param[in] topic the topic, which may end with TOPIC_WILDCARD
+		@return true if subscribed, false if already subscribed or the topic is invalid
+		@remark the socket is retained while it has any subscription.
+		*/
+		bool Subscribe(BaseSocket *socket,const TCHAR *topic);
+
+		/*!
+		Unsubscribe the socket from the topic
+		@param[in] socket the socket to unsubscribe
+		@param[in] topic the topic subscribed
+		@return true if unsubscribed, false if not subscribed
+		*/
+		bool Unsubscribe(BaseSocket *socket,const TCHAR *topic);
+
+		/*!
+		Unsubscribe the socket from all the topics
+		@param[in] socket the socket to unsubscribe
+		*/
+		void UnsubscribeAll(BaseSocket *socket);
+
+		/*!
+		Find the sockets subscribing to the topic
+		@param[in] topic the topic to publish to
+		@param[out] retSocketList the list of the retained sockets, each socket appearing once
+		@remark the caller must call ReleaseObj() for each socket to avoid the memory leak.
+		*/
+		void Find(const TCHAR *topic,vector<BaseSocket*> &retSocketList) const;
+
+		/*!
+		Remove all the subscriptions
+		*/
+		void Clear();
+
+	private:
+		/*!
+		Default Copy Constructor
+
+		Initializes the Router
+		@param[in] b the second object
+		@remark Copy Constructor prohibited
+		*/
+		TopicRouter(const TopicRouter& b){EP_ASSERT(0);}
+
+		/*!
+		Assignment operator overloading
+		@param[in] b the second object
+		@return the new copied object
+		@remark Copy Operator prohibited
+		*/
+		TopicRouter & operator=(const TopicRouter&b){EP_ASSERT(0);return *this;}
+
+		/// set of the subscribing sockets
+		typedef set<BaseSocket*> SubscriberSet;
+
+		/// trie type which maps the topic to its subscribers
+		typedef epl::PatriciaTrie<TCHAR,SubscriberSet*> TopicTrie;
+
+		/// map type which maps the socket to its subscribed topics
+		typedef map<BaseSocket*,set<epl::EpTString> > SubscriptionMap;
+
+		/*!
+		Get the trie and the key for the topic
+		@param[in] topic the topic subscribed
+		@param[out] retKey the key in the trie, which is the topic without TOPIC_WILDCARD
+		@return the trie for the topic, or NULL if the topic is invalid
+		*/
+		TopicTrie *getTrie(const TCHAR *topic,epl::EpTString &retKey);
+
+		/*!
+		Remove the socket from the subscribers of the topic
+		@param[in] socket the socket to remove
+		@param[in] topic the topic subscribed
+		*/
+		void removeSubscriber(BaseSocket *socket,const TCHAR *topic);
+
+		/*!
+		Add the subscribers of the key in the trie to the list
+		@param[in] trie the trie to find in
+		@param[in] key the key to find
+		@param[in,out] retSubscriberList the list of the found subscriber sets
+		*/
+		static void findSubscriber(const TopicTrie &trie,const TCHAR *key,vector<SubscriberSet*> &retSubscriberList);
+
+	private:
+		/// trie for the exact topics
+		TopicTrie m_exactTrie;
+
+		/// trie for the topics with TOPIC_WILDCARD
+		TopicTrie m_prefixTrie;
+
+		/// subscribed topics of each socket, which unsubscribes the socket on disconnect
+		SubscriptionMap m_subscriptionMap;
+
+		/// router lock
+		epl::BaseLock *m_routerLock;
+
+		/// Lock Policy
+		epl::LockPolicy m_lockPolicy;
+	};
+}
+
+#endif //__EP_TOPIC_ROUTER_H__
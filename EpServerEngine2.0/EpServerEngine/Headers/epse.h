@@ -39,12 +39,29 @@ An Interface for EP Server Engine
 
 // General
 #include "epServerConf.h"
+#include "epSocketHelper.h"
+#include "epSocketRelay.h"
+#include "epServerLockPolicy.h"
+#include "epServerRingQueue.h"
+#include "epServerSmartObject.h"
+#include "epPacketPool.h"
+#include "epPacketBuffer.h"
 #include "epPacket.h"
 #include "epBaseServerObject.h"
 #include "epPacketContainer.h"
 #include "epBasePacketProcessor.h"
+#include "epPacketDispatcher.h"
+#include "epJobPriorityQueue.h"
+#include "epJobScheduler.h"
+#include "epJobSchedulerProcessor.h"
+#include "epPacketDispatchJob.h"
+#include "epPacketDispatchProcessor.h"
+#include "epPacketDispatchQueue.h"
 #include "epServerObjectList.h"
 #include "epServerObjectRemover.h"
+#include "epServerAcceptor.h"
+#include "epTimerWheel.h"
+#include "epTopicRouter.h"
 
 
 // Client Side
@@ -72,6 +89,8 @@ An Interface for EP Server Engine
 
 #include "epBaseSocket.h"
 #include "epBaseServer.h"
+#include "epBroadcastJob.h"
+#include "epBroadcastProcessor.h"
 #include "epBaseTcpSocket.h"
 #include "epBaseTcpServer.h"
 #include "epBaseUdpSocket.h"
@@ -88,6 +107,10 @@ An Interface for EP Server Engine
 #include "epSyncUdpServer.h"
 #include "epSyncUdpSocket.h"
 
+#include "epIocpCompletionPort.h"
+#include "epIocpReceiveBuffer.h"
+#include "epSendQueue.h"
+#include "epPacketReceiveBuffer.h"
 #include "epIocpServerJob.h"
 #include "epIocpServerProcessor.h"
 #include "epIocpTcpServer.h"
@@ -96,6 +119,9 @@ An Interface for EP Server Engine
 #include "epIocpUdpSocket.h"
 
 #include "epProxyServerInterfaces.h"
+#include "epMultiplexSession.h"
+#include "epMultiplexLink.h"
+#include "epForwardClientPool.h"
 #include "epBaseProxyHandler.h"
 #include "epBaseProxyServer.h"
 #include "epProxyTcpHandler.h"
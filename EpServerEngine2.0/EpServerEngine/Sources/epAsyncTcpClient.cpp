@@ -33,23 +33,28 @@ static char THIS_FILE[] = __FILE__;
 
 using namespace epse;
 
-AsyncTcpClient::AsyncTcpClient(epl::LockPolicy lockPolicyType) :BaseTcpClient(lockPolicyType)
+AsyncTcpClient::AsyncTcpClient(epl::LockPolicy lockPolicyType) :BaseTcpClient(lockPolicyType),m_dispatchQueue(lockPolicyType)
 {
 	m_processorList=ServerObjectList(WAITTIME_INIFINITE,lockPolicyType);
+	m_packetDispatcher=NULL;
 	m_maxProcessorCount=PROCESSOR_LIMIT_INFINITE;
 	m_isAsynchronousReceive=true;
 }
 
 
-AsyncTcpClient::AsyncTcpClient(const AsyncTcpClient& b) :BaseTcpClient(b)
+AsyncTcpClient::AsyncTcpClient(const AsyncTcpClient& b) :BaseTcpClient(b),m_dispatchQueue(b.m_lockPolicy)
 {
 	m_processorList=b.m_processorList;
+	m_packetDispatcher=NULL;
 	m_maxProcessorCount=b.m_maxProcessorCount;
 	m_isAsynchronousReceive=b.m_isAsynchronousReceive;
 	
 }
 AsyncTcpClient::~AsyncTcpClient()
 {
+	m_dispatchQueue.Clear();
+	if(m_packetDispatcher)
+		EP_DELETE m_packetDispatcher;
 }
 
 AsyncTcpClient & AsyncTcpClient::operator=(const AsyncTcpClient&b)
@@ -97,17 +102,21 @@ void AsyncTcpClient::SetIsAsynchronousReceive(bool isASynchronousReceive)
 void AsyncTcpClient::execute() 
 {
 	int iResult;
+	m_packetRecvBuffer.Reset();
 	// Receive until the peer shuts down the connection
 	do {
-		int size =receive(m_recvSizePacket);
-		if(size>0)
+		// a single recv may bring several packets, so process all of them before the next recv
+		iResult =m_packetRecvBuffer.Fill(m_connectSocket);
+		if(iResult>0)
 		{
-			unsigned int shouldReceive=(reinterpret_cast<unsigned int*>(const_cast<char*>(m_recvSizePacket.GetPacket())))[0];
-			Packet *recvPacket=EP_NEW Packet(NULL,shouldReceive);
-			iResult = receive(*recvPacket);
-
-			if (iResult == shouldReceive) {
-				if(m_isAsynchronousReceive)
+			Packet *recvPacket;
+			while((recvPacket=m_packetRecvBuffer.Pop())!=NULL)
+			{
+				if(m_isAsynchronousReceive && m_dispatchQueue.Push(this,this,recvPacket,GetMaximumProcessorCount()))
+				{
+					recvPacket->ReleaseObj();
+				}
+				else if(m_isAsynchronousReceive)
 				{
 					ClientPacketProcessor::PacketPassUnit passUnit;
 					passUnit.m_packet=recvPacket;
@@ -133,26 +142,18 @@ void AsyncTcpClient::execute()
 					m_callBackObj->OnReceived(reinterpret_cast<ClientInterface*>(this),recvPacket,RECEIVE_STATUS_SUCCESS);
 					recvPacket->ReleaseObj();
 				}
-				
-			}
-			else if (iResult == 0)
-			{
-				epl::System::OutputDebugString(_T("%s::%s(%d)(%x) Connection closing...\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-				recvPacket->ReleaseObj();
-				break;
-			}
-			else  {
-				epl::System::OutputDebugString(_T("%s::%s(%d)(%x) recv failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-				recvPacket->ReleaseObj();
-				break;
 			}
 		}
-		else
+		else if (iResult == 0)
 		{
-			break;
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) Connection closing...\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		}
+		else  {
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) recv failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		}
 
 	} while (iResult > 0);
+	m_packetRecvBuffer.Reset();
 
 	disconnect();
 }
@@ -189,17 +190,26 @@ bool AsyncTcpClient::Connect(const ClientOps &ops)
 	SetWaitTime(ops.waitTimeMilliSec);
 	m_maxProcessorCount=ops.maximumProcessorCount;
 	m_isAsynchronousReceive=ops.isAsynchronousReceive;
+	if(ops.packetDispatchType!=PACKET_DISPATCH_TYPE_THREAD)
+	{
+		// the worker threads are kept until destruction, since Disconnect may be called from them
+		if(!m_packetDispatcher)
+			m_packetDispatcher=EP_NEW PacketDispatcher(m_waitTime,m_lockPolicy);
+		if(!m_packetDispatcher->GetWorkerThreadCount() && !m_packetDispatcher->Create(ops.dispatchThreadCount))
+			return false;
+		m_dispatchQueue.SetDispatcher(m_packetDispatcher,ops.packetDispatchType==PACKET_DISPATCH_TYPE_POOL_ORDERED);
+	}
+	else
+		m_dispatchQueue.SetDispatcher(NULL);
 
 
-	WSADATA wsaData;
 	m_connectSocket=INVALID_SOCKET;
 	struct addrinfo hints;
 	int iResult;
 
-	// Initialize Winsock
-	iResult = WSAStartup(MAKEWORD(2,2), &wsaData);
-	if (iResult != 0) {
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) WSAStartup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+	// Initialize socket library
+	if (!SocketHelper::Startup()) {
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket startup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		return false;
 	}
 
@@ -212,7 +222,7 @@ bool AsyncTcpClient::Connect(const ClientOps &ops)
 	iResult = getaddrinfo(m_hostName.c_str(), m_port.c_str(), &hints, &m_result);
 	if ( iResult != 0 ) {
 		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) getaddrinfo failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-		WSACleanup();
+		SocketHelper::Cleanup();
 		return false;
 	}
 
@@ -232,7 +242,7 @@ bool AsyncTcpClient::Connect(const ClientOps &ops)
 		// Connect to server.
 		iResult = connect( m_connectSocket, iPtr->ai_addr, static_cast<int>(iPtr->ai_addrlen));
 		if (iResult == SOCKET_ERROR) {
-			closesocket(m_connectSocket);
+			SocketHelper::CloseSocket(m_connectSocket);
 			m_connectSocket = INVALID_SOCKET;
 			continue;
 		}
@@ -258,6 +268,7 @@ void AsyncTcpClient::disconnect()
 	{
 		cleanUpClient();
 		m_processorList.Clear();
+		m_dispatchQueue.Clear();
 		m_callBackObj->OnDisconnect(reinterpret_cast<ClientInterface*>(this));
 	}
 }
@@ -274,7 +285,7 @@ void AsyncTcpClient::Disconnect()
 		// shutdown the connection since no more data will be sent
 		int iResult = shutdown(m_connectSocket, SD_SEND);
 		if (iResult == SOCKET_ERROR) {
-			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this, WSAGetLastError());
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this, SocketHelper::GetLastSocketError());
 		}
 
 	}
@@ -287,9 +298,13 @@ void AsyncTcpClient::Disconnect()
 
 	cleanUpClient();
 	m_processorList.Clear();
+	m_dispatchQueue.Clear();
 	m_callBackObj->OnDisconnect(reinterpret_cast<ClientInterface*>(this));
 
 }
 
-
+void AsyncTcpClient::OnPacketDispatched(Packet *packet)
+{
+	m_callBackObj->OnReceived(this,packet,RECEIVE_STATUS_SUCCESS);
+}
 
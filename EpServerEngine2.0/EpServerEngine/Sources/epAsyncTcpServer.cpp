@@ -37,6 +37,9 @@ using namespace epse;
 AsyncTcpServer::AsyncTcpServer(epl::LockPolicy lockPolicyType):BaseTcpServer(lockPolicyType)
 {
 	m_isAsynchronousReceive=true;
+	m_nextEventLoopIdx=0;
+	m_packetDispatcher=NULL;
+	m_packetDispatchType=PACKET_DISPATCH_TYPE_THREAD;
 }
 
 
@@ -44,10 +47,16 @@ AsyncTcpServer::AsyncTcpServer(const AsyncTcpServer& b):BaseTcpServer(b)
 {
 	LockObj lock(b.m_baseServerLock);
 	m_isAsynchronousReceive=b.m_isAsynchronousReceive;
+	m_nextEventLoopIdx=0;
+	m_packetDispatcher=NULL;
+	m_packetDispatchType=b.m_packetDispatchType;
 }
 
 AsyncTcpServer::~AsyncTcpServer()
 {
+	closeEventLoop();
+	if(m_packetDispatcher)
+		EP_DELETE m_packetDispatcher;
 }
 
 AsyncTcpServer & AsyncTcpServer::operator=(const AsyncTcpServer&b)
@@ -57,6 +66,7 @@ AsyncTcpServer & AsyncTcpServer::operator=(const AsyncTcpServer&b)
 		BaseTcpServer::operator =(b);
 		LockObj lock(b.m_baseServerLock);
 		m_isAsynchronousReceive=b.m_isAsynchronousReceive;
+		m_packetDispatchType=b.m_packetDispatchType;
 	}
 	return *this;
 }
@@ -73,17 +83,69 @@ void AsyncTcpServer::SetIsAsynchronousReceive(bool isASynchronousReceive)
 bool AsyncTcpServer::StartServer(const ServerOps &ops)
 {
 	m_isAsynchronousReceive=ops.isAsynchronousReceive;
+	m_packetDispatchType=ops.packetDispatchType;
+	if(m_packetDispatchType!=PACKET_DISPATCH_TYPE_THREAD)
+	{
+		if(!m_packetDispatcher)
+			m_packetDispatcher=EP_NEW PacketDispatcher(ops.waitTimeMilliSec,m_lockPolicy);
+		if(!m_packetDispatcher->Create(ops.dispatchThreadCount))
+			return false;
+	}
+
+	closeEventLoop();
+	if(ops.isEventLoop)
+	{
+		int eventLoopCount=ops.workerThreadCount;
+		if(eventLoopCount==0)
+		{
+			eventLoopCount=System::GetNumberOfCores();
+		}
+		for(int trav=0;trav<eventLoopCount;trav++)
+		{
+			IocpCompletionPort *eventLoop=EP_NEW IocpCompletionPort(this,ops.waitTimeMilliSec,m_lockPolicy);
+			if(!eventLoop->Create())
+			{
+				EP_DELETE eventLoop;
+				closeEventLoop();
+				return false;
+			}
+			m_eventLoopList.push_back(eventLoop);
+		}
+	}
 	return BaseTcpServer::StartServer(ops);
 }
 
-void AsyncTcpServer::execute()
+void AsyncTcpServer::StopServer()
+{
+	BaseTcpServer::StopServer();
+	closeEventLoop();
+	if(m_packetDispatcher)
+		m_packetDispatcher->Close();
+}
+
+void AsyncTcpServer::closeEventLoop()
+{
+	for(int trav=0;trav<m_eventLoopList.size();trav++)
+	{
+		EP_DELETE m_eventLoopList.at(trav);
+	}
+	m_eventLoopList.clear();
+	m_nextEventLoopIdx=0;
+}
+
+void AsyncTcpServer::OnIoCompleted(epl::SmartObject *context,unsigned long transferredByte,bool isSucceeded)
+{
+	static_cast<AsyncTcpSocket*>(context)->processReceive(transferredByte,isSucceeded);
+}
+
+void AsyncTcpServer::listenLoop(SOCKET listenSocket)
 {
 	SOCKET clientSocket;
 	sockaddr sockAddr;
 	int sizeOfSockAddr=sizeof(sockaddr);
 	while(1)
 	{
-		clientSocket=accept(m_listenSocket,&sockAddr,&sizeOfSockAddr);
+		clientSocket=accept(listenSocket,&sockAddr,&sizeOfSockAddr);
 		if(clientSocket == INVALID_SOCKET || m_listenSocket== INVALID_SOCKET)
 		{
 			break;			
@@ -92,21 +154,47 @@ void AsyncTcpServer::execute()
 		{
 			if(!m_callBackObj->OnAccept(sockAddr))
 			{
-				closesocket(clientSocket);
+				SocketHelper::CloseSocket(clientSocket);
 				continue;
 			}
+			IocpCompletionPort *eventLoop=NULL;
+			if(m_eventLoopList.size())
+			{
+				// sockets are spread over the event loops in round-robin, from all the accept loops
+				unsigned int eventLoopIdx=(unsigned int)InterlockedIncrement(&m_nextEventLoopIdx);
+				eventLoop=m_eventLoopList.at(eventLoopIdx%m_eventLoopList.size());
+				if(!eventLoop->Associate(clientSocket))
+				{
+					SocketHelper::CloseSocket(clientSocket);
+					continue;
+				}
+			}
 			AsyncTcpSocket *accWorker=EP_NEW AsyncTcpSocket(m_callBackObj,m_isAsynchronousReceive,m_waitTime,PROCESSOR_LIMIT_INFINITE,m_lockPolicy);
 			if(!accWorker)
 			{
-				closesocket(clientSocket);
+				SocketHelper::CloseSocket(clientSocket);
 				continue;
 			}
 			accWorker->setClientSocket(clientSocket);
 			accWorker->setOwner(this);
 			accWorker->setSockAddr(sockAddr);
-			m_socketList.Push(accWorker);	
-			accWorker->Start();
-			accWorker->ReleaseObj();
+			if(m_packetDispatchType!=PACKET_DISPATCH_TYPE_THREAD)
+				accWorker->setPacketDispatcher(m_packetDispatcher,m_packetDispatchType==PACKET_DISPATCH_TYPE_POOL_ORDERED);
+			if(eventLoop)
+			{
+				accWorker->setEventLoop(eventLoop);
+				m_socketList.Push(accWorker);
+				accWorker->startEventLoop();
+				startActivityTimer(accWorker);
+				accWorker->ReleaseObj();
+			}
+			else
+			{
+				m_socketList.Push(accWorker);	
+				accWorker->Start();
+				startActivityTimer(accWorker);
+				accWorker->ReleaseObj();
+			}
 			if(GetMaximumConnectionCount()!=CONNECTION_LIMIT_INFINITE)
 			{
 				while(m_socketList.Count()>=GetMaximumConnectionCount())
@@ -117,7 +205,5 @@ void AsyncTcpServer::execute()
 
 		}
 	}
-
-	stopServer();
-} 
+}
 
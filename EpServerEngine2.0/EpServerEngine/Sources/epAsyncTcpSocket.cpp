@@ -33,16 +33,32 @@ static char THIS_FILE[] = __FILE__;
 #endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
 
 using namespace epse;
-AsyncTcpSocket::AsyncTcpSocket(ServerCallbackInterface *callBackObj,bool isAsynchronousReceive,unsigned int waitTimeMilliSec,unsigned int maximumProcessorCount,epl::LockPolicy lockPolicyType): BaseTcpSocket(callBackObj,waitTimeMilliSec,lockPolicyType)
+AsyncTcpSocket::AsyncTcpSocket(ServerCallbackInterface *callBackObj,bool isAsynchronousReceive,unsigned int waitTimeMilliSec,unsigned int maximumProcessorCount,epl::LockPolicy lockPolicyType): BaseTcpSocket(callBackObj,waitTimeMilliSec,lockPolicyType),m_dispatchQueue(lockPolicyType)
 {
 	m_processorList=ServerObjectList(waitTimeMilliSec,lockPolicyType);
 	m_maxProcessorCount=maximumProcessorCount;
 	m_isAsynchronousReceive=isAsynchronousReceive;
+	m_eventLoop=NULL;
+	m_isConnected=false;
+	m_recvSizeOffset=0;
+	m_recvPacket=NULL;
+	m_recvPacketOffset=0;
+	m_isReceivePaused=false;
 }
 
 AsyncTcpSocket::~AsyncTcpSocket()
 {
 	KillConnection();
+	if(m_recvPacket)
+		m_recvPacket->ReleaseObj();
+	m_recvPacket=NULL;
+}
+
+bool AsyncTcpSocket::IsConnectionAlive() const
+{
+	if(m_eventLoop)
+		return m_isConnected;
+	return BaseTcpSocket::IsConnectionAlive();
 }
 
 
@@ -76,6 +92,12 @@ void AsyncTcpSocket::SetWaitTime(unsigned int milliSec)
 
 void AsyncTcpSocket::KillConnection()
 {
+	// no socket thread to wait for in the event loop mode
+	if(m_eventLoop)
+	{
+		killConnection();
+		return;
+	}
 	epl::LockObj lock(m_baseSocketLock);
 	if(!IsConnectionAlive())
 	{
@@ -100,11 +122,12 @@ void AsyncTcpSocket::KillConnection()
 
 	if(m_clientSocket!=INVALID_SOCKET)
 	{
-		closesocket(m_clientSocket);
+		SocketHelper::CloseSocket(m_clientSocket);
 		m_clientSocket = INVALID_SOCKET;
 	}
 
 	m_processorList.Clear();
+	m_dispatchQueue.Clear();
 	removeSelfFromContainer();
 	m_callBackObj->OnDisconnect(this);
 }
@@ -112,18 +135,23 @@ void AsyncTcpSocket::KillConnection()
 
 void AsyncTcpSocket::killConnection()
 {
-	if(IsConnectionAlive())
 	{
+		epl::LockObj lock(m_baseSocketLock);
+		if(!IsConnectionAlive())
+			return;
+		m_isConnected=false;
 		// No longer need client socket
 		if(m_clientSocket!=INVALID_SOCKET)
 		{
-			closesocket(m_clientSocket);
+			SocketHelper::CloseSocket(m_clientSocket);
 			m_clientSocket = INVALID_SOCKET;
 		}
-		m_processorList.Clear();
-		removeSelfFromContainer();
-		m_callBackObj->OnDisconnect(this);
 	}
+	// the callbacks are called out of the lock, so they can use the socket
+	m_processorList.Clear();
+	m_dispatchQueue.Clear();
+	removeSelfFromContainer();
+	m_callBackObj->OnDisconnect(this);
 }
 
 void AsyncTcpSocket::execute()
@@ -131,67 +159,184 @@ void AsyncTcpSocket::execute()
 	m_callBackObj->OnNewConnection(this);
 
 	int iResult=0;
+	m_packetRecvBuffer.Reset();
 	// Receive until the peer shuts down the connection
 	do {
-		iResult =receive(m_recvSizePacket);
+		// a single recv may bring several packets, so process all of them before the next recv
+		iResult =m_packetRecvBuffer.Fill(m_clientSocket);
 		if(iResult>0)
 		{
-			unsigned int shouldReceive=(reinterpret_cast<unsigned int*>(const_cast<char*>(m_recvSizePacket.GetPacket())))[0];
-			Packet *recvPacket=EP_NEW Packet(NULL,shouldReceive);
-			iResult = receive(*recvPacket);
-
-			if (iResult == shouldReceive) {
-				if(m_isAsynchronousReceive)
-				{
-					ServerPacketProcessor::PacketPassUnit passUnit;
-					passUnit.m_packet=recvPacket;
-					passUnit.m_owner=this;
-					ServerPacketProcessor *parser =EP_NEW ServerPacketProcessor(m_callBackObj,m_waitTime,m_lockPolicy);
-					if(!parser)
-					{
-						recvPacket->ReleaseObj();
-						continue;
-					}
-					parser->setPacketPassUnit(passUnit);
-					m_processorList.Push(parser);
-					parser->Start();
-					parser->ReleaseObj();
-					recvPacket->ReleaseObj();
-					if(GetMaximumProcessorCount()!=PROCESSOR_LIMIT_INFINITE)
-					{
-						while(m_processorList.Count()>=GetMaximumProcessorCount())
-						{
-							m_processorList.WaitForListSizeDecrease();
-						}
-					}
-				}
-				else
-				{
-					m_callBackObj->OnReceived(this,recvPacket,RECEIVE_STATUS_SUCCESS);
-					recvPacket->ReleaseObj();
-				}
-				
-			}
-			else if (iResult == 0)
+			Packet *recvPacket;
+			while((recvPacket=m_packetRecvBuffer.Pop())!=NULL)
 			{
-				epl::System::OutputDebugString(_T("%s::%s(%d)(%x) Connection closing...\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+				processPacket(recvPacket);
 				recvPacket->ReleaseObj();
-				break;
-			}
-			else  {
-				epl::System::OutputDebugString(_T("%s::%s(%d)(%x) recv failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-				recvPacket->ReleaseObj();
-				break;
 			}
 		}
-		else
+		else if (iResult == 0)
 		{
-			break;
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) Connection closing...\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		}
+		else  {
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) recv failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		}
 
 	} while (iResult > 0);
+	m_packetRecvBuffer.Reset();
+
+	killConnection();
+}
+
+void AsyncTcpSocket::processPacket(Packet *recvPacket)
+{
+	markActive();
+	if(m_isAsynchronousReceive)
+	{
+		// the event loop must not block, so it applies the limit by not posting the next receive
+		unsigned int maxProcessorCount=m_eventLoop?PROCESSOR_LIMIT_INFINITE:GetMaximumProcessorCount();
+		if(m_dispatchQueue.Push(this,this,recvPacket,maxProcessorCount))
+			return;
+
+		ServerPacketProcessor::PacketPassUnit passUnit;
+		passUnit.m_packet=recvPacket;
+		passUnit.m_owner=this;
+		ServerPacketProcessor *parser =EP_NEW ServerPacketProcessor(m_callBackObj,m_waitTime,m_lockPolicy);
+		if(!parser)
+		{
+			return;
+		}
+		parser->setPacketPassUnit(passUnit);
+		if(m_eventLoop)
+			parser->m_completionDelegate=this;
+		m_processorList.Push(parser);
+		parser->Start();
+		parser->ReleaseObj();
+		if(maxProcessorCount!=PROCESSOR_LIMIT_INFINITE)
+		{
+			while(m_processorList.Count()>=maxProcessorCount)
+			{
+				m_processorList.WaitForListSizeDecrease();
+			}
+		}
+	}
+	else
+	{
+		m_callBackObj->OnReceived(this,recvPacket,RECEIVE_STATUS_SUCCESS);
+	}
+}
+
+void AsyncTcpSocket::setPacketDispatcher(PacketDispatcher *dispatcher,bool isOrdered)
+{
+	m_dispatchQueue.SetDispatcher(dispatcher,isOrdered);
+}
+
+void AsyncTcpSocket::OnPacketDispatched(Packet *packet)
+{
+	m_callBackObj->OnReceived(this,packet,RECEIVE_STATUS_SUCCESS);
+}
 
+void AsyncTcpSocket::OnPacketCompleted()
+{
+	{
+		epl::LockObj lock(m_baseSocketLock);
+		if(!m_isReceivePaused || isProcessorFull())
+			return;
+		m_isReceivePaused=false;
+	}
+	// the event loop is not receiving, so the buffered data is processed in this thread
+	processBuffer();
+}
+
+bool AsyncTcpSocket::isProcessorFull() const
+{
+	unsigned int maxProcessorCount=GetMaximumProcessorCount();
+	if(!m_isAsynchronousReceive || maxProcessorCount==PROCESSOR_LIMIT_INFINITE)
+		return false;
+	if(m_dispatchQueue.GetDispatcher())
+		return m_dispatchQueue.GetPendingCount()>=maxProcessorCount;
+	return m_processorList.Count()>=maxProcessorCount;
+}
+
+void AsyncTcpSocket::setEventLoop(IocpCompletionPort *eventLoop)
+{
+	epl::LockObj lock(m_baseSocketLock);
+	m_eventLoop=eventLoop;
+	m_isConnected=(eventLoop!=NULL);
+}
+
+void AsyncTcpSocket::startEventLoop()
+{
+	m_callBackObj->OnNewConnection(this);
+	postReceive();
+}
+
+void AsyncTcpSocket::postReceive()
+{
+	{
+		epl::LockObj lock(m_baseSocketLock);
+		if(!IsConnectionAlive())
+			return;
+		m_recvBuffer.SetPending();
+		if(m_eventLoop->WaitForReceive(m_clientSocket,this,m_recvBuffer.GetBuffer(),m_recvBuffer.GetBufferByteSize()))
+			return;
+		vector<BaseJob*> waitingJobList;
+		m_recvBuffer.Complete(0,false,waitingJobList);
+	}
 	killConnection();
 }
 
+void AsyncTcpSocket::processReceive(unsigned long transferredByte,bool isSucceeded)
+{
+	// only one overlapped receive is in flight, so the event loop thread owns the receive state
+	vector<BaseJob*> waitingJobList;
+	m_recvBuffer.Complete(transferredByte,isSucceeded,waitingJobList);
+	if(m_recvBuffer.IsClosed())
+	{
+		killConnection();
+		return;
+	}
+	processBuffer();
+}
+
+void AsyncTcpSocket::processBuffer()
+{
+	while(IsConnectionAlive() && !isProcessorFull())
+	{
+		if(!m_recvPacket)
+		{
+			if(!m_recvBuffer.GetDataByteSize())
+				break;
+			char *sizeData=const_cast<char*>(m_recvSizePacket.GetPacket());
+			unsigned int sizeByteSize=m_recvSizePacket.GetPacketByteSize();
+			m_recvSizeOffset+=m_recvBuffer.Read(sizeData+m_recvSizeOffset,sizeByteSize-m_recvSizeOffset);
+			if(m_recvSizeOffset<sizeByteSize)
+				break;
+			unsigned int shouldReceive=(reinterpret_cast<unsigned int*>(sizeData))[0];
+			m_recvPacket=EP_NEW Packet(NULL,shouldReceive);
+			m_recvSizeOffset=0;
+			m_recvPacketOffset=0;
+		}
+		char *packetData=const_cast<char*>(m_recvPacket->GetPacket());
+		m_recvPacketOffset+=m_recvBuffer.Read(packetData+m_recvPacketOffset,m_recvPacket->GetPacketByteSize()-m_recvPacketOffset);
+		if(m_recvPacketOffset==m_recvPacket->GetPacketByteSize())
+		{
+			Packet *recvPacket=m_recvPacket;
+			m_recvPacket=NULL;
+			processPacket(recvPacket);
+			recvPacket->ReleaseObj();
+		}
+		else if(!m_recvBuffer.GetDataByteSize())
+			break;
+	}
 
+	{
+		epl::LockObj lock(m_baseSocketLock);
+		// resumed by OnPacketCompleted when a processor is available
+		if(IsConnectionAlive() && isProcessorFull())
+		{
+			m_isReceivePaused=true;
+			return;
+		}
+	}
+	postReceive();
+}
@@ -34,23 +34,27 @@ static char THIS_FILE[] = __FILE__;
 
 using namespace epse;
 
-AsyncUdpClient::AsyncUdpClient(epl::LockPolicy lockPolicyType): BaseUdpClient(lockPolicyType)
+AsyncUdpClient::AsyncUdpClient(epl::LockPolicy lockPolicyType): BaseUdpClient(lockPolicyType),m_dispatchQueue(lockPolicyType)
 {
 	m_processorList=ServerObjectList(WAITTIME_INIFINITE,lockPolicyType);
+	m_packetDispatcher=NULL;
 	m_maxProcessorCount=PROCESSOR_LIMIT_INFINITE;
 	m_isAsynchronousReceive=true;
 }
 
 
-AsyncUdpClient::AsyncUdpClient(const AsyncUdpClient& b):BaseUdpClient(b)
+AsyncUdpClient::AsyncUdpClient(const AsyncUdpClient& b):BaseUdpClient(b),m_dispatchQueue(b.m_lockPolicy)
 {
 	m_processorList=b.m_processorList;
+	m_packetDispatcher=NULL;
 	m_maxProcessorCount=b.m_maxProcessorCount;
 	m_isAsynchronousReceive=b.m_isAsynchronousReceive;
 }
 AsyncUdpClient::~AsyncUdpClient()
 {
-	
+	m_dispatchQueue.Clear();
+	if(m_packetDispatcher)
+		EP_DELETE m_packetDispatcher;
 }
 
 AsyncUdpClient & AsyncUdpClient::operator=(const AsyncUdpClient&b)
@@ -106,7 +110,11 @@ void AsyncUdpClient::execute()
 
 		if (iResult > 0) {
 			Packet *passPacket=EP_NEW Packet(recvPacket.GetPacket(),iResult);
-			if(m_isAsynchronousReceive)
+			if(m_isAsynchronousReceive && m_dispatchQueue.Push(this,this,passPacket,GetMaximumProcessorCount()))
+			{
+				passPacket->ReleaseObj();
+			}
+			else if(m_isAsynchronousReceive)
 			{
 				ClientPacketProcessor::PacketPassUnit passUnit;
 
@@ -180,18 +188,27 @@ bool AsyncUdpClient::Connect(const ClientOps &ops)
 	SetWaitTime(ops.waitTimeMilliSec);
 	m_maxProcessorCount=ops.maximumProcessorCount;
 	m_isAsynchronousReceive=ops.isAsynchronousReceive;
+	if(ops.packetDispatchType!=PACKET_DISPATCH_TYPE_THREAD)
+	{
+		// the worker threads are kept until destruction, since Disconnect may be called from them
+		if(!m_packetDispatcher)
+			m_packetDispatcher=EP_NEW PacketDispatcher(m_waitTime,m_lockPolicy);
+		if(!m_packetDispatcher->GetWorkerThreadCount() && !m_packetDispatcher->Create(ops.dispatchThreadCount))
+			return false;
+		m_dispatchQueue.SetDispatcher(m_packetDispatcher,ops.packetDispatchType==PACKET_DISPATCH_TYPE_POOL_ORDERED);
+	}
+	else
+		m_dispatchQueue.SetDispatcher(NULL);
 
 
-	WSADATA wsaData;
 	m_connectSocket=INVALID_SOCKET;
 	m_maxPacketSize=0;
 	struct addrinfo hints;
 	int iResult;
 
-	// Initialize Winsock
-	iResult = WSAStartup(MAKEWORD(2,2), &wsaData);
-	if (iResult != 0) {
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) WSAStartup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+	// Initialize socket library
+	if (!SocketHelper::Startup()) {
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket startup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		return false;
 	}
 
@@ -204,7 +221,7 @@ bool AsyncUdpClient::Connect(const ClientOps &ops)
 	iResult = getaddrinfo(m_hostName.c_str(), m_port.c_str(), &hints, &m_result);
 	if ( iResult != 0 ) {
 		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) getaddrinfo failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-		WSACleanup();
+		SocketHelper::Cleanup();
 		return false;
 	}
 
@@ -245,6 +262,7 @@ void AsyncUdpClient::disconnect()
 	{
 		cleanUpClient();
 		m_processorList.Clear();
+		m_dispatchQueue.Clear();
 		m_callBackObj->OnDisconnect(reinterpret_cast<ClientInterface*>(this));
 	}
 }
@@ -260,7 +278,7 @@ void AsyncUdpClient::Disconnect()
 	{
 		int iResult = shutdown(m_connectSocket, SD_SEND);
 		if (iResult == SOCKET_ERROR)
-			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this, WSAGetLastError());
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this, SocketHelper::GetLastSocketError());
 	}
 	else
 	{
@@ -270,8 +288,13 @@ void AsyncUdpClient::Disconnect()
 		return;
 	cleanUpClient();
 	m_processorList.Clear();
+	m_dispatchQueue.Clear();
 	m_callBackObj->OnDisconnect(reinterpret_cast<ClientInterface*>(this));
 
 }
 
+void AsyncUdpClient::OnPacketDispatched(Packet *packet)
+{
+	m_callBackObj->OnReceived(this,packet,RECEIVE_STATUS_SUCCESS);
+}
 
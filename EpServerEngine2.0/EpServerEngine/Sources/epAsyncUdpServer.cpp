@@ -37,6 +37,8 @@ using namespace epse;
 AsyncUdpServer::AsyncUdpServer(epl::LockPolicy lockPolicyType): BaseUdpServer(lockPolicyType)
 {
 	m_isAsynchronousReceive=true;
+	m_packetDispatcher=NULL;
+	m_packetDispatchType=PACKET_DISPATCH_TYPE_THREAD;
 }
 
 
@@ -44,9 +46,13 @@ AsyncUdpServer::AsyncUdpServer(const AsyncUdpServer& b):BaseUdpServer(b)
 {
 	LockObj lock(b.m_baseServerLock);
 	m_isAsynchronousReceive=b.m_isAsynchronousReceive;
+	m_packetDispatcher=NULL;
+	m_packetDispatchType=b.m_packetDispatchType;
 }
 AsyncUdpServer::~AsyncUdpServer()
 {
+	if(m_packetDispatcher)
+		EP_DELETE m_packetDispatcher;
 }
 AsyncUdpServer & AsyncUdpServer::operator=(const AsyncUdpServer&b)
 {
@@ -56,6 +62,7 @@ AsyncUdpServer & AsyncUdpServer::operator=(const AsyncUdpServer&b)
 		BaseUdpServer::operator =(b);
 		LockObj lock(b.m_baseServerLock);
 		m_isAsynchronousReceive=b.m_isAsynchronousReceive;
+		m_packetDispatchType=b.m_packetDispatchType;
 	}
 	return *this;
 }
@@ -72,69 +79,74 @@ void AsyncUdpServer::SetIsAsynchronousReceive(bool isASynchronousReceive)
 bool AsyncUdpServer::StartServer(const ServerOps &ops)
 {
 	m_isAsynchronousReceive=ops.isAsynchronousReceive;
+	m_packetDispatchType=ops.packetDispatchType;
+	if(m_packetDispatchType!=PACKET_DISPATCH_TYPE_THREAD)
+	{
+		if(!m_packetDispatcher)
+			m_packetDispatcher=EP_NEW PacketDispatcher(ops.waitTimeMilliSec,m_lockPolicy);
+		if(!m_packetDispatcher->Create(ops.dispatchThreadCount))
+			return false;
+	}
 	return BaseUdpServer::StartServer(ops);
 }
 
-void AsyncUdpServer::execute()
+void AsyncUdpServer::StopServer()
 {
-	Packet recvPacket(NULL,m_maxPacketSize);
-	char *packetData=const_cast<char*>(recvPacket.GetPacket());
-	int length=recvPacket.GetPacketByteSize();
-	sockaddr clientSockAddr;
-	int sockAddrSize=sizeof(sockaddr);
-	while(m_listenSocket!=INVALID_SOCKET)
-	{
-		int recvLength=recvfrom(m_listenSocket,packetData,length, 0,&clientSockAddr,&sockAddrSize);
+	BaseUdpServer::StopServer();
+	if(m_packetDispatcher)
+		m_packetDispatcher->Close();
+}
 
-		AsyncUdpSocket *workerObj=(AsyncUdpSocket*)m_socketList.Find(clientSockAddr,socketCompare);
-		if(workerObj)
+void AsyncUdpServer::processDatagram(const char *packetData,int recvLength,const sockaddr &clientSockAddr)
+{
+	AsyncUdpSocket *workerObj=(AsyncUdpSocket*)findPeer(clientSockAddr);
+	if(workerObj)
+	{
+		if(recvLength<=0)
 		{
-			if(recvLength<=0)
-			{
-				Packet *passPacket=EP_NEW Packet(packetData,0);
-				workerObj->addPacket(passPacket);
-				passPacket->ReleaseObj();
-				continue;
-			}	
-			Packet *passPacket=EP_NEW Packet(packetData,recvLength);
+			Packet *passPacket=EP_NEW Packet(packetData,0);
 			workerObj->addPacket(passPacket);
 			passPacket->ReleaseObj();
-		}
-		else
+			return;
+		}	
+		Packet *passPacket=EP_NEW Packet(packetData,recvLength);
+		workerObj->addPacket(passPacket);
+		passPacket->ReleaseObj();
+	}
+	else
+	{
+		if(recvLength<=0)
+			return;
+		if(GetMaximumConnectionCount()!=CONNECTION_LIMIT_INFINITE)
 		{
-			if(recvLength<=0)
-				continue;
-			if(GetMaximumConnectionCount()!=CONNECTION_LIMIT_INFINITE)
-			{
-				if(m_socketList.Count()>=GetMaximumConnectionCount())
-				{
-					continue;
-				}
-			}
-			if(!m_callBackObj->OnAccept(clientSockAddr))
-			{
-				continue;
-			}
-			/// Create Worker Thread
-			AsyncUdpSocket *accWorker=EP_NEW AsyncUdpSocket(m_callBackObj,m_isAsynchronousReceive,m_waitTime,PROCESSOR_LIMIT_INFINITE,m_lockPolicy);
-			if(!accWorker)
+			if(m_socketList.Count()>=GetMaximumConnectionCount())
 			{
-				continue;
+				return;
 			}
-			Packet *passPacket=EP_NEW Packet(packetData,recvLength);
-			accWorker->setSockAddr(clientSockAddr);
-			accWorker->setOwner(this);
-			accWorker->setMaxPacketByteSize(m_maxPacketSize);
-			m_socketList.Push(accWorker);
-			accWorker->Start();
-			accWorker->addPacket(passPacket);
-			accWorker->ReleaseObj();
-			passPacket->ReleaseObj();
-
 		}
+		if(!m_callBackObj->OnAccept(clientSockAddr))
+		{
+			return;
+		}
+		/// Create Worker Thread
+		AsyncUdpSocket *accWorker=EP_NEW AsyncUdpSocket(m_callBackObj,m_isAsynchronousReceive,m_waitTime,PROCESSOR_LIMIT_INFINITE,m_lockPolicy);
+		if(!accWorker)
+		{
+			return;
+		}
+		Packet *passPacket=EP_NEW Packet(packetData,recvLength);
+		accWorker->setSockAddr(clientSockAddr);
+		accWorker->setOwner(this);
+		accWorker->setMaxPacketByteSize(m_maxPacketSize);
+		if(m_packetDispatchType!=PACKET_DISPATCH_TYPE_THREAD)
+			accWorker->setPacketDispatcher(m_packetDispatcher,m_packetDispatchType==PACKET_DISPATCH_TYPE_POOL_ORDERED);
+		pushPeer(accWorker,clientSockAddr);
+		accWorker->Start();
+		startActivityTimer(accWorker);
+		accWorker->addPacket(passPacket);
+		accWorker->ReleaseObj();
+		passPacket->ReleaseObj();
 
 	}
-
-	stopServer();
-} 
+}
 
@@ -33,7 +33,7 @@ static char THIS_FILE[] = __FILE__;
 #endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
 
 using namespace epse;
-AsyncUdpSocket::AsyncUdpSocket(ServerCallbackInterface *callBackObj,bool isAsynchronousReceive,unsigned int waitTimeMilliSec,unsigned int maximumProcessorCount,epl::LockPolicy lockPolicyType): BaseUdpSocket(callBackObj,waitTimeMilliSec,lockPolicyType)
+AsyncUdpSocket::AsyncUdpSocket(ServerCallbackInterface *callBackObj,bool isAsynchronousReceive,unsigned int waitTimeMilliSec,unsigned int maximumProcessorCount,epl::LockPolicy lockPolicyType): BaseUdpSocket(callBackObj,waitTimeMilliSec,lockPolicyType),m_dispatchQueue(lockPolicyType)
 {
 	m_processorList=ServerObjectList(waitTimeMilliSec,lockPolicyType);
 	m_threadStopEvent=EventEx(false,false);
@@ -80,22 +80,13 @@ void AsyncUdpSocket::KillConnection()
 		return;
 	}
 	m_threadStopEvent.SetEvent();
-	if(GetStatus()==Thread::THREAD_STATUS_SUSPENDED)
-		Resume();
+	m_packetList.WakeUp();
 	if(TerminateAfter(m_waitTime)==Thread::TERMINATE_RESULT_GRACEFULLY_TERMINATED)
 		return;
 	m_processorList.Clear();
+	m_dispatchQueue.Clear();
 
-	m_listLock->Lock();
-	Packet *removeElem=NULL;
-	while(!m_packetList.empty())
-	{
-		removeElem=m_packetList.front();
-		if(removeElem)
-			removeElem->ReleaseObj();
-		m_packetList.pop();
-	}
-	m_listLock->Unlock();
+	clearPacketList();
 
 	removeSelfFromContainer();
 	m_callBackObj->OnDisconnect(this);
@@ -107,16 +98,8 @@ void AsyncUdpSocket::killConnection()
 	{
 
 		m_processorList.Clear();
-		m_listLock->Lock();
-		Packet *removeElem=NULL;
-		while(!m_packetList.empty())
-		{
-			removeElem=m_packetList.front();
-			if(removeElem)
-				removeElem->ReleaseObj();
-			m_packetList.pop();
-		}
-		m_listLock->Unlock();
+		m_dispatchQueue.Clear();
+		clearPacketList();
 
 		removeSelfFromContainer();
 		m_callBackObj->OnDisconnect(this);
@@ -126,12 +109,7 @@ void AsyncUdpSocket::killConnection()
 
 void AsyncUdpSocket::addPacket(Packet *packet)
 {
-	if(packet)
-		packet->RetainObj();
-	epl::LockObj lock(m_listLock);
-	m_packetList.push(packet);
-	if(GetStatus()==THREAD_STATUS_SUSPENDED)
-		Resume();
+	pushPacket(packet);
 }
 
 void AsyncUdpSocket::execute()
@@ -145,26 +123,24 @@ void AsyncUdpSocket::execute()
 		{
 			break;
 		}
-		m_listLock->Lock();
-		if(m_packetList.size()==0)
-		{
-			m_listLock->Unlock();
-			Suspend();
+		Packet *packet=NULL;
+		if(!m_packetList.Pop(packet,WAITTIME_INIFINITE))
 			continue;
-		}
-		Packet *packet= m_packetList.front();
 		packetSize=packet->GetPacketByteSize();
 		if(packetSize==0)
 		{
-			m_listLock->Unlock();
+			packet->ReleaseObj();
 			break;
 		}
 
-		m_packetList.pop();
-		m_listLock->Unlock();
-
 		if(m_isAsynchronousReceive)
 		{
+			if(m_dispatchQueue.Push(this,this,packet,GetMaximumProcessorCount()))
+			{
+				packet->ReleaseObj();
+				continue;
+			}
+
 			ServerPacketProcessor::PacketPassUnit passUnit;
 			passUnit.m_owner=this;
 			passUnit.m_packet=packet;
@@ -199,3 +175,12 @@ void AsyncUdpSocket::execute()
 
 }
 
+void AsyncUdpSocket::setPacketDispatcher(PacketDispatcher *dispatcher,bool isOrdered)
+{
+	m_dispatchQueue.SetDispatcher(dispatcher,isOrdered);
+}
+
+void AsyncUdpSocket::OnPacketDispatched(Packet *packet)
+{
+	m_callBackObj->OnReceived(this,packet,RECEIVE_STATUS_SUCCESS);
+}
@@ -259,7 +259,7 @@ void BaseClient::cleanUpClient()
 {
 	if(m_connectSocket!=INVALID_SOCKET)
 	{
-		closesocket(m_connectSocket);
+		SocketHelper::CloseSocket(m_connectSocket);
 		m_connectSocket=INVALID_SOCKET;
 	}
 	if(m_result)
@@ -267,7 +267,7 @@ void BaseClient::cleanUpClient()
 		freeaddrinfo(m_result);
 		m_result=NULL;
 	}
-	WSACleanup();
+	SocketHelper::Cleanup();
 
 }
 
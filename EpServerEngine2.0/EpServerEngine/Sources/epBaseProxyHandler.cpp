@@ -55,17 +55,23 @@ BaseProxyHandler::BaseProxyHandler(ProxyServerCallbackInterface *callBack, Socke
 
 	m_callBack=callBack;
 	m_client=socket;
+	m_forwardClient=NULL;
+	m_forwardClientPool=NULL;
+	m_relay=NULL;
 	socket->SetCallbackObject(this);
 
 }
 
 BaseProxyHandler::~BaseProxyHandler()
 {	
+	releaseForwardClient();
 	if(m_forwardClient)
 	{
 		m_forwardClient->Disconnect();
-		EP_DELETE m_forwardClient;
+		EP_DELETE static_cast<BaseClient*>(m_forwardClient);
 	}
+	if(m_relay)
+		EP_DELETE m_relay;
 	if(m_baseProxyHandlerLock)
 		EP_DELETE m_baseProxyHandlerLock;
 }
@@ -77,6 +83,8 @@ void BaseProxyHandler::OnReceived(SocketInterface *socket,const Packet*receivedP
 }
 void BaseProxyHandler::OnDisconnect(SocketInterface *socket)
 {
+	// the pooled client is given back at once, so the next connection can reuse it
+	releaseForwardClient();
 	if(m_forwardClient)
 		m_forwardClient->Disconnect();
 	epl::LockObj lock(m_baseProxyHandlerLock);
@@ -124,3 +132,27 @@ sockaddr BaseProxyHandler::GetSockAddr() const
 	}
 	return sockaddr();
 }
+
+void BaseProxyHandler::stopRelay()
+{
+	if(m_relay)
+		m_relay->Stop();
+}
+
+void BaseProxyHandler::releaseForwardClient()
+{
+	if(!m_forwardClientPool)
+		return;
+	ClientInterface *forwardClient;
+	bool isReusable=false;
+	{
+		epl::LockObj lock(m_baseProxyHandlerLock);
+		forwardClient=m_forwardClient;
+		m_forwardClient=NULL;
+		// only the application knows if the replies for the client are all received
+		if(forwardClient && !m_forwardClientPool->IsMultiplexing())
+			isReusable=m_callBack->IsForwardServerClientReusable(forwardClient);
+	}
+	if(forwardClient)
+		m_forwardClientPool->Release(forwardClient,isReusable);
+}
@@ -52,6 +52,8 @@ BaseProxyServer::BaseProxyServer(epl::LockPolicy lockPolicyType)
 		m_baseProxyServerLock=NULL;
 		break;
 	}
+	m_isRelay=false;
+	m_forwardClientPool=NULL;
 }
 BaseProxyServer::BaseProxyServer(const BaseProxyServer& b)
 {
@@ -71,9 +73,12 @@ BaseProxyServer::BaseProxyServer(const BaseProxyServer& b)
 		m_baseProxyServerLock=NULL;
 		break;
 	}
+	m_isRelay=b.m_isRelay;
+	m_forwardClientPool=NULL;
 }
 BaseProxyServer::~BaseProxyServer()
 {
+	stopRelays();
 	if(m_proxyServer)
 	{
 		m_proxyServer->StopServer();
@@ -88,6 +93,9 @@ BaseProxyServer::~BaseProxyServer()
 	m_proxyHandlerList.clear();
 	m_baseProxyServerLock->Unlock();
 
+	if(m_forwardClientPool)
+		EP_DELETE m_forwardClientPool;
+
 	if(m_baseProxyServerLock)
 		EP_DELETE m_baseProxyServerLock;
 
@@ -116,6 +124,7 @@ BaseProxyServer & BaseProxyServer::operator=(const BaseProxyServer&b)
 			m_baseProxyServerLock=NULL;
 			break;
 		}
+		m_isRelay=b.m_isRelay;
 		*m_proxyServer=*b.m_proxyServer;
 	}
 	return *this;
@@ -147,6 +156,10 @@ bool BaseProxyServer::StartServer(const ProxyServerOps &ops)
 	m_baseProxyServerLock->Lock();
 	m_callBack=ops.callBackObj;
 	EP_ASSERT(m_callBack);
+	m_isRelay=ops.isRelay;
+	// the pool is created once while the server is running, since the handlers hold it
+	if(!m_forwardClientPool && !m_isRelay && (ops.forwardPoolSize || ops.forwardLinkCount))
+		m_forwardClientPool=EP_NEW ForwardClientPool(ops.forwardPoolSize,ops.forwardLinkCount,m_lockPolicy);
 	m_baseProxyServerLock->Unlock();
 	ServerOps serverOps;
 	serverOps.callBackObj=this;
@@ -160,6 +173,7 @@ bool BaseProxyServer::StartServer(const ProxyServerOps &ops)
 }
 void BaseProxyServer::StopServer()
 {
+	stopRelays();
 	if(m_proxyServer)
 		m_proxyServer->StopServer();
 
@@ -170,6 +184,11 @@ void BaseProxyServer::StopServer()
 		EP_DELETE (*iter);
 	}
 	m_proxyHandlerList.clear();
+
+	// the handlers gave back all the clients to the pool above
+	if(m_forwardClientPool)
+		EP_DELETE m_forwardClientPool;
+	m_forwardClientPool=NULL;
 }
 bool BaseProxyServer::IsServerStarted() const
 {
@@ -179,6 +198,7 @@ bool BaseProxyServer::IsServerStarted() const
 }
 void BaseProxyServer::ShutdownAllClient()
 {
+	stopRelays();
 	if(m_proxyServer)
 		m_proxyServer->ShutdownAllClient();
 
@@ -212,4 +232,14 @@ ProxyServerCallbackInterface *BaseProxyServer::GetCallbackObject()
 {
 	epl::LockObj lock(m_baseProxyServerLock);
 	return m_callBack;
+}
+
+void BaseProxyServer::stopRelays()
+{
+	epl::LockObj lock(m_baseProxyServerLock);
+	vector<BaseProxyHandler*>::iterator iter;
+	for(iter=m_proxyHandlerList.begin();iter!=m_proxyHandlerList.end();iter++)
+	{
+		(*iter)->stopRelay();
+	}
 }
\ No newline at end of file
@@ -24,6 +24,10 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 #include "epBaseServer.h"
+#include "epBaseSocket.h"
+#include "epBroadcastJob.h"
+#include "epBroadcastProcessor.h"
+#include "epJobScheduler.h"
 
 #if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
 #define new DEBUG_NEW
@@ -52,6 +56,29 @@ BaseServer::BaseServer(epl::LockPolicy lockPolicyType):BaseServerObject(WAITTIME
 		m_baseServerLock=NULL;
 		break;
 	}
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_acceptorLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_acceptorLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_acceptorLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_acceptorLock=NULL;
+		break;
+	}
+	m_acceptorCount=1;
+	m_timerWheel=NULL;
+	m_idleTimeout=TIMEOUT_NONE;
+	m_keepAliveTime=TIMEOUT_NONE;
+	m_sendTimeout=TIMEOUT_NONE;
+	m_broadcastScheduler=NULL;
+	m_broadcastThreadCount=0;
+	m_topicRouter=EP_NEW TopicRouter(m_lockPolicy);
 	m_listenSocket=INVALID_SOCKET;
 	m_result=0;
 	m_maxConnectionCount=CONNECTION_LIMIT_INFINITE;
@@ -80,6 +107,29 @@ BaseServer::BaseServer(const BaseServer& b):BaseServerObject(b)
 		m_baseServerLock=NULL;
 		break;
 	}
+	switch(m_lockPolicy)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_acceptorLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_acceptorLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_acceptorLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_acceptorLock=NULL;
+		break;
+	}
+	m_acceptorCount=1;
+	m_timerWheel=NULL;
+	m_idleTimeout=TIMEOUT_NONE;
+	m_keepAliveTime=TIMEOUT_NONE;
+	m_sendTimeout=TIMEOUT_NONE;
+	m_broadcastScheduler=NULL;
+	m_broadcastThreadCount=0;
+	m_topicRouter=EP_NEW TopicRouter(m_lockPolicy);
 
 	LockObj lock(b.m_baseServerLock);
 	m_port=b.m_port;
@@ -119,6 +169,29 @@ BaseServer & BaseServer::operator=(const BaseServer&b)
 			m_baseServerLock=NULL;
 			break;
 		}
+		switch(m_lockPolicy)
+		{
+		case epl::LOCK_POLICY_CRITICALSECTION:
+			m_acceptorLock=EP_NEW epl::CriticalSectionEx();
+			break;
+		case epl::LOCK_POLICY_MUTEX:
+			m_acceptorLock=EP_NEW epl::Mutex();
+			break;
+		case epl::LOCK_POLICY_NONE:
+			m_acceptorLock=EP_NEW epl::NoLock();
+			break;
+		default:
+			m_acceptorLock=NULL;
+			break;
+		}
+		m_acceptorCount=1;
+		m_timerWheel=NULL;
+		m_idleTimeout=TIMEOUT_NONE;
+		m_keepAliveTime=TIMEOUT_NONE;
+		m_sendTimeout=TIMEOUT_NONE;
+		m_broadcastScheduler=NULL;
+		m_broadcastThreadCount=0;
+		m_topicRouter=EP_NEW TopicRouter(m_lockPolicy);
 
 		LockObj lock(b.m_baseServerLock);
 		m_port=b.m_port;
@@ -136,6 +209,22 @@ void BaseServer::resetServer()
 	if(m_baseServerLock)
 		EP_DELETE m_baseServerLock;
 	m_baseServerLock=NULL;
+
+	if(m_acceptorLock)
+		EP_DELETE m_acceptorLock;
+	m_acceptorLock=NULL;
+
+	if(m_timerWheel)
+		EP_DELETE m_timerWheel;
+	m_timerWheel=NULL;
+
+	if(m_broadcastScheduler)
+		EP_DELETE m_broadcastScheduler;
+	m_broadcastScheduler=NULL;
+
+	if(m_topicRouter)
+		EP_DELETE m_topicRouter;
+	m_topicRouter=NULL;
 }
 
 void  BaseServer::SetPort(const TCHAR *  port)
@@ -223,6 +312,95 @@ void BaseServer::shutdownAllClient()
 	m_socketList.Clear();
 }
 
+void BaseServer::Broadcast(Packet &packet, unsigned int waitTimeInMilliSec)
+{
+	// the sockets are retained, so they are not deleted while the packet is queued
+	vector<BaseServerObject*> socketList=m_socketList.GetRetainedList();
+	BroadcastJob *job=NULL;
+	for(int trav=0;trav<socketList.size();trav++)
+	{
+		broadcastTo(static_cast<BaseSocket*>(socketList.at(trav)),packet,waitTimeInMilliSec,job);
+		socketList.at(trav)->ReleaseObj();
+	}
+	pushBroadcastJob(job);
+}
+
+void BaseServer::Multicast(SocketInterface *const*socketList,unsigned int socketCount,Packet &packet, unsigned int waitTimeInMilliSec)
+{
+	BroadcastJob *job=NULL;
+	for(unsigned int trav=0;trav<socketCount;trav++)
+	{
+		broadcastTo(static_cast<BaseSocket*>(socketList[trav]),packet,waitTimeInMilliSec,job);
+	}
+	pushBroadcastJob(job);
+}
+
+bool BaseServer::Subscribe(SocketInterface *socket,const TCHAR *topic)
+{
+	BaseSocket *baseSocket=static_cast<BaseSocket*>(socket);
+	if(!baseSocket->IsConnectionAlive() || !m_topicRouter->Subscribe(baseSocket,topic))
+		return false;
+	// the socket disconnected while subscribing would never be unsubscribed
+	if(!baseSocket->IsConnectionAlive())
+	{
+		m_topicRouter->UnsubscribeAll(baseSocket);
+		return false;
+	}
+	return true;
+}
+
+bool BaseServer::Unsubscribe(SocketInterface *socket,const TCHAR *topic)
+{
+	return m_topicRouter->Unsubscribe(static_cast<BaseSocket*>(socket),topic);
+}
+
+void BaseServer::UnsubscribeAll(SocketInterface *socket)
+{
+	m_topicRouter->UnsubscribeAll(static_cast<BaseSocket*>(socket));
+}
+
+void BaseServer::Publish(const TCHAR *topic,Packet &packet, unsigned int waitTimeInMilliSec)
+{
+	vector<BaseSocket*> socketList;
+	m_topicRouter->Find(topic,socketList);
+	BroadcastJob *job=NULL;
+	for(int trav=0;trav<socketList.size();trav++)
+	{
+		broadcastTo(socketList.at(trav),packet,waitTimeInMilliSec,job);
+		socketList.at(trav)->ReleaseObj();
+	}
+	pushBroadcastJob(job);
+}
+
+void BaseServer::broadcastTo(BaseSocket *socket,Packet &packet,unsigned int waitTimeInMilliSec,BroadcastJob *&job)
+{
+	if(!socket->IsConnectionAlive())
+		return;
+	// the socket with the send queue holds the shared packet until its worker thread flushes it
+	if(socket->queueSend(packet,waitTimeInMilliSec))
+		return;
+	if(!job)
+		job=EP_NEW BroadcastJob(&packet,waitTimeInMilliSec,PRIORITY_NORMAL,m_lockPolicy);
+	job->AddSocket(socket);
+	if(job->GetSocketCount()>=BROADCAST_JOB_SOCKET_COUNT)
+		pushBroadcastJob(job);
+}
+
+void BaseServer::pushBroadcastJob(BroadcastJob *&job)
+{
+	if(!job)
+		return;
+	bool isPushed;
+	{
+		epl::LockObj lock(m_baseServerLock);
+		isPushed=startBroadcaster() && m_broadcastScheduler->Push(job);
+	}
+	if(!isPushed)
+		job->Send();
+	job->ReleaseObj();
+	job=NULL;
+}
+
 bool BaseServer::IsServerStarted() const
 {
 	//return (GetStatus()==Thread::THREAD_STATUS_STARTED);
@@ -233,16 +411,26 @@ void BaseServer::cleanUpServer()
 {
 	if(m_listenSocket!=INVALID_SOCKET)
 	{
-		closesocket(m_listenSocket);
+		SocketHelper::CloseSocket(m_listenSocket);
 		m_listenSocket=INVALID_SOCKET;
 	}
+	stopAcceptors();
+	if(m_timerWheel)
+		m_timerWheel->Close();
+	if(m_broadcastScheduler)
+	{
+		// the next start starts the broadcast worker threads again on its first broadcast
+		m_broadcastScheduler->Close();
+		EP_DELETE m_broadcastScheduler;
+		m_broadcastScheduler=NULL;
+	}
 	if(m_result)
 	{
 		freeaddrinfo(m_result);
 		m_result=NULL;
 	}
 
-	WSACleanup();
+	SocketHelper::Cleanup();
 
 }
 
@@ -257,3 +445,89 @@ void BaseServer::stopServer()
 	cleanUpServer();
 }
 
+void BaseServer::execute()
+{
+	if(m_acceptorCount>1)
+		ServerAcceptor::SetCurrentThreadAffinity(0);
+	listenLoop(m_listenSocket);
+
+	stopServer();
+}
+
+bool BaseServer::startAcceptors(unsigned int acceptorCount,bool isReusePort,bool isShareable)
+{
+	epl::LockObj lock(m_acceptorLock);
+	m_acceptorCount=1;
+	for(unsigned int trav=1;trav<acceptorCount;trav++)
+	{
+		SOCKET listenSocket=m_listenSocket;
+		if(isReusePort)
+		{
+			bool isSocketReusePort=true;
+			listenSocket=openListenSocket(isSocketReusePort);
+			if(listenSocket==INVALID_SOCKET)
+				return false;
+		}
+		else if(!isShareable)
+		{
+			// the loops on the same socket would break the order of the datagrams from a peer
+			break;
+		}
+		ServerAcceptor *acceptor=EP_NEW ServerAcceptor(this,listenSocket,isReusePort,trav,m_lockPolicy);
+		m_acceptorList.push_back(acceptor);
+		m_acceptorCount++;
+		if(!acceptor->Start())
+			return false;
+	}
+	return true;
+}
+
+void BaseServer::stopAcceptors()
+{
+	epl::LockObj lock(m_acceptorLock);
+	for(int trav=0;trav<m_acceptorList.size();trav++)
+	{
+		m_acceptorList.at(trav)->Close(m_waitTime);
+		EP_DELETE m_acceptorList.at(trav);
+	}
+	m_acceptorList.clear();
+	m_acceptorCount=1;
+}
+
+bool BaseServer::startTimerWheel(const ServerOps &ops)
+{
+	m_idleTimeout=ops.idleTimeoutMilliSec;
+	m_keepAliveTime=ops.keepAliveMilliSec;
+	m_sendTimeout=ops.sendTimeoutMilliSec;
+	if(m_idleTimeout==TIMEOUT_NONE && m_keepAliveTime==TIMEOUT_NONE && m_sendTimeout==TIMEOUT_NONE)
+		return true;
+	if(!m_timerWheel)
+		m_timerWheel=EP_NEW TimerWheel(TIMER_WHEEL_TICK_MILLISEC,m_waitTime,m_lockPolicy);
+	return m_timerWheel->Create();
+}
+
+void BaseServer::startActivityTimer(BaseSocket *socket)
+{
+	if(!m_timerWheel || (m_idleTimeout==TIMEOUT_NONE && m_keepAliveTime==TIMEOUT_NONE && m_sendTimeout==TIMEOUT_NONE))
+		return;
+	socket->setActivityTimer(m_timerWheel,m_idleTimeout,m_keepAliveTime,m_sendTimeout);
+}
+
+bool BaseServer::startBroadcaster()
+{
+	if(m_broadcastScheduler)
+		return true;
+	if(!IsServerStarted())
+		return false;
+	m_broadcastScheduler=EP_NEW JobScheduler(m_waitTime,m_lockPolicy);
+	BroadcastProcessor *jobProcessor=EP_NEW BroadcastProcessor();
+	bool ret=m_broadcastScheduler->Create(m_broadcastThreadCount,jobProcessor);
+	jobProcessor->ReleaseObj();
+	if(!ret)
+	{
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) broadcaster start failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		EP_DELETE m_broadcastScheduler;
+		m_broadcastScheduler=NULL;
+	}
+	return ret;
+}
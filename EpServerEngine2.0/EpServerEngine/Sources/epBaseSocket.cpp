@@ -24,6 +24,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 #include "epBaseSocket.h"
+#include "epBaseServer.h"
 #include "epAsyncTcpServer.h"
 
 #if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
@@ -54,6 +55,15 @@ BaseSocket::BaseSocket(ServerCallbackInterface *callBackObj,unsigned int waitTim
 	}
 	m_callBackObj=callBackObj;
 	m_owner=NULL;
+	m_timerWheel=NULL;
+	m_idleTimeoutTick=0;
+	m_keepAliveTick=0;
+	m_lastActiveTick=0;
+	m_lastKeepAliveTick=0;
+	m_activityTimer.setOwner(this);
+	m_sendTimeoutTick=0;
+	m_isSendTimerRunning=false;
+	m_sendTimer.setOwner(this);
 }
 
 BaseSocket::~BaseSocket()
@@ -132,3 +142,110 @@ ServerCallbackInterface *BaseSocket::GetCallbackObject()
 {
 	return m_callBackObj;
 }
+
+void BaseSocket::setActivityTimer(TimerWheel *timerWheel,unsigned int idleTimeoutMilliSec,unsigned int keepAliveMilliSec,unsigned int sendTimeoutMilliSec)
+{
+	m_timerWheel=timerWheel;
+	m_idleTimeoutTick=timerWheel->ToTick(idleTimeoutMilliSec);
+	m_keepAliveTick=timerWheel->ToTick(keepAliveMilliSec);
+	m_sendTimeoutTick=timerWheel->ToTick(sendTimeoutMilliSec);
+	m_lastActiveTick=timerWheel->GetCurrentTick();
+	m_lastKeepAliveTick=m_lastActiveTick;
+
+	unsigned int nextTick=m_idleTimeoutTick;
+	if(m_keepAliveTick && (!nextTick || m_keepAliveTick<nextTick))
+		nextTick=m_keepAliveTick;
+	if(nextTick)
+		m_timerWheel->Arm(&m_activityTimer,nextTick*m_timerWheel->GetTickMilliSec());
+}
+
+void BaseSocket::markActive()
+{
+	// the timer is not re-armed here, it catches up with the activity when it expires
+	if(m_timerWheel)
+		m_lastActiveTick=m_timerWheel->GetCurrentTick();
+}
+
+void BaseSocket::stopActivityTimer()
+{
+	if(m_timerWheel)
+	{
+		m_timerWheel->Cancel(&m_activityTimer);
+		m_timerWheel->Cancel(&m_sendTimer);
+	}
+}
+
+void BaseSocket::armSendTimer()
+{
+	// the deadline runs from when the front packets started to wait, so it is not moved while running
+	if(!m_timerWheel || !m_sendTimeoutTick || m_isSendTimerRunning)
+		return;
+	m_isSendTimerRunning=true;
+	m_timerWheel->Arm(&m_sendTimer,m_sendTimeoutTick*m_timerWheel->GetTickMilliSec());
+}
+
+void BaseSocket::cancelSendTimer()
+{
+	if(!m_isSendTimerRunning)
+		return;
+	m_isSendTimerRunning=false;
+	m_timerWheel->Cancel(&m_sendTimer);
+}
+
+bool BaseSocket::removeSelfFromContainer()
+{
+	stopActivityTimer();
+	if(m_owner)
+		((BaseServer*)m_owner)->UnsubscribeAll(this);
+	return BaseServerObject::removeSelfFromContainer();
+}
+
+void BaseSocket::onActivityTimer()
+{
+	if(!IsConnectionAlive())
+		return;
+
+	unsigned int currentTick=m_timerWheel->GetCurrentTick();
+	unsigned int idleTick=currentTick-m_lastActiveTick;
+	if(m_idleTimeoutTick && idleTick>=m_idleTimeoutTick)
+	{
+		if(m_callBackObj->OnIdleTimeout(this))
+		{
+			KillConnection();
+			return;
+		}
+		m_lastActiveTick=currentTick;
+		idleTick=0;
+	}
+
+	// the connection is quiet since the last packet or the last keepalive
+	unsigned int quietTick=currentTick-m_lastKeepAliveTick;
+	if(idleTick<quietTick)
+		quietTick=idleTick;
+	if(m_keepAliveTick && quietTick>=m_keepAliveTick)
+	{
+		m_callBackObj->OnKeepAlive(this);
+		m_lastKeepAliveTick=currentTick;
+		quietTick=0;
+	}
+
+	unsigned int nextTick=0;
+	if(m_idleTimeoutTick)
+		nextTick=m_idleTimeoutTick-idleTick;
+	if(m_keepAliveTick && (!nextTick || m_keepAliveTick-quietTick<nextTick))
+		nextTick=m_keepAliveTick-quietTick;
+	m_timerWheel->Arm(&m_activityTimer,nextTick*m_timerWheel->GetTickMilliSec());
+}
+
+void BaseSocket::onSendTimer()
+{
+	// the send may complete while the timer expires
+	if(!m_isSendTimerRunning || !IsConnectionAlive())
+		return;
+	if(m_callBackObj->OnSendTimeout(this))
+	{
+		KillConnection();
+		return;
+	}
+	m_timerWheel->Arm(&m_sendTimer,m_sendTimeoutTick*m_timerWheel->GetTickMilliSec());
+}
@@ -41,7 +41,8 @@ BaseTcpClient::BaseTcpClient(epl::LockPolicy lockPolicyType) :BaseClient(lockPol
 
 BaseTcpClient::BaseTcpClient(const BaseTcpClient& b) :BaseClient(b)
 {
-	m_recvSizePacket=b.m_recvSizePacket;
+	// the receive buffer is not shared with b, since the copied Packet shares the memory
+	m_recvSizePacket=Packet(NULL,4);
 
 }
 BaseTcpClient::~BaseTcpClient()
@@ -54,13 +55,19 @@ BaseTcpClient & BaseTcpClient::operator=(const BaseTcpClient&b)
 	{
 
 		BaseClient::operator =(b);
-		m_recvSizePacket=b.m_recvSizePacket;
+		m_recvSizePacket=Packet(NULL,4);
 	}
 	return *this;
 }
 
 
 int BaseTcpClient::Send(const Packet &packet, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	const Packet *packetList[1]={&packet};
+	return BaseTcpClient::BatchSend(packetList,1,waitTimeInMilliSec,sendStatus);
+}
+
+int BaseTcpClient::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
 {
 	epl::LockObj lock(m_sendLock);
 	if(!IsConnectionAlive())
@@ -69,33 +76,15 @@ int BaseTcpClient::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 			*sendStatus=SEND_STATUS_FAIL_NOT_CONNECTED;
 		return 0;
 	}
-	// select routine
-	TIMEVAL	timeOutVal;
-	fd_set	fdSet;
-	int		retfdNum = 0;
-
-	FD_ZERO(&fdSet);
-	FD_SET(m_connectSocket, &fdSet);
-	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
-	{
-		// socket select time out setting
-		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
-		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
-		// socket select
-		// socket read select
-		retfdNum = select(0, NULL, &fdSet, NULL, &timeOutVal);
-	}
-	else
-	{
-		retfdNum = select(0, NULL, &fdSet, NULL, NULL);
-	}
-	if (retfdNum == SOCKET_ERROR)	// select failed
+	// wait routine
+	int		retfdNum = SocketHelper::WaitForSocket(m_connectSocket, SocketHelper::SOCKET_WAIT_WRITE, waitTimeInMilliSec);
+	if (retfdNum == SOCKET_ERROR)	// wait failed
 	{
 		if(sendStatus)
 			*sendStatus=SEND_STATUS_FAIL_SOCKET_ERROR;
 		return retfdNum;
 	}
-	else if (retfdNum == 0)		    // select time-out
+	else if (retfdNum == 0)		    // wait time-out
 	{
 		if(sendStatus)
 			*sendStatus=SEND_STATUS_FAIL_TIME_OUT;
@@ -103,28 +92,39 @@ int BaseTcpClient::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 	}
 
 	// send routine
+	// the length headers and the packets are gathered into one send call
+	SocketHelper::SocketBuffer bufferList[SEND_GATHER_PACKET_COUNT*2];
+	unsigned int lengthList[SEND_GATHER_PACKET_COUNT];
 	int writeLength=0;
-	const char *packetData=packet.GetPacket();
-	int length=packet.GetPacketByteSize();
-
-	if(length>0)
+	unsigned int packetIdx=0;
+	while(packetIdx<packetCount)
 	{
-		int sentLength=send(m_connectSocket,reinterpret_cast<char*>(&length),4,0);
-		if(sentLength<=0)
-			return sentLength;
-	}
-	while(length>0)
-	{
-		int sentLength=send(m_connectSocket,packetData,length,0);
-		writeLength+=sentLength;
+		unsigned int gatherCount=0;
+		unsigned int bufferCount=0;
+		while(gatherCount<SEND_GATHER_PACKET_COUNT && packetIdx<packetCount)
+		{
+			const Packet *packet=packetList[packetIdx++];
+			if(!packet || packet->GetPacketByteSize()==0)
+				continue;
+			lengthList[gatherCount]=packet->GetPacketByteSize();
+			SocketHelper::SetSocketBuffer(bufferList[bufferCount++],reinterpret_cast<char*>(&lengthList[gatherCount]),4);
+			SocketHelper::SetSocketBuffer(bufferList[bufferCount++],packet->GetPacket(),lengthList[gatherCount]);
+			gatherCount++;
+		}
+		if(!bufferCount)
+			continue;
+
+		int sentLength=SocketHelper::SendGather(m_connectSocket,bufferList,bufferCount);
 		if(sentLength<=0)
 		{
 			if(sendStatus)
 				*sendStatus=SEND_STATUS_FAIL_SEND_FAILED;
+			// the packets already written are reported with the failure
+			if(writeLength>0)
+				return writeLength;
 			return sentLength;
 		}
-		length-=sentLength;
-		packetData+=sentLength;
+		writeLength+=sentLength-gatherCount*4;
 	}
 	if(sendStatus)
 		*sendStatus=SEND_STATUS_SUCCESS;
@@ -80,7 +80,6 @@ bool BaseTcpServer::StartServer(const ServerOps &ops)
 	SetWaitTime(ops.waitTimeMilliSec);
 	m_maxConnectionCount=ops.maximumConnectionCount;
 	
-	WSADATA wsaData;
 	int iResult;
 
 	m_listenSocket= INVALID_SOCKET;
@@ -88,11 +87,10 @@ bool BaseTcpServer::StartServer(const ServerOps &ops)
 	m_result = NULL;
 
 
-	// Initialize Winsock
-	iResult = WSAStartup(MAKEWORD(2,2), &wsaData);
-	if (iResult != 0) {
+	// Initialize socket library
+	if (!SocketHelper::Startup()) {
 
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) WSAStartup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket startup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		return false;
 	}
 	/// internal use variable2
@@ -108,33 +106,32 @@ bool BaseTcpServer::StartServer(const ServerOps &ops)
 	iResult = getaddrinfo(NULL, m_port.c_str(), &iHints, &m_result);
 	if ( iResult != 0 ) {
 		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) getaddrinfo failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);		
-		WSACleanup();
+		SocketHelper::Cleanup();
 		return false;
 	}
 
-	// Create a SOCKET for connecting to server
-	m_listenSocket = socket(m_result->ai_family, m_result->ai_socktype, m_result->ai_protocol);
+	// Create the listening socket, with SO_REUSEPORT if more than one acceptor
+	bool isReusePort=(ops.acceptorCount>1);
+	m_listenSocket = openListenSocket(isReusePort);
 	if (m_listenSocket == INVALID_SOCKET) {
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		cleanUpServer();
 		return false;
 	}
 
-	// set SO_REUSEADDR for setsockopt function to reuse the port immediately as soon as the service exits.
-	int sockoptval = 1;
-	setsockopt(m_listenSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char*>(&sockoptval), sizeof(int));
-
-	// Setup the TCP listening socket
-	iResult = bind( m_listenSocket, m_result->ai_addr, static_cast<int>(m_result->ai_addrlen));
-	if (iResult == SOCKET_ERROR) {
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) bind failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+	if(!startTimerWheel(ops))
+	{
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) timer wheel start failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		cleanUpServer();
 		return false;
 	}
 
-	iResult = listen(m_listenSocket, SOMAXCONN);
-	if (iResult == SOCKET_ERROR) {
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) listen failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+	// the broadcast worker threads are started by the first broadcast
+	m_broadcastThreadCount=ops.broadcastThreadCount;
+
+	// the accept loops share the listening socket if SO_REUSEPORT is not supported
+	if(!startAcceptors(ops.acceptorCount,isReusePort,true))
+	{
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) acceptor start failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		cleanUpServer();
 		return false;
 	}
@@ -150,6 +147,38 @@ bool BaseTcpServer::StartServer(const ServerOps &ops)
 
 }
 
+SOCKET BaseTcpServer::openListenSocket(bool &isReusePort)
+{
+	// Create a SOCKET for connecting to server
+	SOCKET listenSocket = socket(m_result->ai_family, m_result->ai_socktype, m_result->ai_protocol);
+	if (listenSocket == INVALID_SOCKET) {
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		return INVALID_SOCKET;
+	}
+
+	// set SO_REUSEADDR for setsockopt function to reuse the port immediately as soon as the service exits.
+	int sockoptval = 1;
+	setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char*>(&sockoptval), sizeof(int));
+	if(isReusePort)
+		isReusePort=SocketHelper::SetReusePort(listenSocket);
+
+	// Setup the TCP listening socket
+	int iResult = bind( listenSocket, m_result->ai_addr, static_cast<int>(m_result->ai_addrlen));
+	if (iResult == SOCKET_ERROR) {
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) bind failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		SocketHelper::CloseSocket(listenSocket);
+		return INVALID_SOCKET;
+	}
+
+	iResult = listen(listenSocket, SOMAXCONN);
+	if (iResult == SOCKET_ERROR) {
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) listen failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		SocketHelper::CloseSocket(listenSocket);
+		return INVALID_SOCKET;
+	}
+	return listenSocket;
+}
+
 void BaseTcpServer::StopServer()
 {
 	epl::LockObj lock(m_baseServerLock);
@@ -160,9 +189,10 @@ void BaseTcpServer::StopServer()
 	// No longer need server socket
 	if(m_listenSocket!=INVALID_SOCKET)
 	{
-		closesocket(m_listenSocket);
+		SocketHelper::CloseSocket(m_listenSocket);
 		m_listenSocket=INVALID_SOCKET;
 	}
+	stopAcceptors();
 	TerminateAfter(m_waitTime);
 	shutdownAllClient();
 	cleanUpServer();
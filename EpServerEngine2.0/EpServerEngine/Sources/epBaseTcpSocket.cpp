@@ -69,7 +69,13 @@ void BaseTcpSocket::setClientSocket(const SOCKET& clientSocket )
 
 
 int BaseTcpSocket::Send(const Packet &packet, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
-{	
+{
+	const Packet *packetList[1]={&packet};
+	return BaseTcpSocket::BatchSend(packetList,1,waitTimeInMilliSec,sendStatus);
+}
+
+int BaseTcpSocket::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
 	epl::LockObj lock(m_sendLock);
 
 	if(m_clientSocket==INVALID_SOCKET)
@@ -78,33 +84,14 @@ int BaseTcpSocket::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 			*sendStatus=SEND_STATUS_FAIL_NOT_CONNECTED;
 		return 0;
 	}
-
-	TIMEVAL	timeOutVal;
-	fd_set	fdSet;
-	int		retfdNum = 0;
-
-	FD_ZERO(&fdSet);
-	FD_SET(m_clientSocket, &fdSet);
-	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
-	{
-		// socket select time out setting
-		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
-		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
-		// socket select
-		// socket read select
-		retfdNum = select(0, NULL, &fdSet, NULL, &timeOutVal);
-	}
-	else
-	{
-		retfdNum = select(0, NULL, &fdSet, NULL, NULL);
-	}
-	if (retfdNum == SOCKET_ERROR)	// select failed
+	int		retfdNum = SocketHelper::WaitForSocket(m_clientSocket, SocketHelper::SOCKET_WAIT_WRITE, waitTimeInMilliSec);
+	if (retfdNum == SOCKET_ERROR)	// wait failed
 	{
 		if(sendStatus)
 			*sendStatus=SEND_STATUS_FAIL_SOCKET_ERROR;
 		return retfdNum;
 	}
-	else if (retfdNum == 0)		// select time-out
+	else if (retfdNum == 0)		// wait time-out
 	{
 		if(sendStatus)
 			*sendStatus=SEND_STATUS_FAIL_TIME_OUT;
@@ -112,32 +99,39 @@ int BaseTcpSocket::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 	}
 
 	// send routine
+	// the length headers and the packets are gathered into one send call
+	SocketHelper::SocketBuffer bufferList[SEND_GATHER_PACKET_COUNT*2];
+	unsigned int lengthList[SEND_GATHER_PACKET_COUNT];
 	int writeLength=0;
-	const char *packetData=packet.GetPacket();
-	int length=packet.GetPacketByteSize();
-
-	if(length>0)
+	unsigned int packetIdx=0;
+	while(packetIdx<packetCount)
 	{
-		int sentLength=send(m_clientSocket,reinterpret_cast<char*>(&length),4,0);
-		if(sentLength<=0)
+		unsigned int gatherCount=0;
+		unsigned int bufferCount=0;
+		while(gatherCount<SEND_GATHER_PACKET_COUNT && packetIdx<packetCount)
 		{
-			if(sendStatus)
-				*sendStatus=SEND_STATUS_SUCCESS;
-			return sentLength;
+			const Packet *packet=packetList[packetIdx++];
+			if(!packet || packet->GetPacketByteSize()==0)
+				continue;
+			lengthList[gatherCount]=packet->GetPacketByteSize();
+			SocketHelper::SetSocketBuffer(bufferList[bufferCount++],reinterpret_cast<char*>(&lengthList[gatherCount]),4);
+			SocketHelper::SetSocketBuffer(bufferList[bufferCount++],packet->GetPacket(),lengthList[gatherCount]);
+			gatherCount++;
 		}
-	}
-	while(length>0)
-	{
-		int sentLength=send(m_clientSocket,packetData,length,0);
-		writeLength+=sentLength;
+		if(!bufferCount)
+			continue;
+
+		int sentLength=SocketHelper::SendGather(m_clientSocket,bufferList,bufferCount);
 		if(sentLength<=0)
 		{
 			if(sendStatus)
 				*sendStatus=SEND_STATUS_FAIL_SEND_FAILED;
+			// the packets already written are reported with the failure
+			if(writeLength>0)
+				return writeLength;
 			return sentLength;
 		}
-		length-=sentLength;
-		packetData+=sentLength;
+		writeLength+=sentLength-gatherCount*4;
 	}
 	if(sendStatus)
 		*sendStatus=SEND_STATUS_SUCCESS;
@@ -74,6 +74,12 @@ unsigned int BaseUdpClient::GetMaxPacketByteSize() const
 }
 
 int BaseUdpClient::Send(const Packet &packet, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	const Packet *packetList[1]={&packet};
+	return BaseUdpClient::BatchSend(packetList,1,waitTimeInMilliSec,sendStatus);
+}
+
+int BaseUdpClient::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
 {
 	epl::LockObj lock(m_sendLock);
 	if(!IsConnectionAlive())
@@ -83,33 +89,16 @@ int BaseUdpClient::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 		return 0;
 	}
 
-	// select routine
-	TIMEVAL	timeOutVal;
-	fd_set	fdSet;
-	int		retfdNum = 0;
-
-	FD_ZERO(&fdSet);
-	FD_SET(m_connectSocket, &fdSet);
-	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
-	{
-		// socket select time out setting
-		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
-		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
-		// socket select
-		// socket read select
-		retfdNum = select(0, NULL, &fdSet, NULL, &timeOutVal);
-	}
-	else
-	{
-		retfdNum = select(0, NULL, &fdSet, NULL, NULL);
-	}
-	if (retfdNum == SOCKET_ERROR)	// select failed
+	// wait routine
+	// the socket is waited once for the whole batch
+	int		retfdNum = SocketHelper::WaitForSocket(m_connectSocket, SocketHelper::SOCKET_WAIT_WRITE, waitTimeInMilliSec);
+	if (retfdNum == SOCKET_ERROR)	// wait failed
 	{
 		if(sendStatus)
 			*sendStatus=SEND_STATUS_FAIL_SOCKET_ERROR;
 		return retfdNum;
 	}
-	else if (retfdNum == 0)		    // select time-out
+	else if (retfdNum == 0)		    // wait time-out
 	{
 		if(sendStatus)
 			*sendStatus=SEND_STATUS_FAIL_TIME_OUT;
@@ -117,28 +106,34 @@ int BaseUdpClient::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 	}
 
 	// send routine
-	int sentLength=0;
 	int writeLength=0;
-	const char *packetData=packet.GetPacket();
-	int length=packet.GetPacketByteSize();
-	EP_ASSERT(length<=m_maxPacketSize);
-	int sockAddrSize=sizeof(sockaddr);
-	while(length>0)
+	for(unsigned int trav=0;trav<packetCount;trav++)
 	{
-		sentLength=sendto(m_connectSocket,packetData,length,0,m_ptr->ai_addr,sizeof(sockaddr));
-		writeLength+=sentLength;
+		if(!packetList[trav])
+			continue;
+		const char *packetData=packetList[trav]->GetPacket();
+		int length=packetList[trav]->GetPacketByteSize();
+		EP_ASSERT(length<=m_maxPacketSize);
+		// the empty datagram is taken as the disconnection by the receiver
+		if(length==0)
+			continue;
+
+		// each packet is a datagram, so it is sent whole or not at all
+		int sentLength=sendto(m_connectSocket,packetData,length,0,m_ptr->ai_addr,sizeof(sockaddr));
 		if(sentLength<=0)
 		{
 			if(sendStatus)
 				*sendStatus=SEND_STATUS_FAIL_SEND_FAILED;
+			// the datagrams already sent are reported with the failure
+			if(writeLength>0)
+				return writeLength;
 			return sentLength;
 		}
-		length-=sentLength;
-		packetData+=sentLength;
+		writeLength+=sentLength;
 	}
 	if(sendStatus)
 		*sendStatus=SEND_STATUS_SUCCESS;
-	return sentLength;
+	return writeLength;
 }
 
 
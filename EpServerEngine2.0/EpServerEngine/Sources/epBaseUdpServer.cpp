@@ -51,6 +51,8 @@ BaseUdpServer::BaseUdpServer(epl::LockPolicy lockPolicyType): BaseServer(lockPol
 		break;
 	}
 	m_maxPacketSize=0;
+	m_isUdpOffload=false;
+	m_isSendOffload=false;
 }
 
 BaseUdpServer::BaseUdpServer(const BaseUdpServer& b):BaseServer(b)
@@ -73,6 +75,8 @@ BaseUdpServer::BaseUdpServer(const BaseUdpServer& b):BaseServer(b)
 
 	LockObj lock(b.m_baseServerLock);
 	m_maxPacketSize=b.m_maxPacketSize;
+	m_isUdpOffload=false;
+	m_isSendOffload=false;
 }
 BaseUdpServer::~BaseUdpServer()
 {
@@ -123,36 +127,25 @@ unsigned int BaseUdpServer::GetMaxPacketByteSize() const
 
 int BaseUdpServer::send(const Packet &packet,const sockaddr &clientSockAddr, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
 {
+	const Packet *packetList[1]={&packet};
+	return sendBatch(packetList,1,clientSockAddr,waitTimeInMilliSec,sendStatus);
+}
 
-	epl::LockObj lock(m_sendLock);
+int BaseUdpServer::sendBatch(const Packet *const *packetList,unsigned int packetCount,const sockaddr &clientSockAddr, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
 
-	// select routine
-	TIMEVAL	timeOutVal;
-	fd_set	fdSet;
-	int		retfdNum = 0;
+	epl::LockObj lock(m_sendLock);
 
-	FD_ZERO(&fdSet);
-	FD_SET(m_listenSocket, &fdSet);
-	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
-	{
-		// socket select time out setting
-		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
-		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
-		// socket select
-		// socket read select
-		retfdNum = select(0, NULL, &fdSet, NULL, &timeOutVal);
-	}
-	else
-	{
-		retfdNum = select(0, NULL, &fdSet, NULL, NULL);
-	}
-	if (retfdNum == SOCKET_ERROR)	// select failed
+	// wait routine
+	// the socket is waited once for the whole batch
+	int		retfdNum = SocketHelper::WaitForSocket(m_listenSocket, SocketHelper::SOCKET_WAIT_WRITE, waitTimeInMilliSec);
+	if (retfdNum == SOCKET_ERROR)	// wait failed
 	{
 		if(sendStatus)
 			*sendStatus=SEND_STATUS_FAIL_SOCKET_ERROR;
 		return retfdNum;
 	}
-	else if (retfdNum == 0)		    // select time-out
+	else if (retfdNum == 0)		    // wait time-out
 	{
 		if(sendStatus)
 			*sendStatus=SEND_STATUS_FAIL_TIME_OUT;
@@ -160,30 +153,66 @@ int BaseUdpServer::send(const Packet &packet,const sockaddr &clientSockAddr, uns
 	}
 
 	// send routine
-
-	int sentLength=0;
 	int writeLength=0;
-	const char *packetData=packet.GetPacket();
-	int length=packet.GetPacketByteSize();
-	EP_ASSERT(length<=m_maxPacketSize);
-
-	int sockAddrSize=sizeof(sockaddr);
-	while(length>0)
+	for(unsigned int trav=0;trav<packetCount;trav++)
 	{
-		sentLength=sendto(m_listenSocket,packetData,length,0,&clientSockAddr,sizeof(sockaddr));
-		writeLength+=sentLength;
+		if(!packetList[trav])
+			continue;
+		if(m_isSendOffload)
+		{
+			// the run of the same size packets, with the shorter last one, goes with one offloaded send
+			unsigned int segmentSize=packetList[trav]->GetPacketByteSize();
+			unsigned int runByteSize=segmentSize;
+			unsigned int runEnd=trav+1;
+			while(segmentSize>0 && runEnd<packetCount && runEnd-trav<UDP_OFFLOAD_MAX_SEGMENT_COUNT && packetList[runEnd])
+			{
+				unsigned int nextSize=packetList[runEnd]->GetPacketByteSize();
+				if(nextSize==0 || nextSize>segmentSize || runByteSize+nextSize>UDP_OFFLOAD_MAX_BYTE_SIZE)
+					break;
+				runByteSize+=nextSize;
+				runEnd++;
+				if(nextSize<segmentSize)
+					break;
+			}
+			if(runEnd-trav>1)
+			{
+				SocketHelper::SocketBuffer bufferList[UDP_OFFLOAD_MAX_SEGMENT_COUNT];
+				for(unsigned int bufferTrav=trav;bufferTrav<runEnd;bufferTrav++)
+					SocketHelper::SetSocketBuffer(bufferList[bufferTrav-trav],packetList[bufferTrav]->GetPacket(),packetList[bufferTrav]->GetPacketByteSize());
+				int sentLength=SocketHelper::SendSegments(m_listenSocket,bufferList,runEnd-trav,segmentSize,&clientSockAddr,sizeof(sockaddr));
+				if(sentLength>0)
+				{
+					writeLength+=sentLength;
+					trav=runEnd-1;
+					continue;
+				}
+				// fall back to the plain send from now on, while the receive keeps the coalescing
+				m_isSendOffload=false;
+			}
+		}
+		const char *packetData=packetList[trav]->GetPacket();
+		int length=packetList[trav]->GetPacketByteSize();
+		EP_ASSERT(length<=m_maxPacketSize);
+		// the empty datagram is taken as the disconnection by the receiver
+		if(length==0)
+			continue;
+
+		// each packet is a datagram, so it is sent whole or not at all
+		int sentLength=sendto(m_listenSocket,packetData,length,0,&clientSockAddr,sizeof(sockaddr));
 		if(sentLength<=0)
 		{
 			if(sendStatus)
 				*sendStatus=SEND_STATUS_FAIL_SEND_FAILED;
+			// the datagrams already sent are reported with the failure
+			if(writeLength>0)
+				return writeLength;
 			return sentLength;
 		}
-		length-=sentLength;
-		packetData+=sentLength;
+		writeLength+=sentLength;
 	}
 	if(sendStatus)
 		*sendStatus=SEND_STATUS_SUCCESS;
-	return sentLength;
+	return writeLength;
 }
 
 bool BaseUdpServer::socketCompare(sockaddr const & clientSocket, const BaseServerObject*obj )
@@ -197,6 +226,37 @@ bool BaseUdpServer::socketCompare(sockaddr const & clientSocket, const BaseServe
 	return false;
 }
 
+void BaseUdpServer::makePeerKey(const sockaddr &clientSockAddr,PeerKey &retKey)
+{
+	System::Memset(&retKey,0,sizeof(PeerKey));
+	retKey.m_family=clientSockAddr.sa_family;
+	if(clientSockAddr.sa_family==AF_INET)
+	{
+		// the padding of sockaddr_in is left out of the key
+		const sockaddr_in &inSockAddr=reinterpret_cast<const sockaddr_in&>(clientSockAddr);
+		retKey.m_port=inSockAddr.sin_port;
+		System::Memcpy(retKey.m_address,&inSockAddr.sin_addr,sizeof(inSockAddr.sin_addr));
+	}
+	else
+	{
+		System::Memcpy(retKey.m_address,clientSockAddr.sa_data,sizeof(clientSockAddr.sa_data));
+	}
+}
+
+BaseServerObject *BaseUdpServer::findPeer(const sockaddr &clientSockAddr)
+{
+	PeerKey key;
+	makePeerKey(clientSockAddr,key);
+	return m_socketList.FindByKey(&key,sizeof(PeerKey));
+}
+
+void BaseUdpServer::pushPeer(BaseServerObject *socket,const sockaddr &clientSockAddr)
+{
+	PeerKey key;
+	makePeerKey(clientSockAddr,key);
+	m_socketList.Push(socket,&key,sizeof(PeerKey));
+}
+
 
 bool BaseUdpServer::StartServer(const ServerOps &ops)
 {
@@ -222,7 +282,6 @@ bool BaseUdpServer::StartServer(const ServerOps &ops)
 	SetWaitTime(ops.waitTimeMilliSec);
 	m_maxConnectionCount=ops.maximumConnectionCount;
 
-	WSADATA wsaData;
 	int iResult;
 
 	m_listenSocket= INVALID_SOCKET;
@@ -231,11 +290,10 @@ bool BaseUdpServer::StartServer(const ServerOps &ops)
 	m_result = NULL;
 
 
-	// Initialize Winsock
-	iResult = WSAStartup(MAKEWORD(2,2), &wsaData);
-	if (iResult != 0) {
+	// Initialize socket library
+	if (!SocketHelper::Startup()) {
 
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) WSAStartup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket startup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		return false;
 	}
 
@@ -252,32 +310,48 @@ bool BaseUdpServer::StartServer(const ServerOps &ops)
 	iResult = getaddrinfo(NULL, m_port.c_str(), &iHints, &m_result);
 	if ( iResult != 0 ) {
 		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) getaddrinfo failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-		WSACleanup();
+		SocketHelper::Cleanup();
 		return false;
 	}
 
-	// Create a SOCKET for connecting to server
-	m_listenSocket = socket(m_result->ai_family, m_result->ai_socktype, m_result->ai_protocol);
+	// Create the listening socket, with SO_REUSEPORT if more than one acceptor
+	m_isUdpOffload=false;
+	m_isSendOffload=false;
+	bool isReusePort=(ops.acceptorCount>1);
+	m_listenSocket = openListenSocket(isReusePort);
 	if (m_listenSocket == INVALID_SOCKET) {
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		cleanUpServer();
 		return false;
 	}
 
-	// set SO_REUSEADDR for setsockopt function to reuse the port immediately as soon as the service exits.
-	int sockoptval = 1;
-	setsockopt(m_listenSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char*>(&sockoptval), sizeof(int));
+	int nTmp = sizeof(int);
+	getsockopt(m_listenSocket, SOL_SOCKET,SO_MAX_MSG_SIZE, (char *)&m_maxPacketSize,&nTmp);
 
-	// Setup the TCP listening socket
-	iResult = bind( m_listenSocket, m_result->ai_addr, static_cast<int>(m_result->ai_addrlen));
-	if (iResult == SOCKET_ERROR) {
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) bind failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+	if(ops.isUdpOffload)
+	{
+		// the receive coalescing is enabled only with the send offload, so both are used or neither
+		if(SocketHelper::IsSendOffloadSupported(m_listenSocket))
+			m_isUdpOffload=SocketHelper::EnableReceiveOffload(m_listenSocket,UDP_OFFLOAD_MAX_BYTE_SIZE);
+		m_isSendOffload=m_isUdpOffload;
+	}
+
+	if(!startTimerWheel(ops))
+	{
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) timer wheel start failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		cleanUpServer();
 		return false;
 	}
 
-	int nTmp = sizeof(int);
-	getsockopt(m_listenSocket, SOL_SOCKET,SO_MAX_MSG_SIZE, (char *)&m_maxPacketSize,&nTmp);
+	// the broadcast worker threads are started by the first broadcast
+	m_broadcastThreadCount=ops.broadcastThreadCount;
+
+	// the kernel keeps a peer on one SO_REUSEPORT socket, so the datagrams of a peer stay in order
+	if(!startAcceptors(ops.acceptorCount,isReusePort,false))
+	{
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) acceptor start failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		cleanUpServer();
+		return false;
+	}
 
 	// Create thread 1.
 	if(Start())
@@ -290,6 +364,35 @@ bool BaseUdpServer::StartServer(const ServerOps &ops)
 
 }
 
+SOCKET BaseUdpServer::openListenSocket(bool &isReusePort)
+{
+	// Create a SOCKET for connecting to server
+	SOCKET listenSocket = socket(m_result->ai_family, m_result->ai_socktype, m_result->ai_protocol);
+	if (listenSocket == INVALID_SOCKET) {
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		return INVALID_SOCKET;
+	}
+
+	// set SO_REUSEADDR for setsockopt function to reuse the port immediately as soon as the service exits.
+	int sockoptval = 1;
+	setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char*>(&sockoptval), sizeof(int));
+	if(isReusePort)
+		isReusePort=SocketHelper::SetReusePort(listenSocket);
+
+	// Setup the UDP listening socket
+	int iResult = bind( listenSocket, m_result->ai_addr, static_cast<int>(m_result->ai_addrlen));
+	if (iResult == SOCKET_ERROR) {
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) bind failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		SocketHelper::CloseSocket(listenSocket);
+		return INVALID_SOCKET;
+	}
+
+	// the additional sockets follow the offload setting of the first one
+	if(m_isUdpOffload)
+		SocketHelper::EnableReceiveOffload(listenSocket,UDP_OFFLOAD_MAX_BYTE_SIZE);
+	return listenSocket;
+}
+
 void BaseUdpServer::StopServer()
 {
 	epl::LockObj lock(m_baseServerLock);
@@ -304,9 +407,10 @@ void BaseUdpServer::StopServer()
 		if (iResult == SOCKET_ERROR) {
 			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		}
-		closesocket(m_listenSocket);
+		SocketHelper::CloseSocket(m_listenSocket);
 		m_listenSocket=INVALID_SOCKET;
 	}
+	stopAcceptors();
 	TerminateAfter(m_waitTime);
 	shutdownAllClient();
 	cleanUpServer();
@@ -317,5 +421,51 @@ void BaseUdpServer::cleanUpServer()
 {
 	BaseServer::cleanUpServer();
 	m_maxPacketSize=0;
+	m_isUdpOffload=false;
+	m_isSendOffload=false;
+}
+
+void BaseUdpServer::listenLoop(SOCKET listenSocket)
+{
+	// the receive coalescing is set on the socket once, so it is read once for the loop
+	bool isReceiveOffload=m_isUdpOffload;
+	// the coalesced datagrams can be larger than the maximum datagram size
+	unsigned int bufferSize=m_maxPacketSize;
+	if(isReceiveOffload && bufferSize<UDP_OFFLOAD_MAX_BYTE_SIZE)
+		bufferSize=UDP_OFFLOAD_MAX_BYTE_SIZE;
+	Packet recvPacket(NULL,bufferSize);
+	char *packetData=const_cast<char*>(recvPacket.GetPacket());
+	int length=recvPacket.GetPacketByteSize();
+	sockaddr clientSockAddr;
+	while(m_listenSocket!=INVALID_SOCKET)
+	{
+		int sockAddrSize=sizeof(sockaddr);
+		unsigned int segmentSize=0;
+		int recvLength;
+		if(isReceiveOffload)
+			recvLength=SocketHelper::ReceiveSegments(listenSocket,packetData,length,&clientSockAddr,&sockAddrSize,&segmentSize);
+		else
+			recvLength=recvfrom(listenSocket,packetData,length, 0,&clientSockAddr,&sockAddrSize);
+		dispatchDatagram(packetData,recvLength,segmentSize,clientSockAddr);
+	}
+}
+
+void BaseUdpServer::dispatchDatagram(const char *recvData,int recvLength,unsigned int segmentSize,const sockaddr &clientSockAddr)
+{
+	if(recvLength<=0 || segmentSize==0 || static_cast<unsigned int>(recvLength)<=segmentSize)
+	{
+		processDatagram(recvData,recvLength,clientSockAddr);
+		return;
+	}
+	// the coalesced datagrams are all segmentSize bytes except the last
+	int offset=0;
+	while(offset<recvLength)
+	{
+		int datagramLength=recvLength-offset;
+		if(datagramLength>static_cast<int>(segmentSize))
+			datagramLength=static_cast<int>(segmentSize);
+		processDatagram(recvData+offset,datagramLength,clientSockAddr);
+		offset+=datagramLength;
+	}
 }
 
@@ -33,45 +33,38 @@ static char THIS_FILE[] = __FILE__;
 #endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
 
 using namespace epse;
-BaseUdpSocket::BaseUdpSocket(ServerCallbackInterface *callBackObj,unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType): BaseSocket(callBackObj,waitTimeMilliSec,lockPolicyType)
+BaseUdpSocket::BaseUdpSocket(ServerCallbackInterface *callBackObj,unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType): BaseSocket(callBackObj,waitTimeMilliSec,lockPolicyType),m_packetList(UDP_RECEIVE_QUEUE_SIZE)
 {
-	
-	switch(lockPolicyType)
-	{
-	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_listLock=EP_NEW epl::CriticalSectionEx();
-		break;
-	case epl::LOCK_POLICY_MUTEX:
-		m_listLock=EP_NEW epl::Mutex();
-		break;
-	case epl::LOCK_POLICY_NONE:
-		m_listLock=EP_NEW epl::NoLock();
-		break;
-	default:
-		m_listLock=NULL;
-		break;
-	}
 	m_maxPacketSize=0;
 
 }
 
 BaseUdpSocket::~BaseUdpSocket()
 {
-	m_listLock->Lock();
+	clearPacketList();
+}
 
+bool BaseUdpSocket::pushPacket(Packet *packet)
+{
+	if(!packet)
+		return false;
+	if(packet->GetPacketByteSize())
+		markActive();
+	packet->RetainObj();
+	if(m_packetList.TryPush(packet))
+		return true;
+	packet->ReleaseObj();
+	return false;
+}
+
+void BaseUdpSocket::clearPacketList()
+{
 	Packet *removeElem=NULL;
-	while(!m_packetList.empty())
+	while(m_packetList.TryPop(removeElem))
 	{
-		removeElem=m_packetList.front();
 		if(removeElem)
 			removeElem->ReleaseObj();
-		m_packetList.pop();
 	}
-	m_listLock->Unlock();
-
-	if(m_listLock)
-		EP_DELETE m_listLock;
-	m_listLock=NULL;
 }
 
 void BaseUdpSocket::setMaxPacketByteSize(unsigned int maxPacketSize)
@@ -88,6 +81,14 @@ int BaseUdpSocket::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 	return 0;
 }
 
+int BaseUdpSocket::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	epl::LockObj lock(m_baseSocketLock);
+	if(m_owner)
+		return ((BaseUdpServer*)m_owner)->sendBatch(packetList,packetCount,m_sockAddr,waitTimeInMilliSec,sendStatus);
+	return 0;
+}
+
 unsigned int BaseUdpSocket::GetMaxPacketByteSize() const
 {
 	return m_maxPacketSize;
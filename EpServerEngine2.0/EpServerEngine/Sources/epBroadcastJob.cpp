@@ -0,0 +1,76 @@
+/*! 
+BroadcastJob for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epBroadcastJob.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+BroadcastJob::BroadcastJob(Packet *packet,unsigned int waitTimeMilliSec,Priority priority,epl::LockPolicy lockPolicyType):BaseJob(priority,lockPolicyType)
+{
+	m_packet=packet;
+	if(m_packet)
+		m_packet->RetainObj();
+	m_waitTime=waitTimeMilliSec;
+}
+
+BroadcastJob::~BroadcastJob()
+{
+	for(int trav=0;trav<m_socketList.size();trav++)
+	{
+		m_socketList.at(trav)->ReleaseObj();
+	}
+	m_socketList.clear();
+	if(m_packet)
+		m_packet->ReleaseObj();
+}
+
+void BroadcastJob::AddSocket(BaseSocket *socket)
+{
+	socket->RetainObj();
+	m_socketList.push_back(socket);
+}
+
+unsigned int BroadcastJob::GetSocketCount() const
+{
+	return m_socketList.size();
+}
+
+void BroadcastJob::Send()
+{
+	if(!m_packet)
+		return;
+	for(int trav=0;trav<m_socketList.size();trav++)
+	{
+		BaseSocket *socket=m_socketList.at(trav);
+		if(socket->IsConnectionAlive())
+			socket->Send(*m_packet,m_waitTime);
+	}
+}
@@ -0,0 +1,228 @@
+/*!
+ForwardClientPool for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epForwardClientPool.h"
+#include "epAsyncTcpClient.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+ForwardClientPool::ForwardClientPool(unsigned int idleClientCount,unsigned int linkCount,epl::LockPolicy lockPolicyType):m_clientRemover(WAITTIME_INIFINITE,lockPolicyType)
+{
+	m_lockPolicy=lockPolicyType;
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_poolLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_poolLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_poolLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_poolLock=NULL;
+		break;
+	}
+	m_idleClientCount=idleClientCount;
+	m_linkCount=linkCount;
+}
+
+ForwardClientPool::~ForwardClientPool()
+{
+	Clear();
+	if(m_poolLock)
+		EP_DELETE m_poolLock;
+	m_poolLock=NULL;
+}
+
+ClientInterface *ForwardClientPool::Acquire(const ForwardServerInfo &forwardServerInfo,ClientCallbackInterface *callBackObj)
+{
+	epl::EpTString key=getKey(forwardServerInfo);
+	if(m_linkCount)
+	{
+		MultiplexLink *link=NULL;
+		{
+			epl::LockObj lock(m_poolLock);
+			ForwardTarget &target=m_targetMap[key];
+			if(target.m_linkList.size()<m_linkCount)
+			{
+				// the reference of the pool is released by Clear
+				link=EP_NEW MultiplexLink(forwardServerInfo,m_lockPolicy);
+				target.m_linkList.push_back(link);
+			}
+			else
+			{
+				// the link with the least sessions, preferring the connected one
+				unsigned int minSessionCount=0;
+				for(int trav=0;trav<target.m_linkList.size();trav++)
+				{
+					MultiplexLink *curLink=target.m_linkList.at(trav);
+					unsigned int sessionCount=curLink->GetSessionCount();
+					if(!link || (curLink->IsConnectionAlive() && !link->IsConnectionAlive()) || (curLink->IsConnectionAlive()==link->IsConnectionAlive() && sessionCount<minSessionCount))
+					{
+						link=curLink;
+						minSessionCount=sessionCount;
+					}
+				}
+			}
+			// Clear may release the link while the session is opened
+			link->RetainObj();
+		}
+		MultiplexSession *session=link->OpenSession(callBackObj);
+		link->ReleaseObj();
+		if(!session->IsConnectionAlive())
+		{
+			session->ReleaseObj();
+			return NULL;
+		}
+		return session;
+	}
+
+	AsyncTcpClient *client=NULL;
+	{
+		epl::LockObj lock(m_poolLock);
+		ForwardTarget &target=m_targetMap[key];
+		while(!client && target.m_idleClientList.size())
+		{
+			client=target.m_idleClientList.back();
+			target.m_idleClientList.pop_back();
+			if(!client->IsConnectionAlive())
+			{
+				m_clientRemover.Push(client);
+				client=NULL;
+			}
+		}
+	}
+	if(client)
+	{
+		client->SetCallbackObject(callBackObj);
+	}
+	else
+	{
+		client=EP_NEW AsyncTcpClient(m_lockPolicy);
+		ClientOps ops;
+		ops.callBackObj=callBackObj;
+		ops.hostName=forwardServerInfo.hostname;
+		ops.port=forwardServerInfo.port;
+		ops.isAsynchronousReceive=false;
+		if(!client->Connect(ops))
+		{
+			m_clientRemover.Push(client);
+			return NULL;
+		}
+	}
+	epl::LockObj lock(m_poolLock);
+	m_acquiredClientMap[client]=key;
+	return client;
+}
+
+void ForwardClientPool::Release(ClientInterface *client,bool isReusable)
+{
+	if(m_linkCount)
+	{
+		MultiplexSession *session=static_cast<MultiplexSession*>(client);
+		session->Disconnect();
+		session->ReleaseObj();
+		return;
+	}
+
+	AsyncTcpClient *forwardClient=static_cast<AsyncTcpClient*>(client);
+	{
+		epl::LockObj lock(m_poolLock);
+		map<ClientInterface*,epl::EpTString>::iterator iter=m_acquiredClientMap.find(client);
+		// the client is retired by the callback, so the late replies do not reach the disconnected proxy connection
+		forwardClient->SetCallbackObject(this);
+		if(iter==m_acquiredClientMap.end())
+		{
+			// not acquired from the pool, so it is killed rather than leaked
+			EP_ASSERT_EXPR(0,_T("The client is not acquired from the pool : %x"),client);
+		}
+		else
+		{
+			ForwardTarget &target=m_targetMap[iter->second];
+			m_acquiredClientMap.erase(iter);
+			if(isReusable && forwardClient->IsConnectionAlive() && target.m_idleClientList.size()<m_idleClientCount)
+			{
+				target.m_idleClientList.push_back(forwardClient);
+				return;
+			}
+		}
+		if(!forwardClient->IsConnectionAlive())
+		{
+			m_clientRemover.Push(forwardClient);
+			return;
+		}
+	}
+	forwardClient->Disconnect();
+	m_clientRemover.Push(forwardClient);
+}
+
+bool ForwardClientPool::IsMultiplexing() const
+{
+	return m_linkCount>0;
+}
+
+void ForwardClientPool::Clear()
+{
+	// the pool lock is held across the teardown, so Acquire does not pick the link being closed
+	epl::LockObj lock(m_poolLock);
+	map<epl::EpTString,ForwardTarget>::iterator iter;
+	for(iter=m_targetMap.begin();iter!=m_targetMap.end();iter++)
+	{
+		vector<AsyncTcpClient*> &clientList=iter->second.m_idleClientList;
+		for(int trav=0;trav<clientList.size();trav++)
+		{
+			clientList.at(trav)->Disconnect();
+			m_clientRemover.Push(clientList.at(trav));
+		}
+		// the sessions still acquired keep the closed link until released
+		vector<MultiplexLink*> &linkList=iter->second.m_linkList;
+		for(int trav=0;trav<linkList.size();trav++)
+		{
+			linkList.at(trav)->Close();
+			linkList.at(trav)->ReleaseObj();
+		}
+	}
+	m_targetMap.clear();
+}
+
+void ForwardClientPool::OnReceived(ClientInterface *client,const Packet*receivedPacket,ReceiveStatus status)
+{
+}
+
+epl::EpTString ForwardClientPool::getKey(const ForwardServerInfo &forwardServerInfo)
+{
+	epl::EpTString key=forwardServerInfo.hostname;
+	key.append(_T(":"));
+	key.append(forwardServerInfo.port);
+	return key;
+}
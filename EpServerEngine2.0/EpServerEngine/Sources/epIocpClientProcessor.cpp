@@ -44,7 +44,7 @@ void IocpClientProcessor::DoJob(BaseWorkerThread *workerThread,  BaseJob* const
 		
 		if(sendStatus==SEND_STATUS_FAIL_TIME_OUT)
 		{
-			workerThread->Push(data);
+			job->GetClient()->retrySend(workerThread,data);
 		}
 		else
 		{
@@ -63,7 +63,7 @@ void IocpClientProcessor::DoJob(BaseWorkerThread *workerThread,  BaseJob* const
 		
 		if(receiveStatus==RECEIVE_STATUS_FAIL_TIME_OUT)
 		{
-			workerThread->Push(data);
+			job->GetClient()->waitForReceive(workerThread,data);
 		}
 		else
 		{
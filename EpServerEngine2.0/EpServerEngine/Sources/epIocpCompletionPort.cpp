@@ -0,0 +1,274 @@
+/*! 
+IocpCompletionPort for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epIocpCompletionPort.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+/// Overlapped structure for the parked object
+typedef struct _IocpOverlapped{
+	/// overlapped (must be the first member)
+	OVERLAPPED m_overlapped;
+	/// the parked object
+	epl::SmartObject *m_context;
+	/// flag whether the overlapped is for the send
+	bool m_isSend;
+}IocpOverlapped;
+
+IocpCompletionPort::IocpCompletionPort(IocpCompletionPortDelegate *delegateObj,unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType):Thread(EP_THREAD_PRIORITY_NORMAL,lockPolicyType)
+{
+	m_completionPort=NULL;
+	m_isClosing=false;
+	m_delegate=delegateObj;
+	m_waitTime=waitTimeMilliSec;
+	m_lockPolicy=lockPolicyType;
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_portLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_portLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_portLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_portLock=NULL;
+		break;
+	}
+}
+
+IocpCompletionPort::~IocpCompletionPort()
+{
+	Close();
+	if(m_portLock)
+		EP_DELETE m_portLock;
+}
+
+bool IocpCompletionPort::Create()
+{
+	epl::LockObj lock(m_portLock);
+	if(m_completionPort)
+		return true;
+	m_completionPort=CreateIoCompletionPort(INVALID_HANDLE_VALUE,NULL,0,1);
+	if(!m_completionPort)
+	{
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) CreateIoCompletionPort failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this,GetLastError());
+		return false;
+	}
+	if(!Start())
+	{
+		CloseHandle(m_completionPort);
+		m_completionPort=NULL;
+		return false;
+	}
+	return true;
+}
+
+void IocpCompletionPort::Close()
+{
+	{
+		epl::LockObj lock(m_portLock);
+		if(!m_completionPort || m_isClosing)
+			return;
+		m_isClosing=true;
+#if (_WIN32_WINNT >= 0x0600)
+		// each cancelled I/O still completes, so the dispatch loop releases its object
+		map<LPOVERLAPPED,SOCKET>::iterator iter;
+		for(iter=m_pendingMap.begin();iter!=m_pendingMap.end();iter++)
+			CancelIoEx(reinterpret_cast<HANDLE>(iter->second),iter->first);
+#endif //(_WIN32_WINNT >= 0x0600)
+		// NULL overlapped with zero key stops the dispatch loop
+		PostQueuedCompletionStatus(m_completionPort,0,0,NULL);
+	}
+	// the lock is released while waiting, since the dispatch loop takes it to complete the receives
+	TerminateAfter(m_waitTime);
+
+	epl::LockObj lock(m_portLock);
+	CloseHandle(m_completionPort);
+	m_completionPort=NULL;
+	m_pendingMap.clear();
+	m_isClosing=false;
+}
+
+bool IocpCompletionPort::Associate(SOCKET socket)
+{
+	epl::LockObj lock(m_portLock);
+	if(!m_completionPort)
+		return false;
+	if(CreateIoCompletionPort(reinterpret_cast<HANDLE>(socket),m_completionPort,0,0)!=m_completionPort)
+	{
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) CreateIoCompletionPort failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this,GetLastError());
+		return false;
+	}
+	return true;
+}
+
+bool IocpCompletionPort::WaitForReceive(SOCKET socket,epl::SmartObject *context,char *buffer,unsigned int bufferByteSize)
+{
+	epl::LockObj lock(m_portLock);
+	if(socket==INVALID_SOCKET || !m_completionPort || m_isClosing)
+		return false;
+
+	IocpOverlapped *receiveOverlapped=EP_NEW IocpOverlapped();
+	memset(&receiveOverlapped->m_overlapped,0,sizeof(OVERLAPPED));
+	receiveOverlapped->m_context=context;
+	receiveOverlapped->m_isSend=false;
+	context->RetainObj();
+	// registered before WSARecv, since the completion may be dequeued before WSARecv returns
+	m_pendingMap[&receiveOverlapped->m_overlapped]=socket;
+
+	// zero-byte receive completes when the data arrives or the connection is closed
+	WSABUF receiveBuffer;
+	receiveBuffer.buf=buffer;
+	receiveBuffer.len=buffer?bufferByteSize:0;
+	DWORD flags=0;
+	if(WSARecv(socket,&receiveBuffer,1,NULL,&flags,&receiveOverlapped->m_overlapped,NULL)==SOCKET_ERROR)
+	{
+		int error=WSAGetLastError();
+		if(error!=WSA_IO_PENDING)
+		{
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) WSARecv failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this,error);
+			m_pendingMap.erase(&receiveOverlapped->m_overlapped);
+			context->ReleaseObj();
+			EP_DELETE receiveOverlapped;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool IocpCompletionPort::WaitForSend(SOCKET socket,epl::SmartObject *context,WSABUF *bufferList,unsigned int bufferCount)
+{
+	epl::LockObj lock(m_portLock);
+	if(socket==INVALID_SOCKET || !m_completionPort || m_isClosing)
+		return false;
+
+	IocpOverlapped *sendOverlapped=EP_NEW IocpOverlapped();
+	memset(&sendOverlapped->m_overlapped,0,sizeof(OVERLAPPED));
+	sendOverlapped->m_context=context;
+	sendOverlapped->m_isSend=true;
+	context->RetainObj();
+	// registered before WSASend, since the completion may be dequeued before WSASend returns
+	m_pendingMap[&sendOverlapped->m_overlapped]=socket;
+
+	// the buffer list is captured by WSASend, while the buffers must be kept until the completion
+	if(WSASend(socket,bufferList,bufferCount,NULL,0,&sendOverlapped->m_overlapped,NULL)==SOCKET_ERROR)
+	{
+		int error=WSAGetLastError();
+		if(error!=WSA_IO_PENDING)
+		{
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) WSASend failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this,error);
+			m_pendingMap.erase(&sendOverlapped->m_overlapped);
+			context->ReleaseObj();
+			EP_DELETE sendOverlapped;
+			return false;
+		}
+	}
+	return true;
+}
+
+void IocpCompletionPort::execute()
+{
+	bool isStopped=false;
+#if (_WIN32_WINNT >= 0x0600)
+	// dequeue the completions in batch to save the system calls
+	OVERLAPPED_ENTRY entries[IOCP_COMPLETION_BATCH_COUNT];
+	ULONG entryCount;
+	while(1)
+	{
+		entryCount=0;
+		// once stopped, only drain the completions of the I/O still pending
+		if(isStopped && !getPendingCount())
+			break;
+		if(!GetQueuedCompletionStatusEx(m_completionPort,entries,IOCP_COMPLETION_BATCH_COUNT,&entryCount,isStopped?m_waitTime:INFINITE,FALSE))
+			break;
+		for(ULONG trav=0;trav<entryCount;trav++)
+		{
+			if(!entries[trav].lpOverlapped)
+			{
+				isStopped=true;
+				continue;
+			}
+			// Internal holds the status of the completed request
+			completeJob(entries[trav].lpOverlapped,entries[trav].dwNumberOfBytesTransferred,entries[trav].lpOverlapped->Internal==0,isStopped);
+		}
+	}
+#else //(_WIN32_WINNT >= 0x0600)
+	DWORD transferredByte;
+	ULONG_PTR completionKey;
+	LPOVERLAPPED overlapped;
+	while(1)
+	{
+		overlapped=NULL;
+		// once stopped, only drain the completions of the I/O still pending
+		if(isStopped && !getPendingCount())
+			break;
+		BOOL result=GetQueuedCompletionStatus(m_completionPort,&transferredByte,&completionKey,&overlapped,isStopped?m_waitTime:INFINITE);
+		if(!overlapped)
+		{
+			if(result && !isStopped)
+			{
+				isStopped=true;
+				continue;
+			}
+			break;
+		}
+		completeJob(overlapped,transferredByte,result!=FALSE,isStopped);
+	}
+#endif //(_WIN32_WINNT >= 0x0600)
+}
+
+void IocpCompletionPort::completeJob(LPOVERLAPPED overlapped,unsigned long transferredByte,bool isSucceeded,bool isStopped)
+{
+	// failed completion is also handed over, so the object observes the socket error
+	IocpOverlapped *iocpOverlapped=CONTAINING_RECORD(overlapped,IocpOverlapped,m_overlapped);
+	{
+		epl::LockObj lock(m_portLock);
+		m_pendingMap.erase(overlapped);
+	}
+	if(!isStopped)
+	{
+		if(iocpOverlapped->m_isSend)
+			m_delegate->OnSendCompleted(iocpOverlapped->m_context,transferredByte,isSucceeded);
+		else
+			m_delegate->OnIoCompleted(iocpOverlapped->m_context,transferredByte,isSucceeded);
+	}
+	iocpOverlapped->m_context->ReleaseObj();
+	EP_DELETE iocpOverlapped;
+}
+
+size_t IocpCompletionPort::getPendingCount() const
+{
+	epl::LockObj lock(m_portLock);
+	return m_pendingMap.size();
+}
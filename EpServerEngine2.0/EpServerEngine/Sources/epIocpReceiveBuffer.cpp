@@ -0,0 +1,166 @@
+/*! 
+IocpReceiveBuffer for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epIocpReceiveBuffer.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+IocpReceiveBuffer::IocpReceiveBuffer(unsigned int bufferByteSize)
+{
+	m_bufferByteSize=bufferByteSize;
+	m_buffer=EP_NEW char[m_bufferByteSize];
+	m_dataOffset=0;
+	m_dataByteSize=0;
+	m_isPending=false;
+	m_isClosed=false;
+	m_completeEvent=epl::EventEx(true,true);
+}
+
+IocpReceiveBuffer::~IocpReceiveBuffer()
+{
+	for(int trav=0;trav<m_waitingJobList.size();trav++)
+		m_waitingJobList.at(trav)->ReleaseObj();
+	m_waitingJobList.clear();
+	if(m_buffer)
+		EP_DELETE[] m_buffer;
+	m_buffer=NULL;
+}
+
+char *IocpReceiveBuffer::GetBuffer()
+{
+	return m_buffer;
+}
+
+unsigned int IocpReceiveBuffer::GetBufferByteSize() const
+{
+	return m_bufferByteSize;
+}
+
+unsigned int IocpReceiveBuffer::GetDataByteSize() const
+{
+	return m_dataByteSize;
+}
+
+bool IocpReceiveBuffer::IsPending() const
+{
+	return m_isPending;
+}
+
+bool IocpReceiveBuffer::IsClosed() const
+{
+	return m_isClosed;
+}
+
+void IocpReceiveBuffer::SetPending()
+{
+	EP_ASSERT(!m_isPending && !m_dataByteSize);
+	m_dataOffset=0;
+	m_isPending=true;
+	m_completeEvent.ResetEvent();
+}
+
+bool IocpReceiveBuffer::AddWaitingJob(BaseJob *job)
+{
+	if(!m_isPending)
+		return false;
+	job->RetainObj();
+	m_waitingJobList.push_back(job);
+	return true;
+}
+
+bool IocpReceiveBuffer::WaitForComplete(unsigned int waitTimeInMilliSec)
+{
+	return m_completeEvent.WaitForEvent(waitTimeInMilliSec);
+}
+
+void IocpReceiveBuffer::Complete(unsigned long transferredByte,bool isSucceeded,vector<BaseJob*> &retWaitingJobList)
+{
+	if(!m_isPending)
+		return;
+	m_isPending=false;
+	m_dataOffset=0;
+	m_dataByteSize=0;
+	// zero byte completion means the graceful close
+	if(!isSucceeded || transferredByte==0)
+		m_isClosed=true;
+	else
+		m_dataByteSize=transferredByte;
+	retWaitingJobList.insert(retWaitingJobList.end(),m_waitingJobList.begin(),m_waitingJobList.end());
+	m_waitingJobList.clear();
+	m_completeEvent.SetEvent();
+}
+
+unsigned int IocpReceiveBuffer::Read(char *data,unsigned int byteSize)
+{
+	EP_ASSERT(!m_isPending);
+	unsigned int copyLength=(byteSize<m_dataByteSize)?byteSize:m_dataByteSize;
+	if(copyLength)
+	{
+		memcpy(data,m_buffer+m_dataOffset,copyLength);
+		m_dataOffset+=copyLength;
+		m_dataByteSize-=copyLength;
+	}
+	return copyLength;
+}
+
+int IocpReceiveBuffer::Receive(SOCKET socket,Packet &packet)
+{
+	int length=packet.GetPacketByteSize();
+	char *packetData=const_cast<char*>(packet.GetPacket());
+	int readLength=0;
+	if(length>0)
+		readLength=(int)Read(packetData,(unsigned int)length);
+	length-=readLength;
+	packetData+=readLength;
+	while(length>0)
+	{
+		int recvLength=recv(socket,packetData, length, 0);
+		readLength+=recvLength;
+		if(recvLength<=0)
+		{
+			return recvLength;
+		}
+		length-=recvLength;
+		packetData+=recvLength;
+	}
+	return readLength;
+}
+
+void IocpReceiveBuffer::Reset(vector<BaseJob*> &retWaitingJobList)
+{
+	m_isPending=false;
+	m_isClosed=false;
+	m_dataOffset=0;
+	m_dataByteSize=0;
+	retWaitingJobList.insert(retWaitingJobList.end(),m_waitingJobList.begin(),m_waitingJobList.end());
+	m_waitingJobList.clear();
+	m_completeEvent.SetEvent();
+}
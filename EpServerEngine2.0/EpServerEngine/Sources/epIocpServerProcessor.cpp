@@ -43,7 +43,7 @@ void IocpServerProcessor::DoJob(BaseWorkerThread *workerThread,  BaseJob* const
 		
 		if(sendStatus==SEND_STATUS_FAIL_TIME_OUT)
 		{
-			workerThread->Push(data);
+			job->GetSocket()->retrySend(workerThread,data);
 		}
 		else
 		{
@@ -62,7 +62,7 @@ void IocpServerProcessor::DoJob(BaseWorkerThread *workerThread,  BaseJob* const
 		
 		if(receiveStatus==RECEIVE_STATUS_FAIL_TIME_OUT)
 		{
-			workerThread->Push(data);
+			job->GetSocket()->waitForReceive(workerThread,data);
 		}
 		else
 		{
@@ -92,6 +92,9 @@ void IocpServerProcessor::DoJob(BaseWorkerThread *workerThread,  BaseJob* const
 			job->GetSocket()->GetCallbackObject()->OnDisconnect(job->GetSocket());
 
 		break;
+	case IocpServerJob::IOCP_SERVER_JOB_TYPE_FLUSH:
+		job->GetSocket()->flushSendQueue(workerThread,data);
+		break;
 	}
 }
 
@@ -36,50 +36,27 @@ using namespace epse;
 
 IocpTcpClient::IocpTcpClient(epl::LockPolicy lockPolicyType) :BaseTcpClient(lockPolicyType)
 {
-	switch(lockPolicyType)
-	{
-	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_workerLock=EP_NEW epl::CriticalSectionEx();
-		break;
-	case epl::LOCK_POLICY_MUTEX:
-		m_workerLock=EP_NEW epl::Mutex();
-		break;
-	case epl::LOCK_POLICY_NONE:
-		m_workerLock=EP_NEW epl::NoLock();
-		break;
-	default:
-		m_workerLock=NULL;
-		break;
-	}
-
+	m_jobScheduler=NULL;
 	m_isConnected=false;
+	m_completionPort=NULL;
+	m_ioEngineType=IO_ENGINE_TYPE_READINESS;
 }
 
 
 IocpTcpClient::IocpTcpClient(const IocpTcpClient& b) :BaseTcpClient(b)
 {
-	switch(m_lockPolicy)
-	{
-	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_workerLock=EP_NEW epl::CriticalSectionEx();
-		break;
-	case epl::LOCK_POLICY_MUTEX:
-		m_workerLock=EP_NEW epl::Mutex();
-		break;
-	case epl::LOCK_POLICY_NONE:
-		m_workerLock=EP_NEW epl::NoLock();
-		break;
-	default:
-		m_workerLock=NULL;
-		break;
-	}
+	m_jobScheduler=NULL;
 	m_isConnected=false;
+	m_completionPort=NULL;
+	m_ioEngineType=b.m_ioEngineType;
 }
 
 IocpTcpClient::~IocpTcpClient()
 {
-	if(m_workerLock)
-		EP_DELETE m_workerLock;
+	if(m_completionPort)
+		EP_DELETE m_completionPort;
+	if(m_jobScheduler)
+		EP_DELETE m_jobScheduler;
 }
 
 IocpTcpClient & IocpTcpClient::operator=(const IocpTcpClient&b)
@@ -89,21 +66,6 @@ IocpTcpClient & IocpTcpClient::operator=(const IocpTcpClient&b)
 
 		BaseTcpClient::operator =(b);
 		
-		switch(m_lockPolicy)
-		{
-		case epl::LOCK_POLICY_CRITICALSECTION:
-			m_workerLock=EP_NEW epl::CriticalSectionEx();
-			break;
-		case epl::LOCK_POLICY_MUTEX:
-			m_workerLock=EP_NEW epl::Mutex();
-			break;
-		case epl::LOCK_POLICY_NONE:
-			m_workerLock=EP_NEW epl::NoLock();
-			break;
-		default:
-			m_workerLock=NULL;
-			break;
-		}
 
 		m_isConnected=false;
 	}
@@ -116,39 +78,31 @@ void IocpTcpClient::execute()
 
 bool IocpTcpClient::Connect(const ClientOps &ops)
 {
-	m_workerLock->Lock();
-	while(!m_emptyWorkerList.empty())
-		m_emptyWorkerList.pop();
-
-	for(int trav=0;trav<m_workerList.size();trav++)
-	{
-		m_workerList.at(trav)->TerminateWorker(m_waitTime);
-		EP_DELETE m_workerList.at(trav);
-	}
-	m_workerList.clear();
-
 	int workerCount=ops.workerThreadCount;
 	if(workerCount==0)
 	{
 		workerCount=System::GetNumberOfCores()*2;
 	}
-	for(int trav=0;trav<workerCount;trav++)
-	{
-		BaseWorkerThread *workerThread=WorkerThreadFactory::GetWorkerThread(BaseWorkerThread::THREAD_LIFE_SUSPEND_AFTER_WORK);
-
-		workerThread->SetCallBackClass(this);
-
-		m_workerList.push_back(workerThread);
-		m_emptyWorkerList.push(workerThread);
-		workerThread->SetJobProcessor(EP_NEW IocpClientProcessor());
-		workerThread->Start();
-	}
-	m_workerLock->Unlock();
+	if(!m_jobScheduler)
+		m_jobScheduler=EP_NEW JobScheduler(m_waitTime,m_lockPolicy);
+	IocpClientProcessor *jobProcessor=EP_NEW IocpClientProcessor();
+	m_jobScheduler->Create(workerCount,jobProcessor);
+	jobProcessor->ReleaseObj();
 
 	epl::LockObj lock(m_generalLock);
 	if(IsConnectionAlive())
 		return true;
 
+	m_ioEngineType=ops.ioEngineType;
+	if(!m_completionPort)
+		m_completionPort=EP_NEW IocpCompletionPort(this,m_waitTime,m_lockPolicy);
+	if(!m_completionPort->Create())
+		return false;
+	vector<BaseJob*> waitingJobList;
+	m_recvBuffer.Reset(waitingJobList);
+	for(int trav=0;trav<waitingJobList.size();trav++)
+		waitingJobList.at(trav)->ReleaseObj();
+
 	if(ops.callBackObj)
 		m_callBackObj=ops.callBackObj;
 	EP_ASSERT(m_callBackObj);
@@ -174,15 +128,13 @@ bool IocpTcpClient::Connect(const ClientOps &ops)
 	SetWaitTime(ops.waitTimeMilliSec);
 
 
-	WSADATA wsaData;
 	m_connectSocket=INVALID_SOCKET;
 	struct addrinfo hints;
 	int iResult;
 
-	// Initialize Winsock
-	iResult = WSAStartup(MAKEWORD(2,2), &wsaData);
-	if (iResult != 0) {
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) WSAStartup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+	// Initialize socket library
+	if (!SocketHelper::Startup()) {
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket startup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		return false;
 	}
 
@@ -195,7 +147,7 @@ bool IocpTcpClient::Connect(const ClientOps &ops)
 	iResult = getaddrinfo(m_hostName.c_str(), m_port.c_str(), &hints, &m_result);
 	if ( iResult != 0 ) {
 		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) getaddrinfo failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-		WSACleanup();
+		SocketHelper::Cleanup();
 		return false;
 	}
 
@@ -215,7 +167,7 @@ bool IocpTcpClient::Connect(const ClientOps &ops)
 		// Connect to server.
 		iResult = connect( m_connectSocket, iPtr->ai_addr, static_cast<int>(iPtr->ai_addrlen));
 		if (iResult == SOCKET_ERROR) {
-			closesocket(m_connectSocket);
+			SocketHelper::CloseSocket(m_connectSocket);
 			m_connectSocket = INVALID_SOCKET;
 			continue;
 		}
@@ -226,6 +178,11 @@ bool IocpTcpClient::Connect(const ClientOps &ops)
 		cleanUpClient();
 		return false;
 	}
+	if(!m_completionPort->Associate(m_connectSocket))
+	{
+		cleanUpClient();
+		return false;
+	}
 	m_isConnected=true;
 	return true;
 
@@ -251,7 +208,7 @@ void IocpTcpClient::Disconnect()
 		// shutdown the connection since no more data will be sent
 		int iResult = shutdown(m_connectSocket, SD_SEND);
 		if (iResult == SOCKET_ERROR) {
-			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this, WSAGetLastError());
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this, SocketHelper::GetLastSocketError());
 		}
 
 	}
@@ -262,17 +219,8 @@ void IocpTcpClient::Disconnect()
 
 	cleanUpClient();
 
-	m_workerLock->Lock();
-	while(!m_emptyWorkerList.empty())
-		m_emptyWorkerList.pop();
-
-	for(int trav=0;trav<m_workerList.size();trav++)
-	{
-		m_workerList.at(trav)->TerminateWorker(m_waitTime);
-		EP_DELETE m_workerList.at(trav);
-	}
-	m_workerList.clear();
-	m_workerLock->Unlock();
+	if(m_jobScheduler)
+		m_jobScheduler->Close();
 
 	m_callBackObj->OnDisconnect(this);
 	
@@ -286,17 +234,8 @@ void IocpTcpClient::disconnect()
 		m_isConnected=false;	
 		cleanUpClient();
 
-		m_workerLock->Lock();
-		while(!m_emptyWorkerList.empty())
-			m_emptyWorkerList.pop();
-
-		for(int trav=0;trav<m_workerList.size();trav++)
-		{
-			m_workerList.at(trav)->TerminateWorker(m_waitTime);
-			EP_DELETE m_workerList.at(trav);
-		}
-		m_workerList.clear();
-		m_workerLock->Unlock();
+		if(m_jobScheduler)
+			m_jobScheduler->Close();
 
 		m_callBackObj->OnDisconnect(this);
 	}
@@ -316,16 +255,78 @@ void IocpTcpClient::Send(Packet &packet,EventEx *completionEvent,ClientCallbackI
 void IocpTcpClient::Receive(EventEx *completionEvent,ClientCallbackInterface *callBackObj,Priority priority)
 {
 	IocpClientJob *newJob= EP_NEW IocpClientJob(this,IocpClientJob::IOCP_CLIENT_JOB_TYPE_RECEIVE,NULL,completionEvent,callBackObj,priority,m_lockPolicy);
-	pushJob(newJob);
+	waitForReceive(NULL,newJob);
 	newJob->ReleaseObj();
 }
 
+void IocpTcpClient::waitForReceive(BaseWorkerThread *workerThread,BaseJob *job)
+{
+	epl::LockObj lock(m_generalLock);
+	if(!IsConnectionAlive() || !m_completionPort)
+	{
+		pushJob(job);
+		return;
+	}
+	if(m_ioEngineType!=IO_ENGINE_TYPE_COMPLETION)
+	{
+		if(!m_completionPort->WaitForReceive(m_connectSocket,job))
+			pushJob(job);
+		return;
+	}
+
+	// buffered data and closed connection are handled without waiting
+	if(m_recvBuffer.GetDataByteSize() || m_recvBuffer.IsClosed())
+	{
+		pushJob(job);
+		return;
+	}
+	// overlapped receive is already in flight
+	if(m_recvBuffer.AddWaitingJob(job))
+		return;
+
+	m_recvBuffer.SetPending();
+	if(!m_completionPort->WaitForReceive(m_connectSocket,job,m_recvBuffer.GetBuffer(),m_recvBuffer.GetBufferByteSize()))
+	{
+		vector<BaseJob*> waitingJobList;
+		m_recvBuffer.Complete(0,false,waitingJobList);
+		pushJob(job);
+	}
+}
+
+void IocpTcpClient::OnIoCompleted(epl::SmartObject *context,unsigned long transferredByte,bool isSucceeded)
+{
+	vector<BaseJob*> waitingJobList;
+	m_generalLock->Lock();
+	m_recvBuffer.Complete(transferredByte,isSucceeded,waitingJobList);
+	m_generalLock->Unlock();
+
+	pushJob(static_cast<BaseJob*>(context));
+	for(int trav=0;trav<waitingJobList.size();trav++)
+	{
+		pushJob(waitingJobList.at(trav));
+		waitingJobList.at(trav)->ReleaseObj();
+	}
+}
+
+int IocpTcpClient::receivePacket(Packet &packet)
+{
+	if(m_ioEngineType==IO_ENGINE_TYPE_COMPLETION)
+		return m_recvBuffer.Receive(m_connectSocket,packet);
+	return receive(packet);
+}
+
 int IocpTcpClient::Send(const Packet &packet, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
 {
 	epl::LockObj lock(m_generalLock);
 	return BaseTcpClient::Send(packet,waitTimeInMilliSec,sendStatus);
 }
 
+int IocpTcpClient::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	epl::LockObj lock(m_generalLock);
+	return BaseTcpClient::BatchSend(packetList,packetCount,waitTimeInMilliSec,sendStatus);
+}
+
 Packet *IocpTcpClient::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *retStatus)
 {
 	epl::LockObj lock(m_generalLock);
@@ -336,48 +337,70 @@ Packet *IocpTcpClient::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 		return NULL;
 	}
 
-	// select routine
-	TIMEVAL	timeOutVal;
-	fd_set	fdSet;
-	int		retfdNum = 0;
-
-	FD_ZERO(&fdSet);
-	FD_SET(m_connectSocket, &fdSet);
-	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
+	if(m_ioEngineType==IO_ENGINE_TYPE_COMPLETION)
 	{
-		// socket select time out setting
-		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
-		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
-		// socket select
-		// socket read select
-		retfdNum = select(0,&fdSet, NULL, NULL, &timeOutVal);
+		if(!m_recvBuffer.GetDataByteSize() && !m_recvBuffer.IsClosed())
+		{
+			// the job doing nothing parks the overlapped receive, so the data is left for this call
+			if(!m_recvBuffer.IsPending())
+			{
+				IocpClientJob *newJob= EP_NEW IocpClientJob(this,IocpClientJob::IOCP_CLIENT_JOB_TYPE_NULL,NULL,NULL,NULL,PRIORITY_NORMAL,m_lockPolicy);
+				waitForReceive(NULL,newJob);
+				newJob->ReleaseObj();
+			}
+			// the lock is released while waiting, since the completion takes it
+			m_generalLock->Unlock();
+			m_recvBuffer.WaitForComplete(waitTimeInMilliSec);
+			m_generalLock->Lock();
+			if(!IsConnectionAlive())
+			{
+				if(retStatus)
+					*retStatus=RECEIVE_STATUS_FAIL_NOT_CONNECTED;
+				return NULL;
+			}
+		}
+		// only the data read by the overlapped receive is consumed
+		if(m_recvBuffer.IsPending() || (!m_recvBuffer.GetDataByteSize() && !m_recvBuffer.IsClosed()))
+		{
+			if(retStatus)
+				*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
+			return NULL;
+		}
+		if(!m_recvBuffer.GetDataByteSize())
+		{
+			disconnect();
+			if(retStatus)
+				*retStatus=RECEIVE_STATUS_FAIL_CONNECTION_CLOSING;
+			return NULL;
+		}
 	}
 	else
 	{
-		retfdNum = select(0, &fdSet,NULL, NULL, NULL);
-	}
-	if (retfdNum == SOCKET_ERROR)	// select failed
-	{
-		disconnect();
-		if(retStatus)
-			*retStatus=RECEIVE_STATUS_FAIL_SOCKET_ERROR;
-		return NULL;
-	}
-	else if (retfdNum == 0)		    // select time-out
-	{
-		if(retStatus)
-			*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
-		return NULL;
+		// wait routine
+		int		retfdNum = SocketHelper::WaitForSocket(m_connectSocket, SocketHelper::SOCKET_WAIT_READ, waitTimeInMilliSec);
+		if (retfdNum == SOCKET_ERROR)	// wait failed
+		{
+			disconnect();
+			if(retStatus)
+				*retStatus=RECEIVE_STATUS_FAIL_SOCKET_ERROR;
+			return NULL;
+		}
+		else if (retfdNum == 0)		    // wait time-out
+		{
+			if(retStatus)
+				*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
+			return NULL;
+		}
 	}
 
 	// receive routine
 	int iResult;
-	int size =receive(m_recvSizePacket);
+	int size =receivePacket(m_recvSizePacket);
 	if(size>0)
 	{
 		unsigned int shouldReceive=(reinterpret_cast<unsigned int*>(const_cast<char*>(m_recvSizePacket.GetPacket())))[0];
 		Packet *recvPacket=EP_NEW Packet(NULL,shouldReceive);
-		iResult = receive(*recvPacket);
+		iResult = receivePacket(*recvPacket);
 
 		if (iResult == shouldReceive) {
 			if(retStatus)
@@ -410,38 +433,13 @@ Packet *IocpTcpClient::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 }
 
 
-void IocpTcpClient::CallBackFunc(BaseWorkerThread *p)
+void IocpTcpClient::retrySend(BaseWorkerThread *workerThread,BaseJob *job)
 {
-	epl::LockObj lock(m_workerLock);
-	m_emptyWorkerList.push(p);
+	pushJob(job);
 }
 
 void IocpTcpClient::pushJob(BaseJob * job)
 {
-	epl::LockObj lock(m_workerLock);
-	if(m_emptyWorkerList.size())
-	{
-		m_emptyWorkerList.front()->Push(job);
-		m_emptyWorkerList.pop();
-	}
-	else
-	{
-		if(!m_workerList.size())
-		{
-			return;
-		}
-
-		size_t jobCount=m_workerList.at(0)->GetJobCount();
-		int workerIdx=0;	
-
-		for(int trav=1;trav<m_workerList.size();trav++)
-		{
-			if(m_workerList.at(trav)->GetJobCount()<jobCount)
-			{
-				jobCount=m_workerList.at(trav)->GetJobCount();
-				workerIdx=trav;
-			}
-		}
-		m_workerList.at(workerIdx)->Push(job);
-	}
+	if(m_jobScheduler)
+		m_jobScheduler->Push(job);
 }
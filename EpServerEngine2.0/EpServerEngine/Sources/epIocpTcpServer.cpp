@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include "epIocpTcpServer.h"
 #include "epIocpTcpSocket.h"
 #include "epIocpServerProcessor.h"
+#include "epIocpServerJob.h"
 #if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
 #define new DEBUG_NEW
 #undef THIS_FILE
@@ -37,48 +38,32 @@ using namespace epse;
 
 IocpTcpServer::IocpTcpServer(epl::LockPolicy lockPolicyType):BaseTcpServer(lockPolicyType)
 {
-	switch(lockPolicyType)
-	{
-	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_workerLock=EP_NEW epl::CriticalSectionEx();
-		break;
-	case epl::LOCK_POLICY_MUTEX:
-		m_workerLock=EP_NEW epl::Mutex();
-		break;
-	case epl::LOCK_POLICY_NONE:
-		m_workerLock=EP_NEW epl::NoLock();
-		break;
-	default:
-		m_workerLock=NULL;
-		break;
-	}
+	m_jobScheduler=NULL;
+	m_completionPort=NULL;
+	m_ioEngineType=IO_ENGINE_TYPE_READINESS;
+	m_sendQueueHighWatermark=SEND_QUEUE_WATERMARK_INFINITE;
+	m_sendQueueLowWatermark=0;
+	m_sendQueuePolicy=SEND_QUEUE_POLICY_BLOCK;
 }
 
 
 IocpTcpServer::IocpTcpServer(const IocpTcpServer& b):BaseTcpServer(b)
 {
-	switch(m_lockPolicy)
-	{
-	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_workerLock=EP_NEW epl::CriticalSectionEx();
-		break;
-	case epl::LOCK_POLICY_MUTEX:
-		m_workerLock=EP_NEW epl::Mutex();
-		break;
-	case epl::LOCK_POLICY_NONE:
-		m_workerLock=EP_NEW epl::NoLock();
-		break;
-	default:
-		m_workerLock=NULL;
-		break;
-	}
+	m_jobScheduler=NULL;
+	m_completionPort=NULL;
+	m_ioEngineType=b.m_ioEngineType;
+	m_sendQueueHighWatermark=b.m_sendQueueHighWatermark;
+	m_sendQueueLowWatermark=b.m_sendQueueLowWatermark;
+	m_sendQueuePolicy=b.m_sendQueuePolicy;
 	LockObj lock(b.m_baseServerLock);
 }
 
 IocpTcpServer::~IocpTcpServer()
 {
-	if(m_workerLock)
-		EP_DELETE m_workerLock;
+	if(m_completionPort)
+		EP_DELETE m_completionPort;
+	if(m_jobScheduler)
+		EP_DELETE m_jobScheduler;
 }
 
 IocpTcpServer & IocpTcpServer::operator=(const IocpTcpServer&b)
@@ -86,121 +71,100 @@ IocpTcpServer & IocpTcpServer::operator=(const IocpTcpServer&b)
 	if(this!=&b)
 	{
 		BaseTcpServer::operator =(b);
-		switch(m_lockPolicy)
-		{
-		case epl::LOCK_POLICY_CRITICALSECTION:
-			m_workerLock=EP_NEW epl::CriticalSectionEx();
-			break;
-		case epl::LOCK_POLICY_MUTEX:
-			m_workerLock=EP_NEW epl::Mutex();
-			break;
-		case epl::LOCK_POLICY_NONE:
-			m_workerLock=EP_NEW epl::NoLock();
-			break;
-		default:
-			m_workerLock=NULL;
-			break;
-		}
 		LockObj lock(b.m_baseServerLock);
 
 	}
 	return *this;
 }
 
-void IocpTcpServer::CallBackFunc(BaseWorkerThread *p)
+void IocpTcpServer::OnIoCompleted(epl::SmartObject *context,unsigned long transferredByte,bool isSucceeded)
 {
-	epl::LockObj lock(m_workerLock);
-	m_emptyWorkerList.push(p);
+	IocpServerJob *serverJob=static_cast<IocpServerJob*>(context);
+	((IocpTcpSocket*)serverJob->GetSocket())->completeReceive(transferredByte,isSucceeded);
+	pushJob(serverJob);
 }
-void IocpTcpServer::pushJob(BaseJob * job)
+
+void IocpTcpServer::OnSendCompleted(epl::SmartObject *context,unsigned long transferredByte,bool isSucceeded)
 {
-	epl::LockObj lock(m_workerLock);
-	if(m_emptyWorkerList.size())
+	IocpServerJob *serverJob=static_cast<IocpServerJob*>(context);
+	((IocpTcpSocket*)serverJob->GetSocket())->completeSend(transferredByte,isSucceeded);
+	pushJob(serverJob);
+}
+
+bool IocpTcpServer::waitForReceive(SOCKET socket,BaseJob * job,char *buffer,unsigned int bufferByteSize)
+{
+	if(!m_completionPort || !m_completionPort->WaitForReceive(socket,job,buffer,bufferByteSize))
 	{
-		m_emptyWorkerList.front()->Push(job);
-		m_emptyWorkerList.pop();
+		pushJob(job);
+		return false;
 	}
-	else
-	{
-		if(!m_workerList.size())
-		{
-			return;
-		}
+	return true;
+}
+bool IocpTcpServer::waitForSend(SOCKET socket,BaseJob * job,WSABUF *bufferList,unsigned int bufferCount)
+{
+	return m_completionPort && m_completionPort->WaitForSend(socket,job,bufferList,bufferCount);
+}
 
-		size_t jobCount=m_workerList.at(0)->GetJobCount();
-		int workerIdx=0;	
-		
-		for(int trav=1;trav<m_workerList.size();trav++)
-		{
-			if(m_workerList.at(trav)->GetJobCount()<jobCount)
-			{
-				jobCount=m_workerList.at(trav)->GetJobCount();
-				workerIdx=trav;
-			}
-		}
-		m_workerList.at(workerIdx)->Push(job);
-	}
+void IocpTcpServer::pushJob(BaseJob * job)
+{
+	if(m_jobScheduler)
+		m_jobScheduler->Push(job);
 }
 
 void IocpTcpServer::StopServer()
 {
 	BaseTcpServer::StopServer();
 
-	m_workerLock->Lock();
-	while(!m_emptyWorkerList.empty())
-		m_emptyWorkerList.pop();
+	if(m_completionPort)
+		m_completionPort->Close();
 
-	for(int trav=0;trav<m_workerList.size();trav++)
-	{
-		m_workerList.at(trav)->TerminateWorker(m_waitTime);
-		EP_DELETE m_workerList.at(trav);
-	}
-	m_workerList.clear();
-	m_workerLock->Unlock();
+	if(m_jobScheduler)
+		m_jobScheduler->Close();
 }
 
 bool IocpTcpServer::StartServer(const ServerOps &ops)
 {
-	m_workerLock->Lock();
-	while(!m_emptyWorkerList.empty())
-		m_emptyWorkerList.pop();
-
-	for(int trav=0;trav<m_workerList.size();trav++)
-	{
-		m_workerList.at(trav)->TerminateWorker(m_waitTime);
-		EP_DELETE m_workerList.at(trav);
-	}
-	m_workerList.clear();
-
 	int workerCount=ops.workerThreadCount;
 	if(workerCount==0)
 	{
 		workerCount=System::GetNumberOfCores()*2;
 	}
-	for(int trav=0;trav<workerCount;trav++)
+	if(!m_jobScheduler)
+		m_jobScheduler=EP_NEW JobScheduler(m_waitTime,m_lockPolicy);
+	IocpServerProcessor *jobProcessor=EP_NEW IocpServerProcessor();
+	m_jobScheduler->Create(workerCount,jobProcessor);
+	jobProcessor->ReleaseObj();
+
+	m_ioEngineType=ops.ioEngineType;
+	m_sendQueueHighWatermark=ops.sendQueueHighWatermark;
+	m_sendQueueLowWatermark=ops.sendQueueLowWatermark;
+	m_sendQueuePolicy=ops.sendQueuePolicy;
+	if(!m_completionPort)
+		m_completionPort=EP_NEW IocpCompletionPort(this,m_waitTime,m_lockPolicy);
+	if(!m_completionPort->Create())
 	{
-		BaseWorkerThread *workerThread=WorkerThreadFactory::GetWorkerThread(BaseWorkerThread::THREAD_LIFE_SUSPEND_AFTER_WORK);
-		
-		workerThread->SetCallBackClass(this);
-
-		m_workerList.push_back(workerThread);
-		m_emptyWorkerList.push(workerThread);
-		workerThread->SetJobProcessor(EP_NEW IocpServerProcessor());
-		workerThread->Start();
+		// stop the workers already started
+		m_jobScheduler->Close();
+		return false;
 	}
-	m_workerLock->Unlock();
 	
-	return BaseTcpServer::StartServer(ops);
+	if(!BaseTcpServer::StartServer(ops))
+	{
+		m_completionPort->Close();
+		m_jobScheduler->Close();
+		return false;
+	}
+	return true;
 }
 
-void IocpTcpServer::execute()
+void IocpTcpServer::listenLoop(SOCKET listenSocket)
 {
 	SOCKET clientSocket;
 	sockaddr sockAddr;
 	int sizeOfSockAddr=sizeof(sockaddr);
 	while(1)
 	{
-		clientSocket=accept(m_listenSocket,&sockAddr,&sizeOfSockAddr);
+		clientSocket=accept(listenSocket,&sockAddr,&sizeOfSockAddr);
 		if(clientSocket == INVALID_SOCKET || m_listenSocket== INVALID_SOCKET)
 		{
 			break;			
@@ -209,21 +173,28 @@ void IocpTcpServer::execute()
 		{
 			if(!m_callBackObj->OnAccept(sockAddr))
 			{
-				closesocket(clientSocket);
+				SocketHelper::CloseSocket(clientSocket);
+				continue;
+			}
+			if(!m_completionPort->Associate(clientSocket))
+			{
+				SocketHelper::CloseSocket(clientSocket);
 				continue;
 			}
 			IocpTcpSocket *accWorker=EP_NEW IocpTcpSocket(m_callBackObj,m_waitTime,m_lockPolicy);
 			if(!accWorker)
 			{
-				closesocket(clientSocket);
+				SocketHelper::CloseSocket(clientSocket);
 				continue;
 			}
 			accWorker->setClientSocket(clientSocket);
 			accWorker->setSockAddr(sockAddr);
 
 			accWorker->setOwner(this);
+			accWorker->setSendQueueWatermark(m_sendQueueHighWatermark,m_sendQueueLowWatermark,m_sendQueuePolicy);
 			m_socketList.Push(accWorker);	
 			accWorker->Start();
+			startActivityTimer(accWorker);
 			accWorker->ReleaseObj();
 			if(GetMaximumConnectionCount()!=CONNECTION_LIMIT_INFINITE)
 			{
@@ -235,7 +206,5 @@ void IocpTcpServer::execute()
 
 		}
 	}
-
-	stopServer();
-} 
+}
 
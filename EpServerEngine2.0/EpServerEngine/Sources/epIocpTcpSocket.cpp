@@ -33,9 +33,13 @@ static char THIS_FILE[] = __FILE__;
 #endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
 
 using namespace epse;
-IocpTcpSocket::IocpTcpSocket(ServerCallbackInterface *callBackObj,unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType): BaseTcpSocket(callBackObj,waitTimeMilliSec,lockPolicyType)
+IocpTcpSocket::IocpTcpSocket(ServerCallbackInterface *callBackObj,unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType): BaseTcpSocket(callBackObj,waitTimeMilliSec,lockPolicyType),m_sendQueue(lockPolicyType)
 {
 	m_isConnected=true;
+	m_sentOffset=0;
+	m_isSendCompleted=false;
+	m_isSendSucceeded=false;
+	m_sentByteSize=0;
 }
 
 IocpTcpSocket::~IocpTcpSocket()
@@ -67,7 +71,7 @@ void IocpTcpSocket::killConnection()
 		// No longer need client socket
 		if(m_clientSocket!=INVALID_SOCKET)
 		{
-			closesocket(m_clientSocket);
+			SocketHelper::CloseSocket(m_clientSocket);
 			m_clientSocket = INVALID_SOCKET;
 		}
 
@@ -85,7 +89,7 @@ void IocpTcpSocket::killConnectionNoCallBack()
 		// No longer need client socket
 		if(m_clientSocket!=INVALID_SOCKET)
 		{
-			closesocket(m_clientSocket);
+			SocketHelper::CloseSocket(m_clientSocket);
 			m_clientSocket = INVALID_SOCKET;
 		}
 
@@ -96,23 +100,226 @@ void IocpTcpSocket::killConnectionNoCallBack()
 
 void IocpTcpSocket::Send(Packet &packet,EventEx *completionEvent,ServerCallbackInterface *callBackObj,Priority priority)
 {
-	IocpServerJob *newJob= EP_NEW IocpServerJob(this,IocpServerJob::IOCP_SERVER_JOB_TYPE_SEND,&packet,completionEvent,callBackObj,priority,m_lockPolicy);
-	((IocpTcpServer*)m_owner)->pushJob(newJob);
-	newJob->ReleaseObj();
+	pushSend(packet,m_waitTime,completionEvent,callBackObj,priority);
+}
+
+void IocpTcpSocket::pushSend(Packet &packet,unsigned int waitTimeInMilliSec,EventEx *completionEvent,ServerCallbackInterface *callBackObj,Priority priority)
+{
+	bool shouldFlush=false;
+	SendQueue::PushResult result=m_sendQueue.Push(&packet,completionEvent,callBackObj,waitTimeInMilliSec,shouldFlush);
+	if(result!=SendQueue::PUSH_RESULT_QUEUED)
+	{
+		notifySent(completionEvent,callBackObj,SEND_STATUS_FAIL_QUEUE_FULL);
+		if(result==SendQueue::PUSH_RESULT_DISCONNECT)
+			KillConnection();
+		return;
+	}
+	// only one flush job per connection is in flight to keep the order
+	if(shouldFlush)
+	{
+		IocpServerJob *newJob= EP_NEW IocpServerJob(this,IocpServerJob::IOCP_SERVER_JOB_TYPE_FLUSH,NULL,NULL,NULL,priority,m_lockPolicy);
+		((IocpTcpServer*)m_owner)->pushJob(newJob);
+		newJob->ReleaseObj();
+	}
+}
+
+bool IocpTcpSocket::queueSend(Packet &packet,unsigned int waitTimeInMilliSec)
+{
+	// the broadcast waits for each slow subscriber only as long as the caller allows
+	pushSend(packet,waitTimeInMilliSec,NULL,NULL,PRIORITY_NORMAL);
+	return true;
+}
+
+unsigned int IocpTcpSocket::GetSendQueueByteSize() const
+{
+	return m_sendQueue.GetByteSize();
+}
+
+void IocpTcpSocket::setSendQueueWatermark(unsigned int highWatermark,unsigned int lowWatermark,SendQueuePolicy policy)
+{
+	m_sendQueue.SetWatermark(highWatermark,lowWatermark,policy);
+}
+
+void IocpTcpSocket::notifySent(EventEx *completionEvent,ServerCallbackInterface *callBackObj,SendStatus sendStatus)
+{
+	if(completionEvent)
+		completionEvent->SetEvent();
+	if(callBackObj)
+		callBackObj->OnSent(this,sendStatus);
+	else
+		m_callBackObj->OnSent(this,sendStatus);
+}
+
+void IocpTcpSocket::flushSendQueue(BaseWorkerThread *workerThread,BaseJob *job)
+{
+	vector<SendQueue::SendUnit> unitList;
+	m_sendQueue.Front(unitList,SEND_GATHER_PACKET_COUNT);
+	unsigned int sentCount=0;
+	SendStatus sendStatus=SEND_STATUS_SUCCESS;
+	if(m_isSendCompleted)
+	{
+		// resumed by the completion of the send posted below, the front packets are the ones posted
+		m_isSendCompleted=false;
+		if(m_isSendSucceeded)
+		{
+			// each packet is framed by its 4 byte length header, empty packets are not written
+			unsigned long remainByteSize=m_sentOffset+m_sentByteSize;
+			while(sentCount<unitList.size())
+			{
+				unsigned long framedByteSize=unitList.at(sentCount).m_packet->GetPacketByteSize();
+				if(framedByteSize)
+					framedByteSize+=4;
+				if(remainByteSize<framedByteSize)
+					break;
+				remainByteSize-=framedByteSize;
+				sentCount++;
+			}
+			// the rest of the partly written packet is posted by the next flush
+			m_sentOffset=remainByteSize;
+		}
+		else
+		{
+			sendStatus=SEND_STATUS_FAIL_SEND_FAILED;
+			sentCount=unitList.size();
+			m_sentOffset=0;
+		}
+	}
+	else if(unitList.size())
+	{
+		// the front packets must be written before the send deadline
+		armSendTimer();
+		WSABUF bufferList[SEND_GATHER_PACKET_COUNT*2];
+		unsigned int bufferCount=0;
+		for(int trav=0;trav<unitList.size();trav++)
+		{
+			const Packet *packet=unitList.at(trav).m_packet;
+			unsigned long skipByteSize=trav?0:m_sentOffset;
+			if(!packet->GetPacketByteSize() || packet->GetPacketByteSize()+4<=skipByteSize)
+				continue;
+			// the length header goes in front of the payload as BatchSend does
+			m_sentLengthList[trav]=packet->GetPacketByteSize();
+			if(skipByteSize<4)
+			{
+				bufferList[bufferCount].buf=reinterpret_cast<char*>(&m_sentLengthList[trav])+skipByteSize;
+				bufferList[bufferCount].len=4-skipByteSize;
+				bufferCount++;
+				skipByteSize=0;
+			}
+			else
+				skipByteSize-=4;
+			bufferList[bufferCount].buf=const_cast<char*>(packet->GetPacket())+skipByteSize;
+			bufferList[bufferCount].len=packet->GetPacketByteSize()-skipByteSize;
+			bufferCount++;
+		}
+		// the queue holds the packets until popped and the headers are members, so the buffers are valid until the completion
+		if(!bufferCount)
+			sentCount=unitList.size();
+		else if(((IocpTcpServer*)m_owner)->waitForSend(m_clientSocket,job,bufferList,bufferCount))
+			return;
+		else
+		{
+			sendStatus=SEND_STATUS_FAIL_SEND_FAILED;
+			sentCount=unitList.size();
+			m_sentOffset=0;
+		}
+	}
+
+	if(sentCount)
+	{
+		cancelSendTimer();
+		for(unsigned int trav=0;trav<sentCount;trav++)
+			notifySent(unitList.at(trav).m_completionEvent,unitList.at(trav).m_callBackObj,sendStatus);
+	}
+
+	bool isWritable,isDrained;
+	bool shouldContinue=m_sendQueue.Pop(sentCount,isWritable,isDrained);
+	if(isWritable)
+		m_callBackObj->OnWritable(this);
+	if(isDrained)
+		m_callBackObj->OnSendQueueDrained(this);
+	if(shouldContinue)
+		((IocpTcpServer*)m_owner)->pushJob(job);
 }
 
 void IocpTcpSocket::Receive(EventEx *completionEvent,ServerCallbackInterface *callBackObj,Priority priority)
 {
 	IocpServerJob *newJob= EP_NEW IocpServerJob(this,IocpServerJob::IOCP_SERVER_JOB_TYPE_RECEIVE,NULL,completionEvent,callBackObj,priority,m_lockPolicy);
-	((IocpTcpServer*)m_owner)->pushJob(newJob);
+	waitForReceive(NULL,newJob);
 	newJob->ReleaseObj();
 }
+
+void IocpTcpSocket::retrySend(BaseWorkerThread *workerThread,BaseJob *job)
+{
+	((IocpTcpServer*)m_owner)->pushJob(job);
+}
+
+void IocpTcpSocket::waitForReceive(BaseWorkerThread *workerThread,BaseJob *job)
+{
+	epl::LockObj lock(m_baseSocketLock);
+	IocpTcpServer *owner=(IocpTcpServer*)m_owner;
+	if(owner->m_ioEngineType!=IO_ENGINE_TYPE_COMPLETION)
+	{
+		owner->waitForReceive(m_clientSocket,job);
+		return;
+	}
+
+	// buffered data and closed connection are handled without waiting
+	if(m_recvBuffer.GetDataByteSize() || m_recvBuffer.IsClosed() || !IsConnectionAlive())
+	{
+		owner->pushJob(job);
+		return;
+	}
+	// overlapped receive is already in flight
+	if(m_recvBuffer.AddWaitingJob(job))
+		return;
+
+	m_recvBuffer.SetPending();
+	if(!owner->waitForReceive(m_clientSocket,job,m_recvBuffer.GetBuffer(),m_recvBuffer.GetBufferByteSize()))
+	{
+		vector<BaseJob*> waitingJobList;
+		m_recvBuffer.Complete(0,false,waitingJobList);
+	}
+}
+
+void IocpTcpSocket::completeSend(unsigned long transferredByte,bool isSucceeded)
+{
+	m_sentByteSize=transferredByte;
+	m_isSendSucceeded=isSucceeded;
+	m_isSendCompleted=true;
+}
+
+void IocpTcpSocket::completeReceive(unsigned long transferredByte,bool isSucceeded)
+{
+	vector<BaseJob*> waitingJobList;
+	m_baseSocketLock->Lock();
+	m_recvBuffer.Complete(transferredByte,isSucceeded,waitingJobList);
+	m_baseSocketLock->Unlock();
+
+	for(int trav=0;trav<waitingJobList.size();trav++)
+	{
+		((IocpTcpServer*)m_owner)->pushJob(waitingJobList.at(trav));
+		waitingJobList.at(trav)->ReleaseObj();
+	}
+}
+
+int IocpTcpSocket::receivePacket(Packet &packet)
+{
+	if(((IocpTcpServer*)m_owner)->m_ioEngineType==IO_ENGINE_TYPE_COMPLETION)
+		return m_recvBuffer.Receive(m_clientSocket,packet);
+	return receive(packet);
+}
 int IocpTcpSocket::Send(const Packet &packet, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
 {
 	epl::LockObj lock(m_baseSocketLock);
 	return BaseTcpSocket::Send(packet,waitTimeInMilliSec,sendStatus);
 }
 
+int IocpTcpSocket::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	epl::LockObj lock(m_baseSocketLock);
+	return BaseTcpSocket::BatchSend(packetList,packetCount,waitTimeInMilliSec,sendStatus);
+}
+
 Packet *IocpTcpSocket::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *retStatus)
 {
 	epl::LockObj lock(m_baseSocketLock);
@@ -123,49 +330,72 @@ Packet *IocpTcpSocket::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 		return NULL;
 	}
 
-	// select routine
-	TIMEVAL	timeOutVal;
-	fd_set	fdSet;
-	int		retfdNum = 0;
-
-	FD_ZERO(&fdSet);
-	FD_SET(m_clientSocket, &fdSet);
-	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
+	if(((IocpTcpServer*)m_owner)->m_ioEngineType==IO_ENGINE_TYPE_COMPLETION)
 	{
-		// socket select time out setting
-		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
-		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
-		// socket select
-		// socket read select
-		retfdNum = select(0,&fdSet, NULL, NULL, &timeOutVal);
+		if(!m_recvBuffer.GetDataByteSize() && !m_recvBuffer.IsClosed())
+		{
+			// the job doing nothing parks the overlapped receive, so the data is left for this call
+			if(!m_recvBuffer.IsPending())
+			{
+				IocpServerJob *newJob= EP_NEW IocpServerJob(this,IocpServerJob::IOCP_SERVER_JOB_TYPE_NULL,NULL,NULL,NULL,PRIORITY_NORMAL,m_lockPolicy);
+				waitForReceive(NULL,newJob);
+				newJob->ReleaseObj();
+			}
+			// the lock is released while waiting, since the completion takes it
+			m_baseSocketLock->Unlock();
+			m_recvBuffer.WaitForComplete(waitTimeInMilliSec);
+			m_baseSocketLock->Lock();
+			if(!IsConnectionAlive())
+			{
+				if(retStatus)
+					*retStatus=RECEIVE_STATUS_FAIL_NOT_CONNECTED;
+				return NULL;
+			}
+		}
+		// only the data read by the overlapped receive is consumed
+		if(m_recvBuffer.IsPending() || (!m_recvBuffer.GetDataByteSize() && !m_recvBuffer.IsClosed()))
+		{
+			if(retStatus)
+				*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
+			return NULL;
+		}
+		if(!m_recvBuffer.GetDataByteSize())
+		{
+			killConnection();
+			if(retStatus)
+				*retStatus=RECEIVE_STATUS_FAIL_CONNECTION_CLOSING;
+			return NULL;
+		}
 	}
 	else
 	{
-		retfdNum = select(0, &fdSet,NULL, NULL, NULL);
-	}
-	if (retfdNum == SOCKET_ERROR)	// select failed
-	{
-		killConnection();
-		if(retStatus)
-			*retStatus=RECEIVE_STATUS_FAIL_SOCKET_ERROR;
-		return NULL;
-	}
-	else if (retfdNum == 0)		    // select time-out
-	{
-		if(retStatus)
-			*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
-		return NULL;
+		// wait routine
+		int		retfdNum = SocketHelper::WaitForSocket(m_clientSocket, SocketHelper::SOCKET_WAIT_READ, waitTimeInMilliSec);
+		if (retfdNum == SOCKET_ERROR)	// wait failed
+		{
+			killConnection();
+			if(retStatus)
+				*retStatus=RECEIVE_STATUS_FAIL_SOCKET_ERROR;
+			return NULL;
+		}
+		else if (retfdNum == 0)		    // wait time-out
+		{
+			if(retStatus)
+				*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
+			return NULL;
+		}
 	}
 
 	// receive routine
-	int iResult =receive(m_recvSizePacket);
+	int iResult =receivePacket(m_recvSizePacket);
 	if(iResult>0)
 	{
 		unsigned int shouldReceive=(reinterpret_cast<unsigned int*>(const_cast<char*>(m_recvSizePacket.GetPacket())))[0];
 		Packet *recvPacket=EP_NEW Packet(NULL,shouldReceive);
-		iResult = receive(*recvPacket);
+		iResult = receivePacket(*recvPacket);
 
 		if (iResult == shouldReceive) {
+			markActive();
 			if(retStatus)
 				*retStatus=RECEIVE_STATUS_SUCCESS;
 			return recvPacket;
@@ -38,22 +38,7 @@ using namespace epse;
 
 IocpUdpClient::IocpUdpClient(epl::LockPolicy lockPolicyType): BaseUdpClient(lockPolicyType)
 {
-	switch(lockPolicyType)
-	{
-	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_workerLock=EP_NEW epl::CriticalSectionEx();
-		break;
-	case epl::LOCK_POLICY_MUTEX:
-		m_workerLock=EP_NEW epl::Mutex();
-		break;
-	case epl::LOCK_POLICY_NONE:
-		m_workerLock=EP_NEW epl::NoLock();
-		break;
-	default:
-		m_workerLock=NULL;
-		break;
-	}
-
+	m_jobScheduler=NULL;
 	m_isConnected=false;
 
 }
@@ -61,28 +46,13 @@ IocpUdpClient::IocpUdpClient(epl::LockPolicy lockPolicyType): BaseUdpClient(lock
 
 IocpUdpClient::IocpUdpClient(const IocpUdpClient& b):BaseUdpClient(b)
 {
-	switch(m_lockPolicy)
-	{
-	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_workerLock=EP_NEW epl::CriticalSectionEx();
-		break;
-	case epl::LOCK_POLICY_MUTEX:
-		m_workerLock=EP_NEW epl::Mutex();
-		break;
-	case epl::LOCK_POLICY_NONE:
-		m_workerLock=EP_NEW epl::NoLock();
-		break;
-	default:
-		m_workerLock=NULL;
-		break;
-	}
-
+	m_jobScheduler=NULL;
 	m_isConnected=false;
 }
 IocpUdpClient::~IocpUdpClient()
 {
-	if(m_workerLock)
-		EP_DELETE m_workerLock;
+	if(m_jobScheduler)
+		EP_DELETE m_jobScheduler;
 }
 IocpUdpClient & IocpUdpClient::operator=(const IocpUdpClient&b)
 {
@@ -91,21 +61,6 @@ IocpUdpClient & IocpUdpClient::operator=(const IocpUdpClient&b)
 
 		BaseUdpClient::operator =(b);
 
-		switch(m_lockPolicy)
-		{
-		case epl::LOCK_POLICY_CRITICALSECTION:
-			m_workerLock=EP_NEW epl::CriticalSectionEx();
-			break;
-		case epl::LOCK_POLICY_MUTEX:
-			m_workerLock=EP_NEW epl::Mutex();
-			break;
-		case epl::LOCK_POLICY_NONE:
-			m_workerLock=EP_NEW epl::NoLock();
-			break;
-		default:
-			m_workerLock=NULL;
-			break;
-		}
 
 		m_isConnected=false;
 	}
@@ -117,34 +72,16 @@ IocpUdpClient & IocpUdpClient::operator=(const IocpUdpClient&b)
 
 bool IocpUdpClient::Connect(const ClientOps &ops)
 {
-	m_workerLock->Lock();
-	while(!m_emptyWorkerList.empty())
-		m_emptyWorkerList.pop();
-
-	for(int trav=0;trav<m_workerList.size();trav++)
-	{
-		m_workerList.at(trav)->TerminateWorker(m_waitTime);
-		EP_DELETE m_workerList.at(trav);
-	}
-	m_workerList.clear();
-
 	int workerCount=ops.workerThreadCount;
 	if(workerCount==0)
 	{
 		workerCount=System::GetNumberOfCores()*2;
 	}
-	for(int trav=0;trav<workerCount;trav++)
-	{
-		BaseWorkerThread *workerThread=WorkerThreadFactory::GetWorkerThread(BaseWorkerThread::THREAD_LIFE_SUSPEND_AFTER_WORK);
-
-		workerThread->SetCallBackClass(this);
-
-		m_workerList.push_back(workerThread);
-		m_emptyWorkerList.push(workerThread);
-		workerThread->SetJobProcessor(EP_NEW IocpClientProcessor());
-		workerThread->Start();
-	}
-	m_workerLock->Unlock();
+	if(!m_jobScheduler)
+		m_jobScheduler=EP_NEW JobScheduler(m_waitTime,m_lockPolicy);
+	IocpClientProcessor *jobProcessor=EP_NEW IocpClientProcessor();
+	m_jobScheduler->Create(workerCount,jobProcessor);
+	jobProcessor->ReleaseObj();
 
 	epl::LockObj lock(m_generalLock);
 	if(IsConnectionAlive())
@@ -174,15 +111,13 @@ bool IocpUdpClient::Connect(const ClientOps &ops)
 	}
 	SetWaitTime(ops.waitTimeMilliSec);
 
-	WSADATA wsaData;
 	m_maxPacketSize=0;
 	struct addrinfo hints;
 	int iResult;
 
-	// Initialize Winsock
-	iResult = WSAStartup(MAKEWORD(2,2), &wsaData);
-	if (iResult != 0) {
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) WSAStartup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+	// Initialize socket library
+	if (!SocketHelper::Startup()) {
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket startup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		return false;
 	}
 
@@ -195,7 +130,7 @@ bool IocpUdpClient::Connect(const ClientOps &ops)
 	iResult = getaddrinfo(m_hostName.c_str(), m_port.c_str(), &hints, &m_result);
 	if ( iResult != 0 ) {
 		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) getaddrinfo failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-		WSACleanup();
+		SocketHelper::Cleanup();
 		return false;
 	}
 
@@ -243,7 +178,7 @@ void IocpUdpClient::Disconnect()
 		// shutdown the connection since no more data will be sent
 		int iResult = shutdown(m_connectSocket, SD_SEND);
 		if (iResult == SOCKET_ERROR){
-			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this, WSAGetLastError());
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this, SocketHelper::GetLastSocketError());
 		}
 	}
 	else
@@ -252,17 +187,8 @@ void IocpUdpClient::Disconnect()
 	}
 	cleanUpClient();
 	
-	m_workerLock->Lock();
-	while(!m_emptyWorkerList.empty())
-		m_emptyWorkerList.pop();
-
-	for(int trav=0;trav<m_workerList.size();trav++)
-	{
-		m_workerList.at(trav)->TerminateWorker(m_waitTime);
-		EP_DELETE m_workerList.at(trav);
-	}
-	m_workerList.clear();
-	m_workerLock->Unlock();
+	if(m_jobScheduler)
+		m_jobScheduler->Close();
 
 
 	m_callBackObj->OnDisconnect(this);
@@ -280,17 +206,8 @@ void IocpUdpClient::disconnect()
 		m_isConnected=false;
 		cleanUpClient();
 	
-		m_workerLock->Lock();
-		while(!m_emptyWorkerList.empty())
-			m_emptyWorkerList.pop();
-
-		for(int trav=0;trav<m_workerList.size();trav++)
-		{
-			m_workerList.at(trav)->TerminateWorker(m_waitTime);
-			EP_DELETE m_workerList.at(trav);
-		}
-		m_workerList.clear();
-		m_workerLock->Unlock();
+		if(m_jobScheduler)
+			m_jobScheduler->Close();
 
 		m_callBackObj->OnDisconnect(this);		
 	}
@@ -317,6 +234,12 @@ int IocpUdpClient::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 	return BaseUdpClient::Send(packet,waitTimeInMilliSec,sendStatus);
 }
 
+int IocpUdpClient::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	epl::LockObj lock(m_generalLock);
+	return BaseUdpClient::BatchSend(packetList,packetCount,waitTimeInMilliSec,sendStatus);
+}
+
 
 Packet *IocpUdpClient::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *retStatus)
 {
@@ -328,34 +251,16 @@ Packet *IocpUdpClient::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 		return NULL;
 	}
 
-	// select routine
-	TIMEVAL	timeOutVal;
-	fd_set	fdSet;
-	int		retfdNum = 0;
-
-	FD_ZERO(&fdSet);
-	FD_SET(m_connectSocket, &fdSet);
-	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
-	{
-		// socket select time out setting
-		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
-		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
-		// socket select
-		// socket read select
-		retfdNum = select(0,&fdSet, NULL, NULL, &timeOutVal);
-	}
-	else
-	{
-		retfdNum = select(0, &fdSet,NULL, NULL, NULL);
-	}
-	if (retfdNum == SOCKET_ERROR)	// select failed
+	// wait routine
+	int		retfdNum = SocketHelper::WaitForSocket(m_connectSocket, SocketHelper::SOCKET_WAIT_READ, waitTimeInMilliSec);
+	if (retfdNum == SOCKET_ERROR)	// wait failed
 	{
 		disconnect();
 		if(retStatus)
 			*retStatus=RECEIVE_STATUS_FAIL_SOCKET_ERROR;
 		return NULL;
 	}
-	else if (retfdNum == 0)		    // select time-out
+	else if (retfdNum == 0)		    // wait time-out
 	{
 		if(retStatus)
 			*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
@@ -390,38 +295,13 @@ Packet *IocpUdpClient::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 }
 
 
-void IocpUdpClient::CallBackFunc(BaseWorkerThread *p)
+void IocpUdpClient::retrySend(BaseWorkerThread *workerThread,BaseJob *job)
 {
-	epl::LockObj lock(m_workerLock);
-	m_emptyWorkerList.push(p);
+	pushJob(job);
 }
 
 void IocpUdpClient::pushJob(BaseJob * job)
 {
-	epl::LockObj lock(m_workerLock);
-	if(m_emptyWorkerList.size())
-	{
-		m_emptyWorkerList.front()->Push(job);
-		m_emptyWorkerList.pop();
-	}
-	else
-	{
-		if(!m_workerList.size())
-		{
-			return;
-		}
-
-		size_t jobCount=m_workerList.at(0)->GetJobCount();
-		int workerIdx=0;	
-
-		for(int trav=1;trav<m_workerList.size();trav++)
-		{
-			if(m_workerList.at(trav)->GetJobCount()<jobCount)
-			{
-				jobCount=m_workerList.at(trav)->GetJobCount();
-				workerIdx=trav;
-			}
-		}
-		m_workerList.at(workerIdx)->Push(job);
-	}
+	if(m_jobScheduler)
+		m_jobScheduler->Push(job);
 }
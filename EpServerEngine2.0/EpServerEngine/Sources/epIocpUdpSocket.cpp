@@ -35,7 +35,6 @@ static char THIS_FILE[] = __FILE__;
 using namespace epse;
 IocpUdpSocket::IocpUdpSocket(ServerCallbackInterface *callBackObj,unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType): BaseUdpSocket(callBackObj,waitTimeMilliSec,lockPolicyType)
 {
-	m_packetReceivedEvent=EventEx(false,false);
 	m_isConnected=true;
 }
 
@@ -66,16 +65,7 @@ void IocpUdpSocket::killConnection()
 	{
 		m_isConnected=false;
 
-		m_listLock->Lock();
-		Packet *removeElem=NULL;
-		while(!m_packetList.empty())
-		{
-			removeElem=m_packetList.front();
-			if(removeElem)
-				removeElem->ReleaseObj();
-			m_packetList.pop();
-		}
-		m_listLock->Unlock();
+		clearPacketList();
 
 
 		removeSelfFromContainer();
@@ -90,16 +80,7 @@ void IocpUdpSocket::killConnectionNoCallBack()
 	{
 		m_isConnected=false;
 
-		m_listLock->Lock();
-		Packet *removeElem=NULL;
-		while(!m_packetList.empty())
-		{
-			removeElem=m_packetList.front();
-			if(removeElem)
-				removeElem->ReleaseObj();
-			m_packetList.pop();
-		}
-		m_listLock->Unlock();
+		clearPacketList();
 
 
 		removeSelfFromContainer();
@@ -114,6 +95,12 @@ void IocpUdpSocket::Send(Packet &packet,EventEx *completionEvent,ServerCallbackI
 	newJob->ReleaseObj();
 }
 
+bool IocpUdpSocket::queueSend(Packet &packet,unsigned int waitTimeInMilliSec)
+{
+	Send(packet);
+	return true;
+}
+
 void IocpUdpSocket::Receive(EventEx *completionEvent,ServerCallbackInterface *callBackObj,Priority priority)
 {
 	IocpServerJob *newJob= EP_NEW IocpServerJob(this,IocpServerJob::IOCP_SERVER_JOB_TYPE_RECEIVE,NULL,completionEvent,callBackObj,priority,m_lockPolicy);
@@ -126,6 +113,12 @@ int IocpUdpSocket::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 	return BaseUdpSocket::Send(packet,waitTimeInMilliSec,sendStatus);
 }
 
+int IocpUdpSocket::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	epl::LockObj lock(m_baseSocketLock);
+	return BaseUdpSocket::BatchSend(packetList,packetCount,waitTimeInMilliSec,sendStatus);
+}
+
 Packet *IocpUdpSocket::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *retStatus)
 {
 	epl::LockObj lock(m_baseSocketLock);
@@ -139,43 +132,39 @@ Packet *IocpUdpSocket::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 	// receive routine
 	unsigned int packetSize=0;
 
-	m_listLock->Lock();
-	if(m_packetList.size()==0)
+	Packet *packet=NULL;
+	while(!m_packetList.Pop(packet,waitTimeInMilliSec))
 	{
-		m_listLock->Unlock();
-		if(!m_packetReceivedEvent.WaitForEvent(waitTimeInMilliSec))
+		if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
 		{
 			if(retStatus)
 				*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
 			return NULL;
 		}
-
 	}
-	Packet *packet= m_packetList.front();
 	packetSize=packet->GetPacketByteSize();
 	if(packetSize==0)
 	{
-		m_listLock->Unlock();
+		packet->ReleaseObj();
 		killConnection();
 		if(retStatus)
 			*retStatus=RECEIVE_STATUS_FAIL_CONNECTION_CLOSING;
 		return NULL;
 	}
-	m_packetList.pop();
-	m_listLock->Unlock();
 	if(retStatus)
 		*retStatus=RECEIVE_STATUS_SUCCESS;
 	return packet;
 
 }
 
+void IocpUdpSocket::retrySend(BaseWorkerThread *workerThread,BaseJob *job)
+{
+	((IocpUdpServer*)m_owner)->pushJob(job);
+}
+
 void IocpUdpSocket::addPacket(Packet *packet)
 {
-	if(packet)
-		packet->RetainObj();
-	epl::LockObj lock(m_listLock);
-	m_packetList.push(packet);
-	m_packetReceivedEvent.SetEvent();
+	pushPacket(packet);
 }
 
 void IocpUdpSocket::execute()
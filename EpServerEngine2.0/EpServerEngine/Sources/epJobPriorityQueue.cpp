@@ -0,0 +1,103 @@
+/*! 
+JobPriorityQueue for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epJobPriorityQueue.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+JobPriorityQueue::JobPriorityQueue()
+{
+	m_jobCount=0;
+}
+
+JobPriorityQueue::~JobPriorityQueue()
+{
+}
+
+void JobPriorityQueue::Push(BaseJob *job)
+{
+	m_bucketMap[job->GetPriority()].push_back(job);
+	m_jobCount++;
+}
+
+JobPriorityQueue::BucketMap::iterator JobPriorityQueue::frontBucket()
+{
+	if(!m_jobCount)
+		return m_bucketMap.end();
+	// the emptied buckets are kept to save the allocation, and only a few priorities are in use
+	BucketMap::iterator bucketIter=m_bucketMap.begin();
+	while(bucketIter->second.empty())
+		bucketIter++;
+	return bucketIter;
+}
+
+BaseJob *JobPriorityQueue::PopFront()
+{
+	BucketMap::iterator bucketIter=frontBucket();
+	if(bucketIter==m_bucketMap.end())
+		return NULL;
+	BaseJob *job=bucketIter->second.front();
+	bucketIter->second.pop_front();
+	m_jobCount--;
+	return job;
+}
+
+BaseJob *JobPriorityQueue::PopBack()
+{
+	BucketMap::iterator bucketIter=frontBucket();
+	if(bucketIter==m_bucketMap.end())
+		return NULL;
+	BaseJob *job=bucketIter->second.back();
+	bucketIter->second.pop_back();
+	m_jobCount--;
+	return job;
+}
+
+void JobPriorityQueue::Clear(vector<BaseJob*> &retJobList)
+{
+	BucketMap::iterator bucketIter;
+	for(bucketIter=m_bucketMap.begin();bucketIter!=m_bucketMap.end();bucketIter++)
+	{
+		retJobList.insert(retJobList.end(),bucketIter->second.begin(),bucketIter->second.end());
+		bucketIter->second.clear();
+	}
+	m_jobCount=0;
+}
+
+size_t JobPriorityQueue::Size() const
+{
+	return m_jobCount;
+}
+
+bool JobPriorityQueue::IsEmpty() const
+{
+	return m_jobCount==0;
+}
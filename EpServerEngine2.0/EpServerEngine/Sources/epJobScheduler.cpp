@@ -0,0 +1,275 @@
+/*! 
+JobScheduler for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epJobScheduler.h"
+#include "epJobSchedulerProcessor.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+JobScheduler::JobScheduler(unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType)
+{
+	m_waitTime=waitTimeMilliSec;
+	m_lockPolicy=lockPolicyType;
+	m_slotList=NULL;
+	m_slotCount=0;
+	m_pushingCount=0;
+	m_allocatedSlotCount=0;
+	m_nextSlot=0;
+	m_jobProcessor=NULL;
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_schedulerLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_schedulerLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_schedulerLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_schedulerLock=NULL;
+		break;
+	}
+}
+
+JobScheduler::~JobScheduler()
+{
+	Close();
+	deleteSlots();
+	if(m_schedulerLock)
+		EP_DELETE m_schedulerLock;
+}
+
+bool JobScheduler::Create(unsigned int workerThreadCount,BaseJobProcessor *jobProcessor)
+{
+	Close();
+
+	epl::LockObj lock(m_schedulerLock);
+	deleteSlots();
+	if(workerThreadCount==0)
+	{
+		workerThreadCount=System::GetNumberOfCores();
+	}
+	m_jobProcessor=jobProcessor;
+	if(m_jobProcessor)
+		m_jobProcessor->RetainObj();
+
+	m_slotList=EP_NEW WorkerSlot[workerThreadCount];
+	m_allocatedSlotCount=workerThreadCount;
+	unsigned int trav;
+	for(trav=0;trav<workerThreadCount;trav++)
+	{
+		WorkerSlot &slot=m_slotList[trav];
+		slot.m_workerThread=NULL;
+		slot.m_wakeUpJob=EP_NEW WakeUpJob(m_lockPolicy);
+		slot.m_state=WORKER_STATE_CLOSED;
+		slot.m_jobCount=0;
+	}
+
+	unsigned int slotCount=0;
+	for(trav=0;trav<workerThreadCount;trav++)
+	{
+		WorkerSlot &slot=m_slotList[trav];
+		slot.m_workerThread=WorkerThreadFactory::GetWorkerThread(BaseWorkerThread::THREAD_LIFE_SUSPEND_AFTER_WORK);
+		if(!slot.m_workerThread)
+		{
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) worker thread creation failed\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+			break;
+		}
+		slot.m_workerThread->SetJobProcessor(EP_NEW JobSchedulerProcessor(this,trav));
+		slot.m_workerThread->Start();
+		slot.m_state=WORKER_STATE_IDLE;
+		slotCount++;
+	}
+	// the jobs are accepted only after all the slots are ready
+	InterlockedExchange(&m_slotCount,slotCount);
+	return slotCount!=0;
+}
+
+void JobScheduler::Close()
+{
+	epl::LockObj lock(m_schedulerLock);
+	InterlockedExchange(&m_slotCount,0);
+	// Push checks the slot count after counting itself in, so no job is added after this wait
+	while(m_pushingCount)
+		Sleep(0);
+	for(unsigned int trav=0;trav<m_allocatedSlotCount;trav++)
+	{
+		WorkerSlot &slot=m_slotList[trav];
+		InterlockedExchange(&slot.m_state,WORKER_STATE_CLOSED);
+	}
+	for(unsigned int trav=0;trav<m_allocatedSlotCount;trav++)
+	{
+		WorkerSlot &slot=m_slotList[trav];
+		if(slot.m_workerThread)
+		{
+			slot.m_workerThread->TerminateWorker(m_waitTime);
+			EP_DELETE slot.m_workerThread;
+		}
+		slot.m_workerThread=NULL;
+	}
+	clearJobs();
+	if(m_jobProcessor)
+		m_jobProcessor->ReleaseObj();
+	m_jobProcessor=NULL;
+}
+
+unsigned int JobScheduler::GetWorkerThreadCount() const
+{
+	return (unsigned int)m_slotCount;
+}
+
+bool JobScheduler::Push(BaseJob *job)
+{
+	// counted in before reading the slot count, so Close does not free the slots under this call
+	InterlockedIncrement(&m_pushingCount);
+	unsigned int slotCount=(unsigned int)m_slotCount;
+	if(!slotCount)
+	{
+		InterlockedDecrement(&m_pushingCount);
+		return false;
+	}
+
+	unsigned int slotIndex=(unsigned int)InterlockedIncrement(&m_nextSlot)%slotCount;
+	WorkerSlot &slot=m_slotList[slotIndex];
+	job->RetainObj();
+	slot.m_jobLock.Lock();
+	slot.m_jobList.Push(job);
+	slot.m_jobCount++;
+	slot.m_jobLock.Unlock();
+
+	if(!signal(slot))
+	{
+		// the owner is busy, so wake up an idle worker thread to steal the job
+		for(unsigned int trav=1;trav<slotCount;trav++)
+		{
+			WorkerSlot &idleSlot=m_slotList[(slotIndex+trav)%slotCount];
+			if(idleSlot.m_state==WORKER_STATE_IDLE && signal(idleSlot))
+				break;
+		}
+	}
+	InterlockedDecrement(&m_pushingCount);
+	return true;
+}
+
+bool JobScheduler::signal(WorkerSlot &slot)
+{
+	long prevState=InterlockedCompareExchange(&slot.m_state,WORKER_STATE_SIGNALED,WORKER_STATE_IDLE);
+	if(prevState==WORKER_STATE_IDLE)
+	{
+		slot.m_workerThread->Push(slot.m_wakeUpJob);
+	}
+	else if(prevState==WORKER_STATE_RUNNING)
+	{
+		// make the running worker thread check the queues once more before going idle
+		InterlockedCompareExchange(&slot.m_state,WORKER_STATE_SIGNALED,WORKER_STATE_RUNNING);
+	}
+	return prevState==WORKER_STATE_IDLE;
+}
+
+void JobScheduler::run(unsigned int slotIndex,BaseWorkerThread *workerThread)
+{
+	WorkerSlot &slot=m_slotList[slotIndex];
+	InterlockedCompareExchange(&slot.m_state,WORKER_STATE_RUNNING,WORKER_STATE_SIGNALED);
+	while(1)
+	{
+		BaseJob *job;
+		while((job=popJob(slotIndex))!=NULL || (job=stealJob(slotIndex))!=NULL)
+		{
+			m_jobProcessor->DoJob(workerThread,job);
+			job->ReleaseObj();
+		}
+		long prevState=InterlockedCompareExchange(&slot.m_state,WORKER_STATE_IDLE,WORKER_STATE_RUNNING);
+		if(prevState==WORKER_STATE_RUNNING || prevState==WORKER_STATE_CLOSED)
+			break;
+		// signaled while processing, so check the queues again
+		InterlockedCompareExchange(&slot.m_state,WORKER_STATE_RUNNING,WORKER_STATE_SIGNALED);
+	}
+}
+
+BaseJob *JobScheduler::popJob(unsigned int slotIndex)
+{
+	WorkerSlot &slot=m_slotList[slotIndex];
+	ServerLockObj<ServerCriticalSection> lock(slot.m_jobLock);
+	BaseJob *job=slot.m_jobList.PopFront();
+	if(!job)
+		return NULL;
+	slot.m_jobCount--;
+	return job;
+}
+
+BaseJob *JobScheduler::stealJob(unsigned int slotIndex)
+{
+	for(unsigned int trav=1;trav<m_allocatedSlotCount;trav++)
+	{
+		WorkerSlot &victimSlot=m_slotList[(slotIndex+trav)%m_allocatedSlotCount];
+		// check without the lock first, so the empty queues cost no lock
+		if(!victimSlot.m_jobCount)
+			continue;
+		ServerLockObj<ServerCriticalSection> lock(victimSlot.m_jobLock);
+		BaseJob *job=victimSlot.m_jobList.PopBack();
+		if(!job)
+			continue;
+		victimSlot.m_jobCount--;
+		return job;
+	}
+	return NULL;
+}
+
+void JobScheduler::clearJobs()
+{
+	for(unsigned int trav=0;trav<m_allocatedSlotCount;trav++)
+	{
+		WorkerSlot &slot=m_slotList[trav];
+		slot.m_jobLock.Lock();
+		vector<BaseJob*> jobList;
+		slot.m_jobList.Clear(jobList);
+		slot.m_jobCount=0;
+		slot.m_jobLock.Unlock();
+		for(unsigned int jobTrav=0;jobTrav<jobList.size();jobTrav++)
+			jobList.at(jobTrav)->ReleaseObj();
+	}
+}
+
+void JobScheduler::deleteSlots()
+{
+	clearJobs();
+	for(unsigned int trav=0;trav<m_allocatedSlotCount;trav++)
+	{
+		if(m_slotList[trav].m_wakeUpJob)
+			m_slotList[trav].m_wakeUpJob->ReleaseObj();
+	}
+	if(m_slotList)
+		EP_DELETE[] m_slotList;
+	m_slotList=NULL;
+	m_allocatedSlotCount=0;
+}
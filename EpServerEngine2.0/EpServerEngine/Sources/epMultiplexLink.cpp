@@ -0,0 +1,215 @@
+/*!
+MultiplexLink for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epMultiplexLink.h"
+#include "epAsyncTcpClient.h"
+#include <vector>
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+MultiplexLink::MultiplexLink(const ForwardServerInfo &forwardServerInfo,epl::LockPolicy lockPolicyType):ServerSmartObject(lockPolicyType)
+{
+	m_lockPolicy=lockPolicyType;
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_linkLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_linkLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_linkLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_linkLock=NULL;
+		break;
+	}
+	m_hostName=forwardServerInfo.hostname;
+	m_port=forwardServerInfo.port;
+	m_client=EP_NEW AsyncTcpClient(lockPolicyType);
+	m_nextSessionId=1;
+	m_isClosed=false;
+}
+
+MultiplexLink::~MultiplexLink()
+{
+	m_client->Disconnect();
+	EP_DELETE m_client;
+	if(m_linkLock)
+		EP_DELETE m_linkLock;
+	m_linkLock=NULL;
+}
+
+MultiplexSession *MultiplexLink::OpenSession(ClientCallbackInterface *callBackObj)
+{
+	MultiplexSession *session;
+	{
+		epl::LockObj lock(m_linkLock);
+		if(!m_isClosed && !m_client->IsConnectionAlive())
+		{
+			ClientOps ops;
+			ops.callBackObj=this;
+			ops.hostName=m_hostName.c_str();
+			ops.port=m_port.c_str();
+			ops.isAsynchronousReceive=false;
+			m_client->Connect(ops);
+		}
+
+		// skip the IDs still in use after the wrap around
+		while(m_nextSessionId==0 || m_sessionMap.find(m_nextSessionId)!=m_sessionMap.end())
+			m_nextSessionId++;
+		session=EP_NEW MultiplexSession(this,m_nextSessionId++,callBackObj,m_lockPolicy);
+		if(m_isClosed || !m_client->IsConnectionAlive())
+			return session;
+
+		// the link keeps a reference while the session is opened
+		session->RetainObj();
+		session->m_isConnected=true;
+		m_sessionMap[session->m_sessionId]=session;
+	}
+	send(session->m_sessionId,MULTIPLEX_PACKET_TYPE_OPEN,NULL,WAITTIME_INIFINITE,NULL);
+	return session;
+}
+
+unsigned int MultiplexLink::GetSessionCount() const
+{
+	epl::LockObj lock(m_linkLock);
+	return static_cast<unsigned int>(m_sessionMap.size());
+}
+
+bool MultiplexLink::IsConnectionAlive() const
+{
+	return m_client->IsConnectionAlive();
+}
+
+void MultiplexLink::Disconnect()
+{
+	m_client->Disconnect();
+}
+
+void MultiplexLink::Close()
+{
+	{
+		epl::LockObj lock(m_linkLock);
+		m_isClosed=true;
+	}
+	m_client->Disconnect();
+	// the sessions not closed by the callback of the disconnect are closed here
+	OnDisconnect(m_client);
+}
+
+int MultiplexLink::send(unsigned int sessionId,MultiplexPacketType type,const Packet *packet,unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	// the header and the packet must go in one packet, since the sessions share the link
+	unsigned int byteSize=packet?packet->GetPacketByteSize():0;
+	Packet linkPacket(NULL,sizeof(MultiplexHeader)+byteSize,true,m_lockPolicy);
+	char *linkData=const_cast<char*>(linkPacket.GetPacket());
+	MultiplexHeader header;
+	header.sessionId=htonl(sessionId);
+	header.type=htonl(type);
+	epl::System::Memcpy(linkData,&header,sizeof(MultiplexHeader));
+	if(byteSize)
+		epl::System::Memcpy(linkData+sizeof(MultiplexHeader),packet->GetPacket(),byteSize);
+	return m_client->Send(linkPacket,waitTimeInMilliSec,sendStatus);
+}
+
+void MultiplexLink::closeSession(MultiplexSession *session)
+{
+	{
+		epl::LockObj lock(m_linkLock);
+		map<unsigned int,MultiplexSession*>::iterator iter=m_sessionMap.find(session->m_sessionId);
+		if(iter==m_sessionMap.end() || iter->second!=session)
+			return;
+		m_sessionMap.erase(iter);
+		session->m_isConnected=false;
+	}
+	send(session->m_sessionId,MULTIPLEX_PACKET_TYPE_CLOSE,NULL,WAITTIME_INIFINITE,NULL);
+	session->ReleaseObj();
+}
+
+void MultiplexLink::OnReceived(ClientInterface *client,const Packet*receivedPacket,ReceiveStatus status)
+{
+	if(!receivedPacket || receivedPacket->GetPacketByteSize()<sizeof(MultiplexHeader))
+		return;
+	MultiplexHeader header;
+	epl::System::Memcpy(&header,receivedPacket->GetPacket(),sizeof(MultiplexHeader));
+	header.sessionId=ntohl(header.sessionId);
+	header.type=ntohl(header.type);
+
+	MultiplexSession *session;
+	{
+		epl::LockObj lock(m_linkLock);
+		map<unsigned int,MultiplexSession*>::iterator iter=m_sessionMap.find(header.sessionId);
+		if(iter==m_sessionMap.end())
+			return;
+		session=iter->second;
+		if(header.type==MULTIPLEX_PACKET_TYPE_CLOSE)
+		{
+			// the reference of the link is released below
+			m_sessionMap.erase(iter);
+			session->m_isConnected=false;
+		}
+		else
+			session->RetainObj();
+	}
+
+	ClientCallbackInterface *callBackObj=session->GetCallbackObject();
+	if(header.type==MULTIPLEX_PACKET_TYPE_DATA)
+	{
+		// the session gets the slice of the packet without copying
+		Packet sessionPacket(*receivedPacket,sizeof(MultiplexHeader),receivedPacket->GetPacketByteSize()-sizeof(MultiplexHeader));
+		callBackObj->OnReceived(session,&sessionPacket,status);
+	}
+	else if(header.type==MULTIPLEX_PACKET_TYPE_CLOSE)
+		callBackObj->OnDisconnect(session);
+	session->ReleaseObj();
+}
+
+void MultiplexLink::OnDisconnect(ClientInterface *client)
+{
+	vector<MultiplexSession*> sessionList;
+	{
+		epl::LockObj lock(m_linkLock);
+		map<unsigned int,MultiplexSession*>::iterator iter;
+		for(iter=m_sessionMap.begin();iter!=m_sessionMap.end();iter++)
+		{
+			iter->second->m_isConnected=false;
+			sessionList.push_back(iter->second);
+		}
+		m_sessionMap.clear();
+	}
+	for(int trav=0;trav<sessionList.size();trav++)
+	{
+		sessionList.at(trav)->GetCallbackObject()->OnDisconnect(sessionList.at(trav));
+		sessionList.at(trav)->ReleaseObj();
+	}
+}
@@ -0,0 +1,105 @@
+/*!
+MultiplexSession for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epMultiplexSession.h"
+#include "epMultiplexLink.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+MultiplexSession::MultiplexSession(MultiplexLink *link,unsigned int sessionId,ClientCallbackInterface *callBackObj,epl::LockPolicy lockPolicyType):ServerSmartObject(lockPolicyType)
+{
+	// the session keeps the link alive until deleted
+	m_link=link;
+	m_link->RetainObj();
+	m_sessionId=sessionId;
+	m_callBackObj=callBackObj;
+	m_waitTime=WAITTIME_INIFINITE;
+	m_isConnected=false;
+}
+
+MultiplexSession::~MultiplexSession()
+{
+	m_link->ReleaseObj();
+}
+
+void MultiplexSession::SetWaitTime(unsigned int milliSec)
+{
+	m_waitTime=milliSec;
+}
+
+unsigned int MultiplexSession::GetWaitTime() const
+{
+	return m_waitTime;
+}
+
+bool MultiplexSession::Connect(const ClientOps &ops)
+{
+	return IsConnectionAlive();
+}
+
+void MultiplexSession::Disconnect()
+{
+	m_link->closeSession(this);
+}
+
+bool MultiplexSession::IsConnectionAlive() const
+{
+	return m_isConnected && m_link->IsConnectionAlive();
+}
+
+int MultiplexSession::Send(const Packet &packet, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	if(!IsConnectionAlive())
+	{
+		if(sendStatus)
+			*sendStatus=SEND_STATUS_FAIL_NOT_CONNECTED;
+		return 0;
+	}
+	int sentLength=m_link->send(m_sessionId,MULTIPLEX_PACKET_TYPE_DATA,&packet,waitTimeInMilliSec,sendStatus);
+	if(sentLength>0)
+		sentLength-=sizeof(MultiplexHeader);
+	return sentLength;
+}
+
+void MultiplexSession::SetCallbackObject(ClientCallbackInterface *callBackObj)
+{
+	m_callBackObj=callBackObj;
+}
+
+ClientCallbackInterface *MultiplexSession::GetCallbackObject()
+{
+	return m_callBackObj;
+}
+
+unsigned int MultiplexSession::GetSessionId() const
+{
+	return m_sessionId;
+}
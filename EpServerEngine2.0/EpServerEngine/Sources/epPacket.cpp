@@ -25,16 +25,17 @@ THE SOFTWARE.
 */
 #include "epPacket.h"
 
+// DEBUG_NEW is not used in this file since it defines the operator new of Packet.
 #if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
-#define new DEBUG_NEW
 #undef THIS_FILE
 static char THIS_FILE[] = __FILE__;
 #endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
 
 using namespace epse;
 
-Packet::Packet(const void *packet, unsigned int byteSize, bool shouldAllocate, epl::LockPolicy lockPolicyType):SmartObject(lockPolicyType)
+Packet::Packet(const void *packet, unsigned int byteSize, bool shouldAllocate, epl::LockPolicy lockPolicyType):ServerSmartObject(lockPolicyType)
 {
+	m_buffer=NULL;
 	m_packet=NULL;
 	m_packetSize=0;
 	m_isAllocated=shouldAllocate;
@@ -42,7 +43,8 @@ Packet::Packet(const void *packet, unsigned int byteSize, bool shouldAllocate, e
 	{
 		if(byteSize>0)
 		{
-			m_packet=EP_NEW char[byteSize];
+			m_buffer=PacketBuffer::Create(byteSize,lockPolicyType);
+			m_packet=m_buffer->GetBuffer();
 			if(packet)
 				epl::System::Memcpy(m_packet,packet,byteSize);
 			else
@@ -56,102 +58,63 @@ Packet::Packet(const void *packet, unsigned int byteSize, bool shouldAllocate, e
 		m_packetSize=byteSize;
 	}
 	m_lockPolicy=lockPolicyType;
-	switch(lockPolicyType)
-	{
-	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_packetLock=EP_NEW epl::CriticalSectionEx();
-		break;
-	case epl::LOCK_POLICY_MUTEX:
-		m_packetLock=EP_NEW epl::Mutex();
-		break;
-	case epl::LOCK_POLICY_NONE:
-		m_packetLock=EP_NEW epl::NoLock();
-		break;
-	default:
-		m_packetLock=NULL;
-		break;
-	}
+	m_packetLock=PACKET_POOL_INSTANCE.CreateLock(lockPolicyType);
 }
 
-Packet::Packet(const Packet& b):SmartObject(b)
+Packet::Packet(const Packet& b):ServerSmartObject(b)
 {
 	m_lockPolicy=b.m_lockPolicy;
-	switch(m_lockPolicy)
-	{
-	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_packetLock=EP_NEW epl::CriticalSectionEx();
-		break;
-	case epl::LOCK_POLICY_MUTEX:
-		m_packetLock=EP_NEW epl::Mutex();
-		break;
-	case epl::LOCK_POLICY_NONE:
-		m_packetLock=EP_NEW epl::NoLock();
-		break;
-	default:
-		m_packetLock=NULL;
-		break;
-	}
+	m_packetLock=PACKET_POOL_INSTANCE.CreateLock(m_lockPolicy);
 
 	LockObj lock(b.m_packetLock);
-	m_packet=NULL;
-	if(b.m_isAllocated)
-	{
-		if(b.m_packetSize>0)
-		{
-			m_packet=EP_NEW char[b.m_packetSize];
-			epl::System::Memcpy(m_packet,b.m_packet,b.m_packetSize);
-		}
-		m_packetSize=b.m_packetSize;
-	}
-	else
-	{
-		m_packet=b.m_packet;
-		m_packetSize=b.m_packetSize;
-	}
+	m_buffer=b.m_buffer;
+	if(m_buffer)
+		m_buffer->RetainObj();
+	m_packet=b.m_packet;
+	m_packetSize=b.m_packetSize;
 	m_isAllocated=b.m_isAllocated;
 	
 }
+
+Packet::Packet(const Packet& b, unsigned int offset, unsigned int byteSize, epl::LockPolicy lockPolicyType):ServerSmartObject(lockPolicyType)
+{
+	m_lockPolicy=lockPolicyType;
+	m_packetLock=PACKET_POOL_INSTANCE.CreateLock(m_lockPolicy);
+
+	LockObj lock(b.m_packetLock);
+	EP_ASSERT_EXPR(offset<=b.m_packetSize && byteSize<=b.m_packetSize-offset,_T("The slice is out of the packet"));
+	if(offset>b.m_packetSize)
+		offset=b.m_packetSize;
+	if(byteSize>b.m_packetSize-offset)
+		byteSize=b.m_packetSize-offset;
+
+	m_buffer=b.m_buffer;
+	if(m_buffer)
+		m_buffer->RetainObj();
+	m_packet=NULL;
+	if(b.m_packet)
+		m_packet=b.m_packet+offset;
+	m_packetSize=byteSize;
+	m_isAllocated=b.m_isAllocated;
+}
+
 Packet & Packet::operator=(const Packet&b)
 {
 	if(this!=&b)
 	{
 		resetPacket();
 
-		SmartObject::operator =(b);
+		ServerSmartObject::operator =(b);
 
 		m_lockPolicy=b.m_lockPolicy;
-		switch(m_lockPolicy)
-		{
-		case epl::LOCK_POLICY_CRITICALSECTION:
-			m_packetLock=EP_NEW epl::CriticalSectionEx();
-			break;
-		case epl::LOCK_POLICY_MUTEX:
-			m_packetLock=EP_NEW epl::Mutex();
-			break;
-		case epl::LOCK_POLICY_NONE:
-			m_packetLock=EP_NEW epl::NoLock();
-			break;
-		default:
-			m_packetLock=NULL;
-			break;
-		}
+		m_packetLock=PACKET_POOL_INSTANCE.CreateLock(m_lockPolicy);
 
 		LockObj lock(b.m_packetLock);
-		m_packet=NULL;
-		if(b.m_isAllocated)
-		{
-			if(b.m_packetSize>0)
-			{
-				m_packet=EP_NEW char[b.m_packetSize];
-				epl::System::Memcpy(m_packet,b.m_packet,b.m_packetSize);
-			}
-			m_packetSize=b.m_packetSize;
-		}
-		else
-		{
-			m_packet=b.m_packet;
-			m_packetSize=b.m_packetSize;
-		}
+		m_buffer=b.m_buffer;
+		if(m_buffer)
+			m_buffer->RetainObj();
+		m_packet=b.m_packet;
+		m_packetSize=b.m_packetSize;
 		m_isAllocated=b.m_isAllocated;
 
 	}
@@ -160,14 +123,14 @@ Packet & Packet::operator=(const Packet&b)
 void Packet::resetPacket()
 {
 	m_packetLock->Lock();
-	if(m_isAllocated && m_packet)
+	if(m_buffer)
 	{
-		EP_DELETE[] m_packet;
+		m_buffer->ReleaseObj();
 	}
+	m_buffer=NULL;
 	m_packet=NULL;
 	m_packetLock->Unlock();
-	if(m_packetLock)
-		EP_DELETE m_packetLock;
+	PACKET_POOL_INSTANCE.DestroyLock(m_packetLock);
 	m_packetLock=NULL;
 }
 
@@ -191,24 +154,48 @@ void Packet::SetPacket(const void* packet, unsigned int packetByteSize)
 	epl::LockObj lock(m_packetLock);
 	if(m_isAllocated)
 	{
-		if(m_packet)
-			EP_DELETE[] m_packet;
+		// the old memory is released after the copy, since the given packet may be in it
+		PacketBuffer *oldBuffer=m_buffer;
+		m_buffer=NULL;
 		m_packet=NULL;
 		if(packetByteSize>0)
 		{
-			m_packet=EP_NEW char[packetByteSize];
-			EP_ASSERT(m_packet);
+			m_buffer=PacketBuffer::Create(packetByteSize,m_lockPolicy);
+			m_packet=m_buffer->GetBuffer();
+			if(packet)
+				epl::System::Memcpy(m_packet,packet,packetByteSize);
+			else
+				epl::System::Memset(m_packet,0,packetByteSize);
 		}
-		if(packet)
-			epl::System::Memcpy(m_packet,packet,packetByteSize);
-		else
-			epl::System::Memset(m_packet,0,packetByteSize);
 		m_packetSize=packetByteSize;
-
+		if(oldBuffer)
+			oldBuffer->ReleaseObj();
 	}
 	else
 	{
 		m_packet=reinterpret_cast<char*>(const_cast<void*>(packet));
 		m_packetSize=packetByteSize;
 	}
-}
\ No newline at end of file
+}
+
+void *Packet::operator new(size_t size)
+{
+	return PACKET_POOL_INSTANCE.Allocate((unsigned int)size);
+}
+
+void Packet::operator delete(void *p)
+{
+	PACKET_POOL_INSTANCE.Free(p);
+}
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+void *Packet::operator new(size_t size,int blockType,const char *fileName,int lineNumber)
+{
+	return PACKET_POOL_INSTANCE.Allocate((unsigned int)size);
+}
+
+void Packet::operator delete(void *p,int blockType,const char *fileName,int lineNumber)
+{
+	PACKET_POOL_INSTANCE.Free(p);
+}
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
@@ -0,0 +1,57 @@
+/*! 
+PacketBuffer for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epPacketBuffer.h"
+#include <new>
+
+// DEBUG_NEW is not used in this file since the buffer is constructed in the block from the Packet Pool.
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+PacketBuffer *PacketBuffer::Create(unsigned int byteSize,epl::LockPolicy lockPolicyType)
+{
+	// the memory follows the object in the same block
+	void *block=PACKET_POOL_INSTANCE.Allocate(sizeof(PacketBuffer)+byteSize);
+	EP_ASSERT(block);
+	return ::new(block) PacketBuffer(byteSize,lockPolicyType);
+}
+
+PacketBuffer::PacketBuffer(unsigned int byteSize,epl::LockPolicy lockPolicyType):ServerSmartObject(lockPolicyType)
+{
+	m_byteSize=byteSize;
+}
+
+PacketBuffer::~PacketBuffer()
+{
+}
+
+void PacketBuffer::operator delete(void *p)
+{
+	PACKET_POOL_INSTANCE.Free(p);
+}
@@ -0,0 +1,198 @@
+/*! 
+PacketDispatchQueue for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epPacketDispatchQueue.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+PacketDispatchQueue::PacketDispatchQueue(epl::LockPolicy lockPolicyType)
+{
+	m_dispatcher=NULL;
+	m_isOrdered=false;
+	m_isRunning=false;
+	m_pendingCount=0;
+	m_pendingEvent=EventEx(false,false);
+	m_lockPolicy=lockPolicyType;
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_queueLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_queueLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_queueLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_queueLock=NULL;
+		break;
+	}
+}
+
+PacketDispatchQueue::~PacketDispatchQueue()
+{
+	Clear();
+	if(m_queueLock)
+		EP_DELETE m_queueLock;
+}
+
+void PacketDispatchQueue::SetDispatcher(PacketDispatcher *dispatcher,bool isOrdered)
+{
+	epl::LockObj lock(m_queueLock);
+	m_dispatcher=dispatcher;
+	m_isOrdered=isOrdered;
+}
+
+PacketDispatcher *PacketDispatchQueue::GetDispatcher() const
+{
+	epl::LockObj lock(m_queueLock);
+	return m_dispatcher;
+}
+
+bool PacketDispatchQueue::GetIsOrdered() const
+{
+	epl::LockObj lock(m_queueLock);
+	return m_isOrdered;
+}
+
+unsigned int PacketDispatchQueue::GetPendingCount() const
+{
+	epl::LockObj lock(m_queueLock);
+	return m_pendingCount;
+}
+
+bool PacketDispatchQueue::Push(BaseServerObject *owner,PacketDispatchDelegate *delegateObj,Packet *packet,unsigned int maximumPendingCount)
+{
+	if(!GetDispatcher())
+		return false;
+	PacketDispatchJob *job=EP_NEW PacketDispatchJob(owner,delegateObj,packet,this,PRIORITY_NORMAL,m_lockPolicy);
+	if(!job)
+		return false;
+
+	m_queueLock->Lock();
+	m_pendingCount++;
+	if(m_isOrdered)
+	{
+		// only one job per connection is handed to the worker threads at a time
+		if(m_isRunning)
+		{
+			m_jobQueue.push(job);
+			job=NULL;
+		}
+		else
+			m_isRunning=true;
+	}
+	m_queueLock->Unlock();
+
+	if(job)
+		dispatchJob(job);
+
+	if(maximumPendingCount!=PROCESSOR_LIMIT_INFINITE)
+	{
+		while(GetPendingCount()>=maximumPendingCount)
+		{
+			m_pendingEvent.WaitForEvent();
+		}
+	}
+	return true;
+}
+
+void PacketDispatchQueue::dispatchJob(PacketDispatchJob *job)
+{
+	// the jobs processed in this thread are chained in the loop, since the ordered queue may be long
+	while(job)
+	{
+		PacketDispatcher *dispatcher=GetDispatcher();
+		if(dispatcher && dispatcher->Push(job))
+		{
+			job->ReleaseObj();
+			return;
+		}
+		if(job->GetDelegate() && job->GetPacket())
+			job->GetDelegate()->OnPacketDispatched(job->GetPacket());
+		PacketDispatchJob *nextJob=finishJob(job->GetDelegate());
+		job->ReleaseObj();
+		job=nextJob;
+	}
+}
+
+void PacketDispatchQueue::completeJob(PacketDispatchDelegate *delegateObj)
+{
+	PacketDispatchJob *nextJob=finishJob(delegateObj);
+	if(nextJob)
+		dispatchJob(nextJob);
+}
+
+PacketDispatchJob *PacketDispatchQueue::finishJob(PacketDispatchDelegate *delegateObj)
+{
+	PacketDispatchJob *nextJob=NULL;
+	m_queueLock->Lock();
+	if(m_pendingCount)
+		m_pendingCount--;
+	if(m_isOrdered)
+	{
+		if(m_jobQueue.size())
+		{
+			nextJob=m_jobQueue.front();
+			m_jobQueue.pop();
+		}
+		else
+			m_isRunning=false;
+	}
+	m_queueLock->Unlock();
+	m_pendingEvent.SetEvent();
+	if(delegateObj)
+		delegateObj->OnPacketCompleted();
+	return nextJob;
+}
+
+void PacketDispatchQueue::Clear()
+{
+	queue<PacketDispatchJob*> removeList;
+	m_queueLock->Lock();
+	while(!m_jobQueue.empty())
+	{
+		removeList.push(m_jobQueue.front());
+		m_jobQueue.pop();
+		if(m_pendingCount)
+			m_pendingCount--;
+	}
+	m_queueLock->Unlock();
+	m_pendingEvent.SetEvent();
+
+	// the jobs may hold the last reference of the owner
+	while(!removeList.empty())
+	{
+		removeList.front()->ReleaseObj();
+		removeList.pop();
+	}
+}
@@ -0,0 +1,69 @@
+/*! 
+PacketDispatcher for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epPacketDispatcher.h"
+#include "epPacketDispatchProcessor.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+PacketDispatcher::PacketDispatcher(unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType):m_jobScheduler(waitTimeMilliSec,lockPolicyType)
+{
+	m_waitTime=waitTimeMilliSec;
+	m_lockPolicy=lockPolicyType;
+}
+
+PacketDispatcher::~PacketDispatcher()
+{
+	Close();
+}
+
+bool PacketDispatcher::Create(unsigned int workerThreadCount)
+{
+	PacketDispatchProcessor *jobProcessor=EP_NEW PacketDispatchProcessor();
+	bool ret=m_jobScheduler.Create(workerThreadCount,jobProcessor);
+	jobProcessor->ReleaseObj();
+	return ret;
+}
+
+void PacketDispatcher::Close()
+{
+	m_jobScheduler.Close();
+}
+
+unsigned int PacketDispatcher::GetWorkerThreadCount() const
+{
+	return m_jobScheduler.GetWorkerThreadCount();
+}
+
+bool PacketDispatcher::Push(BaseJob *job)
+{
+	return m_jobScheduler.Push(job);
+}
@@ -0,0 +1,214 @@
+/*! 
+PacketPool for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epPacketPool.h"
+#include <new>
+
+// DEBUG_NEW is not used in this file since the locks are created with the placement new.
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+PacketPool::PacketPool()
+{
+	for(int shardTrav=0;shardTrav<PACKET_POOL_SHARD_COUNT;shardTrav++)
+	{
+		PoolShard &shard=m_shards[shardTrav];
+		for(int classTrav=0;classTrav<PACKET_POOL_CLASS_COUNT;classTrav++)
+			shard.m_freeList[classTrav]=NULL;
+		shard.m_cachedByteSize=0;
+	}
+}
+
+PacketPool::~PacketPool()
+{
+	for(int shardTrav=0;shardTrav<PACKET_POOL_SHARD_COUNT;shardTrav++)
+	{
+		PoolShard &shard=m_shards[shardTrav];
+		ServerLockObj<ServerCriticalSection> lock(shard.m_lock);
+		clearShard(shard);
+	}
+}
+
+unsigned int PacketPool::getShardIndex()
+{
+	return GetCurrentThreadId()%PACKET_POOL_SHARD_COUNT;
+}
+
+unsigned int PacketPool::getClassIndex(unsigned int byteSize)
+{
+	unsigned int classIndex=0;
+	unsigned int classByteSize=PACKET_POOL_MIN_BLOCK_SIZE;
+	while(classByteSize<byteSize && classIndex<PACKET_POOL_CLASS_COUNT)
+	{
+		classByteSize<<=1;
+		classIndex++;
+	}
+	return classIndex;
+}
+
+void PacketPool::clearShard(PoolShard &shard)
+{
+	for(int classTrav=0;classTrav<PACKET_POOL_CLASS_COUNT;classTrav++)
+	{
+		BlockHeader *header=shard.m_freeList[classTrav];
+		while(header)
+		{
+			BlockHeader *nextHeader=header->m_info.m_next;
+			EP_Free(header);
+			header=nextHeader;
+		}
+		shard.m_freeList[classTrav]=NULL;
+	}
+	shard.m_cachedByteSize=0;
+	shard.m_stats.cachedByteSize=0;
+}
+
+void *PacketPool::Allocate(unsigned int byteSize)
+{
+	unsigned int classIndex=getClassIndex(byteSize);
+	BlockHeader *header=NULL;
+	unsigned int shardIndex=getShardIndex();
+	PoolShard &shard=m_shards[shardIndex];
+	shard.m_lock.Lock();
+	shard.m_stats.allocateCount++;
+	if(classIndex<PACKET_POOL_CLASS_COUNT && shard.m_freeList[classIndex])
+	{
+		header=shard.m_freeList[classIndex];
+		shard.m_freeList[classIndex]=header->m_info.m_next;
+		shard.m_cachedByteSize-=header->m_info.m_blockByteSize;
+		shard.m_stats.cachedByteSize=shard.m_cachedByteSize;
+		shard.m_stats.hitCount++;
+	}
+	else
+	{
+		shard.m_stats.missCount++;
+	}
+	shard.m_lock.Unlock();
+
+	if(!header)
+	{
+		unsigned int blockByteSize=byteSize;
+		if(classIndex<PACKET_POOL_CLASS_COUNT)
+			blockByteSize=PACKET_POOL_MIN_BLOCK_SIZE<<classIndex;
+		header=reinterpret_cast<BlockHeader*>(EP_Malloc(sizeof(BlockHeader)+blockByteSize));
+		EP_ASSERT(header);
+		header->m_info.m_classIndex=static_cast<unsigned short>(classIndex);
+		header->m_info.m_shardIndex=static_cast<unsigned short>(shardIndex);
+		header->m_info.m_blockByteSize=blockByteSize;
+	}
+	header->m_info.m_next=NULL;
+	return header+1;
+}
+
+void *PacketPool::Reallocate(void *block,unsigned int byteSize)
+{
+	if(!block)
+		return Allocate(byteSize);
+	BlockHeader *header=reinterpret_cast<BlockHeader*>(block)-1;
+	if(byteSize<=header->m_info.m_blockByteSize)
+		return block;
+	void *newBlock=Allocate(byteSize);
+	epl::System::Memcpy(newBlock,block,header->m_info.m_blockByteSize);
+	Free(block);
+	return newBlock;
+}
+
+void PacketPool::Free(void *block)
+{
+	if(!block)
+		return;
+	BlockHeader *header=reinterpret_cast<BlockHeader*>(block)-1;
+	unsigned int classIndex=header->m_info.m_classIndex;
+	// the block goes back to the shard which allocated it, so the blocks freed by
+	// the worker threads do not pile up in their shards away from the allocating threads
+	PoolShard &shard=m_shards[header->m_info.m_shardIndex];
+	bool isCached=false;
+	shard.m_lock.Lock();
+	shard.m_stats.freeCount++;
+	if(classIndex<PACKET_POOL_CLASS_COUNT && shard.m_cachedByteSize+header->m_info.m_blockByteSize<=PACKET_POOL_SHARD_CACHE_SIZE)
+	{
+		header->m_info.m_next=shard.m_freeList[classIndex];
+		shard.m_freeList[classIndex]=header;
+		shard.m_cachedByteSize+=header->m_info.m_blockByteSize;
+		shard.m_stats.cachedByteSize=shard.m_cachedByteSize;
+		isCached=true;
+	}
+	shard.m_lock.Unlock();
+	if(!isCached)
+		EP_Free(header);
+}
+
+epl::BaseLock *PacketPool::CreateLock(epl::LockPolicy lockPolicyType)
+{
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		return new(Allocate(sizeof(epl::CriticalSectionEx))) epl::CriticalSectionEx();
+	case epl::LOCK_POLICY_MUTEX:
+		return new(Allocate(sizeof(epl::Mutex))) epl::Mutex();
+	case epl::LOCK_POLICY_NONE:
+		return new(Allocate(sizeof(epl::NoLock))) epl::NoLock();
+	default:
+		return NULL;
+	}
+}
+
+void PacketPool::DestroyLock(epl::BaseLock *lock)
+{
+	if(!lock)
+		return;
+	lock->~BaseLock();
+	Free(lock);
+}
+
+PacketPoolStats PacketPool::GetStats() const
+{
+	PacketPoolStats retStats;
+	for(int shardTrav=0;shardTrav<PACKET_POOL_SHARD_COUNT;shardTrav++)
+	{
+		const PoolShard &shard=m_shards[shardTrav];
+		ServerLockObj<ServerCriticalSection> lock(shard.m_lock);
+		retStats.allocateCount+=shard.m_stats.allocateCount;
+		retStats.hitCount+=shard.m_stats.hitCount;
+		retStats.missCount+=shard.m_stats.missCount;
+		retStats.freeCount+=shard.m_stats.freeCount;
+		retStats.cachedByteSize+=shard.m_stats.cachedByteSize;
+	}
+	return retStats;
+}
+
+void PacketPool::Clear()
+{
+	for(int shardTrav=0;shardTrav<PACKET_POOL_SHARD_COUNT;shardTrav++)
+	{
+		PoolShard &shard=m_shards[shardTrav];
+		ServerLockObj<ServerCriticalSection> lock(shard.m_lock);
+		clearShard(shard);
+	}
+}
@@ -0,0 +1,151 @@
+/*! 
+PacketReceiveBuffer for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epPacketReceiveBuffer.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+PacketReceiveBuffer::PacketReceiveBuffer(unsigned int bufferByteSize)
+{
+	m_bufferByteSize=bufferByteSize;
+	if(m_bufferByteSize<sizeof(unsigned int))
+		m_bufferByteSize=sizeof(unsigned int);
+	m_buffer=EP_NEW char[m_bufferByteSize];
+	m_dataOffset=0;
+	m_dataByteSize=0;
+	m_packet=NULL;
+	m_packetOffset=0;
+}
+
+PacketReceiveBuffer::~PacketReceiveBuffer()
+{
+	Reset();
+	if(m_buffer)
+		EP_DELETE[] m_buffer;
+	m_buffer=NULL;
+}
+
+int PacketReceiveBuffer::Fill(SOCKET socket)
+{
+	if(m_packet && !m_dataByteSize)
+	{
+		// the rest of the large packet is received into the packet directly
+		char *packetData=const_cast<char*>(m_packet->GetPacket());
+		int recvLength=recv(socket,packetData+m_packetOffset,m_packet->GetPacketByteSize()-m_packetOffset,0);
+		if(recvLength>0)
+			m_packetOffset+=recvLength;
+		return recvLength;
+	}
+
+	// move the partial frame to the front to make the room for the next data
+	if(m_dataOffset)
+	{
+		if(m_dataByteSize)
+			memmove(m_buffer,m_buffer+m_dataOffset,m_dataByteSize);
+		m_dataOffset=0;
+	}
+	EP_ASSERT(m_dataByteSize<m_bufferByteSize);
+	int recvLength=recv(socket,m_buffer+m_dataByteSize,m_bufferByteSize-m_dataByteSize,0);
+	if(recvLength>0)
+		m_dataByteSize+=recvLength;
+	return recvLength;
+}
+
+Packet *PacketReceiveBuffer::Pop()
+{
+	if(m_packet)
+	{
+		if(!fillPacket())
+			return NULL;
+		Packet *retPacket=m_packet;
+		m_packet=NULL;
+		m_packetOffset=0;
+		return retPacket;
+	}
+
+	if(m_dataByteSize<sizeof(unsigned int))
+		return NULL;
+	unsigned int packetByteSize=0;
+	memcpy(&packetByteSize,m_buffer+m_dataOffset,sizeof(unsigned int));
+
+	if(m_dataByteSize-sizeof(unsigned int)>=packetByteSize)
+	{
+		Packet *retPacket=EP_NEW Packet(m_buffer+m_dataOffset+sizeof(unsigned int),packetByteSize);
+		m_dataOffset+=sizeof(unsigned int)+packetByteSize;
+		m_dataByteSize-=sizeof(unsigned int)+packetByteSize;
+		if(!m_dataByteSize)
+			m_dataOffset=0;
+		return retPacket;
+	}
+
+	// the packet which never fits into the buffer is assembled separately
+	if(packetByteSize>m_bufferByteSize-sizeof(unsigned int))
+	{
+		m_dataOffset+=sizeof(unsigned int);
+		m_dataByteSize-=sizeof(unsigned int);
+		m_packet=EP_NEW Packet(NULL,packetByteSize);
+		m_packetOffset=0;
+		fillPacket();
+	}
+	return NULL;
+}
+
+unsigned int PacketReceiveBuffer::GetDataByteSize() const
+{
+	return m_dataByteSize;
+}
+
+void PacketReceiveBuffer::Reset()
+{
+	if(m_packet)
+		m_packet->ReleaseObj();
+	m_packet=NULL;
+	m_packetOffset=0;
+	m_dataOffset=0;
+	m_dataByteSize=0;
+}
+
+bool PacketReceiveBuffer::fillPacket()
+{
+	unsigned int remainByteSize=m_packet->GetPacketByteSize()-m_packetOffset;
+	unsigned int copyLength=(remainByteSize<m_dataByteSize)?remainByteSize:m_dataByteSize;
+	if(copyLength)
+	{
+		char *packetData=const_cast<char*>(m_packet->GetPacket());
+		memcpy(packetData+m_packetOffset,m_buffer+m_dataOffset,copyLength);
+		m_packetOffset+=copyLength;
+		m_dataOffset+=copyLength;
+		m_dataByteSize-=copyLength;
+		if(!m_dataByteSize)
+			m_dataOffset=0;
+	}
+	return m_packetOffset==m_packet->GetPacketByteSize();
+}
@@ -25,6 +25,7 @@ THE SOFTWARE.
 */
 #include "epProxyTcpHandler.h"
 #include "epAsyncTcpClient.h"
+#include "epBaseTcpSocket.h"
 #if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
 #define new DEBUG_NEW
 #undef THIS_FILE
@@ -34,8 +35,22 @@ static char THIS_FILE[] = __FILE__;
 using namespace epse;
 
 
-ProxyTcpHandler::ProxyTcpHandler(ProxyServerCallbackInterface *callBack,const ForwardServerInfo& forwardServerInfo, SocketInterface *socket, epl::LockPolicy lockPolicyType):BaseProxyHandler(callBack,socket,lockPolicyType)
+ProxyTcpHandler::ProxyTcpHandler(ProxyServerCallbackInterface *callBack,const ForwardServerInfo& forwardServerInfo, SocketInterface *socket, bool isRelay, ForwardClientPool *forwardClientPool, epl::LockPolicy lockPolicyType):BaseProxyHandler(callBack,socket,lockPolicyType)
 {
+	if(isRelay)
+	{
+		m_relay=EP_NEW SocketRelay(RELAY_BUFFER_BYTE_SIZE,lockPolicyType);
+		return;
+	}
+	if(forwardClientPool)
+	{
+		m_forwardClientPool=forwardClientPool;
+		m_forwardClient=forwardClientPool->Acquire(forwardServerInfo,this);
+		// no forward server to relay to, so the proxy connection is dropped
+		if(!m_forwardClient)
+			socket->KillConnection();
+		return;
+	}
 	m_forwardClient=EP_NEW AsyncTcpClient(lockPolicyType);
 	ClientOps ops;
 	ops.callBackObj=this;
@@ -48,3 +63,70 @@ ProxyTcpHandler::ProxyTcpHandler(ProxyServerCallbackInterface *callBack,const Fo
 ProxyTcpHandler::~ProxyTcpHandler()
 {
 }
+
+bool ProxyTcpHandler::relay(const ForwardServerInfo& forwardServerInfo)
+{
+	EP_ASSERT(m_relay);
+	SOCKET clientSocket=static_cast<BaseTcpSocket*>(m_client)->m_clientSocket;
+	bool isSucceeded=false;
+	SOCKET forwardSocket=connectForwardServer(forwardServerInfo);
+	if(forwardSocket!=INVALID_SOCKET)
+	{
+		isSucceeded=m_relay->Run(clientSocket,forwardSocket);
+		SocketHelper::CloseSocket(forwardSocket);
+	}
+	shutdown(clientSocket,SD_BOTH);
+	return isSucceeded;
+}
+
+void ProxyTcpHandler::OnDisconnect(ClientInterface *client)
+{
+	if(m_forwardClientPool && m_forwardClientPool->IsMultiplexing())
+	{
+		shutdown(static_cast<BaseTcpSocket*>(m_client)->m_clientSocket,SD_BOTH);
+		return;
+	}
+	BaseProxyHandler::OnDisconnect(client);
+}
+
+SOCKET ProxyTcpHandler::connectForwardServer(const ForwardServerInfo& forwardServerInfo)
+{
+#if defined(_UNICODE) || defined(UNICODE)
+	epl::EpString hostName=epl::System::WideCharToMultiByte(forwardServerInfo.hostname);
+	epl::EpString port=epl::System::WideCharToMultiByte(forwardServerInfo.port);
+#else// defined(_UNICODE) || defined(UNICODE)
+	epl::EpString hostName=forwardServerInfo.hostname;
+	epl::EpString port=forwardServerInfo.port;
+#endif// defined(_UNICODE) || defined(UNICODE)
+
+	struct addrinfo hints;
+	ZeroMemory( &hints, sizeof(hints) );
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_protocol = IPPROTO_TCP;
+
+	// Resolve the server address and port
+	struct addrinfo *result=NULL;
+	if(getaddrinfo(hostName.c_str(), port.c_str(), &hints, &result)!=0)
+	{
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) getaddrinfo failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+		return INVALID_SOCKET;
+	}
+
+	SOCKET forwardSocket=INVALID_SOCKET;
+	struct addrinfo *iPtr=0;
+	// Attempt to connect to an address until one succeeds
+	for(iPtr=result; iPtr != NULL ;iPtr=iPtr->ai_next) {
+		forwardSocket = socket(iPtr->ai_family, iPtr->ai_socktype, iPtr->ai_protocol);
+		if (forwardSocket == INVALID_SOCKET)
+			continue;
+		if (connect( forwardSocket, iPtr->ai_addr, static_cast<int>(iPtr->ai_addrlen))!=SOCKET_ERROR)
+			break;
+		SocketHelper::CloseSocket(forwardSocket);
+		forwardSocket = INVALID_SOCKET;
+	}
+	freeaddrinfo(result);
+	if (forwardSocket == INVALID_SOCKET)
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) Unable to connect to forward server!\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+	return forwardSocket;
+}
@@ -61,7 +61,16 @@ ProxyTcpServer & ProxyTcpServer::operator=(const ProxyTcpServer&b)
 
 void ProxyTcpServer::OnNewConnection(SocketInterface *socket)
 {
-	epl::LockObj lock(m_baseProxyServerLock);
-	ProxyTcpHandler *newHandler=EP_NEW ProxyTcpHandler(m_callBack,m_callBack->GetForwardServerInfo(socket->GetSockAddr()),socket);
-	m_proxyHandlerList.push_back(newHandler);
+	ProxyTcpHandler *newHandler;
+	ForwardServerInfo forwardServerInfo;
+	{
+		epl::LockObj lock(m_baseProxyServerLock);
+		forwardServerInfo=m_callBack->GetForwardServerInfo(socket->GetSockAddr());
+		newHandler=EP_NEW ProxyTcpHandler(m_callBack,forwardServerInfo,socket,m_isRelay,m_forwardClientPool);
+		m_proxyHandlerList.push_back(newHandler);
+		if(!m_isRelay)
+			return;
+	}
+	// the relay runs on the thread of the client socket until the connection is closed
+	newHandler->relay(forwardServerInfo);
 }
@@ -0,0 +1,189 @@
+/*! 
+SendQueue for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epSendQueue.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+SendQueue::SendQueue(epl::LockPolicy lockPolicyType)
+{
+	m_lockPolicy=lockPolicyType;
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_queueLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_queueLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_queueLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_queueLock=NULL;
+		break;
+	}
+	m_byteSize=0;
+	m_highWatermark=SEND_QUEUE_WATERMARK_INFINITE;
+	m_lowWatermark=0;
+	m_policy=SEND_QUEUE_POLICY_BLOCK;
+	m_isOverHighWatermark=false;
+	m_isFlushing=false;
+	m_writableEvent=EventEx(true,true);
+}
+
+SendQueue::~SendQueue()
+{
+	for(int trav=0;trav<m_unitList.size();trav++)
+	{
+		m_unitList.at(trav).m_packet->ReleaseObj();
+	}
+	m_unitList.clear();
+	if(m_queueLock)
+		EP_DELETE m_queueLock;
+	m_queueLock=NULL;
+}
+
+void SendQueue::SetWatermark(unsigned int highWatermark,unsigned int lowWatermark,SendQueuePolicy policy)
+{
+	epl::LockObj lock(m_queueLock);
+	m_highWatermark=highWatermark;
+	m_lowWatermark=lowWatermark;
+	if(m_highWatermark!=SEND_QUEUE_WATERMARK_INFINITE && m_lowWatermark>m_highWatermark)
+		m_lowWatermark=m_highWatermark;
+	m_policy=policy;
+}
+
+SendQueue::PushResult SendQueue::Push(Packet *packet,EventEx *completionEvent,ServerCallbackInterface *callBackObj,unsigned int waitTimeMilliSec,bool &retShouldFlush)
+{
+	retShouldFlush=false;
+	unsigned int packetByteSize=packet->GetPacketByteSize();
+	unsigned int startTime=System::GetTickCount();
+
+	m_queueLock->Lock();
+	while(m_highWatermark!=SEND_QUEUE_WATERMARK_INFINITE && m_byteSize && m_byteSize+packetByteSize>m_highWatermark)
+	{
+		if(!m_isOverHighWatermark)
+		{
+			m_isOverHighWatermark=true;
+			m_writableEvent.ResetEvent();
+		}
+		if(m_policy==SEND_QUEUE_POLICY_DROP)
+		{
+			m_queueLock->Unlock();
+			return PUSH_RESULT_DROPPED;
+		}
+		if(m_policy==SEND_QUEUE_POLICY_DISCONNECT)
+		{
+			m_queueLock->Unlock();
+			return PUSH_RESULT_DISCONNECT;
+		}
+
+		// SEND_QUEUE_POLICY_BLOCK waits until the flush drains the queue to the low watermark
+		m_queueLock->Unlock();
+		unsigned int remainTime=WAITTIME_INIFINITE;
+		if(waitTimeMilliSec!=WAITTIME_INIFINITE)
+		{
+			unsigned int elapsedTime=System::GetTickCount()-startTime;
+			if(elapsedTime>=waitTimeMilliSec)
+				return PUSH_RESULT_DROPPED;
+			remainTime=waitTimeMilliSec-elapsedTime;
+		}
+		if(!m_writableEvent.WaitForEvent(remainTime))
+			return PUSH_RESULT_DROPPED;
+		m_queueLock->Lock();
+	}
+
+	SendUnit unit;
+	unit.m_packet=packet;
+	unit.m_completionEvent=completionEvent;
+	unit.m_callBackObj=callBackObj;
+	packet->RetainObj();
+	m_unitList.push_back(unit);
+	m_byteSize+=packetByteSize;
+	if(!m_isFlushing)
+	{
+		m_isFlushing=true;
+		retShouldFlush=true;
+	}
+	m_queueLock->Unlock();
+	return PUSH_RESULT_QUEUED;
+}
+
+void SendQueue::Front(vector<SendUnit> &retUnitList,unsigned int maxCount)
+{
+	epl::LockObj lock(m_queueLock);
+	retUnitList.clear();
+	for(int trav=0;trav<m_unitList.size() && trav<maxCount;trav++)
+	{
+		retUnitList.push_back(m_unitList.at(trav));
+	}
+}
+
+bool SendQueue::Pop(unsigned int count,bool &retIsWritable,bool &retIsDrained)
+{
+	retIsWritable=false;
+	retIsDrained=false;
+	vector<Packet*> sentPacketList;
+	bool isFlushing;
+	{
+		epl::LockObj lock(m_queueLock);
+		for(unsigned int trav=0;trav<count && m_unitList.size();trav++)
+		{
+			Packet *packet=m_unitList.front().m_packet;
+			m_byteSize-=packet->GetPacketByteSize();
+			sentPacketList.push_back(packet);
+			m_unitList.pop_front();
+		}
+		if(m_isOverHighWatermark && m_byteSize<=m_lowWatermark)
+		{
+			m_isOverHighWatermark=false;
+			m_writableEvent.SetEvent();
+			retIsWritable=true;
+		}
+		if(m_unitList.empty())
+		{
+			m_isFlushing=false;
+			retIsDrained=true;
+		}
+		isFlushing=m_isFlushing;
+	}
+	for(int trav=0;trav<sentPacketList.size();trav++)
+	{
+		sentPacketList.at(trav)->ReleaseObj();
+	}
+	return isFlushing;
+}
+
+unsigned int SendQueue::GetByteSize() const
+{
+	return m_byteSize;
+}
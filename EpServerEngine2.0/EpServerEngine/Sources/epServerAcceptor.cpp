@@ -0,0 +1,88 @@
+/*! 
+ServerAcceptor for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epServerAcceptor.h"
+#include "epBaseServer.h"
+
+#if !defined(_WIN32)
+#include <pthread.h>
+#include <sched.h>
+#endif //!defined(_WIN32)
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+ServerAcceptor::ServerAcceptor(BaseServer *owner,SOCKET listenSocket,bool isOwnSocket,unsigned int coreIndex,epl::LockPolicy lockPolicyType):Thread(EP_THREAD_PRIORITY_NORMAL,lockPolicyType)
+{
+	m_owner=owner;
+	m_listenSocket=listenSocket;
+	m_isOwnSocket=isOwnSocket;
+	m_coreIndex=coreIndex;
+}
+
+ServerAcceptor::~ServerAcceptor()
+{
+	Close(WAITTIME_INIFINITE);
+}
+
+void ServerAcceptor::Close(unsigned int waitTimeMilliSec)
+{
+	// the shared socket is closed by the owner, which wakes up this loop as well
+	if(m_isOwnSocket && m_listenSocket!=INVALID_SOCKET)
+	{
+		SocketHelper::CloseSocket(m_listenSocket);
+		m_listenSocket=INVALID_SOCKET;
+	}
+	TerminateAfter(waitTimeMilliSec);
+}
+
+bool ServerAcceptor::SetCurrentThreadAffinity(unsigned int coreIndex)
+{
+	unsigned int coreCount=System::GetNumberOfCores();
+	if(coreCount==0)
+		return false;
+	coreIndex%=coreCount;
+#if defined(_WIN32)
+	if(coreIndex>=sizeof(DWORD_PTR)*8)
+		return false;
+	return SetThreadAffinityMask(GetCurrentThread(),static_cast<DWORD_PTR>(1)<<coreIndex)!=0;
+#else //defined(_WIN32)
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(coreIndex,&cpuSet);
+	return pthread_setaffinity_np(pthread_self(),sizeof(cpu_set_t),&cpuSet)==0;
+#endif //defined(_WIN32)
+}
+
+void ServerAcceptor::execute()
+{
+	SetCurrentThreadAffinity(m_coreIndex);
+	m_owner->listenLoop(m_listenSocket);
+}
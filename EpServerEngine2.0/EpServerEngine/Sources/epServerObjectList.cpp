@@ -78,17 +78,7 @@ ServerObjectList::ServerObjectList(const ServerObjectList& b)
 	}
 	m_waitTime=b.m_waitTime;
 
-	ServerObjectList&unSafeB=const_cast<ServerObjectList&>(b);
-	unSafeB.m_listLock->Lock();
-	m_objectList=b.m_objectList;
-	vector<BaseServerObject*>::iterator iter;
-	for(iter=m_objectList.begin();iter!=m_objectList.end();iter++)
-	{
-		(*iter)->RetainObj();
-		(*iter)->setContainer(this);
-
-	}
-	unSafeB.m_listLock->Unlock();
+	copyList(b);
 
 	m_serverObjRemover=b.m_serverObjRemover;
 
@@ -131,17 +121,7 @@ ServerObjectList & ServerObjectList::operator=(const ServerObjectList&b)
 			break;
 		}
 		m_waitTime=b.m_waitTime;
-		ServerObjectList&unSafeB=const_cast<ServerObjectList&>(b);
-		unSafeB.m_listLock->Lock();
-		m_objectList=b.m_objectList;
-		vector<BaseServerObject*>::iterator iter;
-		for(iter=m_objectList.begin();iter!=m_objectList.end();iter++)
-		{
-			(*iter)->RetainObj();
-			(*iter)->setContainer(this);
-
-		}
-		unSafeB.m_listLock->Unlock();
+		copyList(b);
 
 		m_serverObjRemover=b.m_serverObjRemover;
 
@@ -161,20 +141,65 @@ unsigned int ServerObjectList::GetWaitTime()
 }
 
 
+void ServerObjectList::copyList(const ServerObjectList &b)
+{
+	ServerObjectList&unSafeB=const_cast<ServerObjectList&>(b);
+	unSafeB.m_listLock->Lock();
+	m_objectList=b.m_objectList;
+	m_keyList=b.m_keyList;
+	m_keyMap=b.m_keyMap;
+	for(size_t idx=0;idx<m_objectList.size();idx++)
+	{
+		m_objectList.at(idx)->RetainObj();
+		m_objectList.at(idx)->setContainer(this);
+		m_objectList.at(idx)->m_containerIndex=idx;
+	}
+	unSafeB.m_listLock->Unlock();
+}
+
+void ServerObjectList::removeAt(size_t idx)
+{
+	BaseServerObject *serverObj=m_objectList.at(idx);
+	string &key=m_keyList.at(idx);
+	if(key.size())
+	{
+		stdext::hash_map<string,BaseServerObject*>::iterator keyIter=m_keyMap.find(key);
+		if(keyIter!=m_keyMap.end() && keyIter->second==serverObj)
+			m_keyMap.erase(keyIter);
+	}
+
+	size_t lastIdx=m_objectList.size()-1;
+	if(idx!=lastIdx)
+	{
+		m_objectList.at(idx)=m_objectList.at(lastIdx);
+		m_keyList.at(idx).swap(m_keyList.at(lastIdx));
+		m_objectList.at(idx)->m_containerIndex=idx;
+	}
+	m_objectList.pop_back();
+	m_keyList.pop_back();
+}
+
 bool ServerObjectList::Remove(const BaseServerObject* serverObj)
 {
 	epl::LockObj lock(m_listLock);
-	for(ssize_t idx=static_cast<ssize_t>(m_objectList.size())-1;idx>=0;idx--)
+	if(!serverObj)
+		return false;
+	size_t idx=serverObj->m_containerIndex;
+	// the index is only a hint, since the object may be copied into the other list
+	if(idx>=m_objectList.size() || m_objectList.at(idx)!=serverObj)
 	{
-		if((m_objectList.at(idx))==serverObj)
+		for(idx=0;idx<m_objectList.size();idx++)
 		{
-			m_serverObjRemover.Push(m_objectList.at(idx));
-			m_objectList.erase(m_objectList.begin()+idx);
-			m_sizeEvent.SetEvent();
-			return true;
+			if(m_objectList.at(idx)==serverObj)
+				break;
 		}
+		if(idx==m_objectList.size())
+			return false;
 	}
-	return false;
+	m_serverObjRemover.Push(m_objectList.at(idx));
+	removeAt(idx);
+	m_sizeEvent.SetEvent();
+	return true;
 }
 
 void ServerObjectList::Clear()
@@ -191,6 +216,8 @@ void ServerObjectList::Clear()
 		}
 	}
 	m_objectList.clear();
+	m_keyList.clear();
+	m_keyMap.clear();
 	m_sizeEvent.SetEvent();
 }
 
@@ -200,18 +227,53 @@ void ServerObjectList::Push(BaseServerObject* obj)
 	if(obj)
 	{
 		obj->RetainObj();
+		obj->m_containerIndex=m_objectList.size();
 		m_objectList.push_back(obj);
+		m_keyList.push_back(string());
 		obj->setContainer(this);
 	}
 	
 }
 
+void ServerObjectList::Push(BaseServerObject* obj,const void *key,size_t keyByteSize)
+{
+	epl::LockObj lock(m_listLock);
+	if(obj)
+	{
+		obj->RetainObj();
+		obj->m_containerIndex=m_objectList.size();
+		m_objectList.push_back(obj);
+		m_keyList.push_back(string(reinterpret_cast<const char*>(key),keyByteSize));
+		m_keyMap[m_keyList.back()]=obj;
+		obj->setContainer(this);
+	}
+}
+
+BaseServerObject *ServerObjectList::FindByKey(const void *key,size_t keyByteSize) const
+{
+	epl::LockObj lock(m_listLock);
+	stdext::hash_map<string,BaseServerObject*>::const_iterator keyIter=m_keyMap.find(string(reinterpret_cast<const char*>(key),keyByteSize));
+	if(keyIter==m_keyMap.end())
+		return NULL;
+	return keyIter->second;
+}
+
 vector<BaseServerObject*> ServerObjectList::GetList() const
 {
 	epl::LockObj lock(m_listLock);
 	return m_objectList;
 }
 
+vector<BaseServerObject*> ServerObjectList::GetRetainedList() const
+{
+	epl::LockObj lock(m_listLock);
+	for(int trav=0;trav<m_objectList.size();trav++)
+	{
+		m_objectList.at(trav)->RetainObj();
+	}
+	return m_objectList;
+}
+
 size_t ServerObjectList::Count() const
 {
 	epl::LockObj lock(m_listLock);
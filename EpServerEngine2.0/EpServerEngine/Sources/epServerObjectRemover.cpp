@@ -33,7 +33,7 @@ static char THIS_FILE[] = __FILE__;
 
 using namespace epse;
 
-ServerObjectRemover::ServerObjectRemover(unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType):Thread(EP_THREAD_PRIORITY_NORMAL,lockPolicyType),SmartObject(lockPolicyType)
+ServerObjectRemover::ServerObjectRemover(unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType):Thread(EP_THREAD_PRIORITY_NORMAL,lockPolicyType),SmartObject(lockPolicyType),m_objectList(SERVER_OBJECT_REMOVER_QUEUE_SIZE)
 {
 	m_waitTime=waitTimeMilliSec;
 	m_threadStopEvent=EventEx(false,false);
@@ -41,43 +41,43 @@ ServerObjectRemover::ServerObjectRemover(unsigned int waitTimeMilliSec,epl::Lock
 	switch(lockPolicyType)
 	{
 	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_listLock=EP_NEW epl::CriticalSectionEx();
+		m_waitTimeLock=EP_NEW epl::CriticalSectionEx();
 		m_stopLock=EP_NEW epl::CriticalSectionEx();
 		break;
 	case epl::LOCK_POLICY_MUTEX:
-		m_listLock=EP_NEW epl::Mutex();
+		m_waitTimeLock=EP_NEW epl::Mutex();
 		m_stopLock=EP_NEW epl::Mutex();
 		break;
 	case epl::LOCK_POLICY_NONE:
-		m_listLock=EP_NEW epl::NoLock();
+		m_waitTimeLock=EP_NEW epl::NoLock();
 		m_stopLock=EP_NEW epl::NoLock();
 		break;
 	default:
-		m_listLock=NULL;
+		m_waitTimeLock=NULL;
 		m_stopLock=NULL;
 		break;
 	}
 	Start(TRHEAD_OPCODE_CREATE_SUSPEND);
 }
-ServerObjectRemover::ServerObjectRemover(const ServerObjectRemover& b):Thread(b),SmartObject(b)
+ServerObjectRemover::ServerObjectRemover(const ServerObjectRemover& b):Thread(b),SmartObject(b),m_objectList(SERVER_OBJECT_REMOVER_QUEUE_SIZE)
 {
 	m_lockPolicy=b.m_lockPolicy;
 	switch(m_lockPolicy)
 	{
 	case epl::LOCK_POLICY_CRITICALSECTION:
-		m_listLock=EP_NEW epl::CriticalSectionEx();
+		m_waitTimeLock=EP_NEW epl::CriticalSectionEx();
 		m_stopLock=EP_NEW epl::CriticalSectionEx();
 		break;
 	case epl::LOCK_POLICY_MUTEX:
-		m_listLock=EP_NEW epl::Mutex();
+		m_waitTimeLock=EP_NEW epl::Mutex();
 		m_stopLock=EP_NEW epl::Mutex();
 		break;
 	case epl::LOCK_POLICY_NONE:
-		m_listLock=EP_NEW epl::NoLock();
+		m_waitTimeLock=EP_NEW epl::NoLock();
 		m_stopLock=EP_NEW epl::NoLock();
 		break;
 	default:
-		m_listLock=NULL;
+		m_waitTimeLock=NULL;
 		m_stopLock=NULL;
 		break;
 	}
@@ -86,13 +86,13 @@ ServerObjectRemover::ServerObjectRemover(const ServerObjectRemover& b):Thread(b)
 	m_threadStopEvent=b.m_threadStopEvent;
 	
 	ServerObjectRemover&unSafeB=const_cast<ServerObjectRemover&>(b);
-	unSafeB.m_listLock->Lock();
-	m_objectList=b.m_objectList;
-	while(unSafeB.m_objectList.size())
+	BaseServerObject* serverObj=NULL;
+	while(unSafeB.m_objectList.TryPop(serverObj))
 	{
-		unSafeB.m_objectList.pop();
+		// the queue has the same capacity, so it is full only if pushed meanwhile
+		if(!m_objectList.TryPush(serverObj))
+			serverObj->ReleaseObj();
 	}
-	unSafeB.m_listLock->Unlock();
 
 	m_threadStopEvent.ResetEvent();
 	Start(TRHEAD_OPCODE_CREATE_SUSPEND);
@@ -102,15 +102,14 @@ ServerObjectRemover::~ServerObjectRemover()
 	stopRemover();
 	/// Not Releasing the object in the queue will cause memory leak
 	/// Not recommend to use waitTimeMilliSec other than WAITTIME_INFINITE
-	while(m_objectList.size())
+	BaseServerObject* serverObj=NULL;
+	while(m_objectList.TryPop(serverObj))
 	{
-		BaseServerObject* serverObj=m_objectList.front();
-		m_objectList.pop();
 		serverObj->ReleaseObj();
 	}
-	if(m_listLock)
-		EP_DELETE m_listLock;
-	m_listLock=NULL;
+	if(m_waitTimeLock)
+		EP_DELETE m_waitTimeLock;
+	m_waitTimeLock=NULL;
 	if(m_stopLock)
 		EP_DELETE m_stopLock;
 	m_stopLock=NULL;
@@ -121,15 +120,14 @@ ServerObjectRemover & ServerObjectRemover::operator=(const ServerObjectRemover&b
 	if(this!=&b)
 	{		
 		stopRemover();
-		while(m_objectList.size())
+		BaseServerObject* serverObj=NULL;
+		while(m_objectList.TryPop(serverObj))
 		{
-			BaseServerObject* serverObj=m_objectList.front();
-			m_objectList.pop();
 			serverObj->ReleaseObj();
 		}
-		if(m_listLock)
-			EP_DELETE m_listLock;
-		m_listLock=NULL;
+		if(m_waitTimeLock)
+			EP_DELETE m_waitTimeLock;
+		m_waitTimeLock=NULL;
 		if(m_stopLock)
 			EP_DELETE m_stopLock;
 		m_stopLock=NULL;
@@ -141,19 +139,19 @@ ServerObjectRemover & ServerObjectRemover::operator=(const ServerObjectRemover&b
 		switch(m_lockPolicy)
 		{
 		case epl::LOCK_POLICY_CRITICALSECTION:
-			m_listLock=EP_NEW epl::CriticalSectionEx();
+			m_waitTimeLock=EP_NEW epl::CriticalSectionEx();
 			m_stopLock=EP_NEW epl::CriticalSectionEx();
 			break;
 		case epl::LOCK_POLICY_MUTEX:
-			m_listLock=EP_NEW epl::Mutex();
+			m_waitTimeLock=EP_NEW epl::Mutex();
 			m_stopLock=EP_NEW epl::Mutex();
 			break;
 		case epl::LOCK_POLICY_NONE:
-			m_listLock=EP_NEW epl::NoLock();
+			m_waitTimeLock=EP_NEW epl::NoLock();
 			m_stopLock=EP_NEW epl::NoLock();
 			break;
 		default:
-			m_listLock=NULL;
+			m_waitTimeLock=NULL;
 			m_stopLock=NULL;
 			break;
 		}
@@ -162,15 +160,16 @@ ServerObjectRemover & ServerObjectRemover::operator=(const ServerObjectRemover&b
 		m_threadStopEvent=b.m_threadStopEvent;
 
 		ServerObjectRemover&unSafeB=const_cast<ServerObjectRemover&>(b);
-		unSafeB.m_listLock->Lock();
-		m_objectList=b.m_objectList;
-		while(unSafeB.m_objectList.size())
+		serverObj=NULL;
+		while(unSafeB.m_objectList.TryPop(serverObj))
 		{
-			unSafeB.m_objectList.pop();
+			// the queue is drained above, so it is full only if pushed meanwhile
+			if(!m_objectList.TryPush(serverObj))
+				serverObj->ReleaseObj();
 		}
-		unSafeB.m_listLock->Unlock();
 	
 		m_threadStopEvent.ResetEvent();
+		m_objectList.ClearWakeUp();
 		Start(TRHEAD_OPCODE_CREATE_SUSPEND);
 	}
 	return *this;
@@ -178,53 +177,39 @@ ServerObjectRemover & ServerObjectRemover::operator=(const ServerObjectRemover&b
 
 void ServerObjectRemover::SetWaitTime(unsigned int milliSec)
 {
-	epl::LockObj lock(m_listLock);
+	epl::LockObj lock(m_waitTimeLock);
 	m_waitTime=milliSec;
 }
 unsigned int ServerObjectRemover::GetWaitTime()
 {
-	epl::LockObj lock(m_listLock);
+	epl::LockObj lock(m_waitTimeLock);
 	return m_waitTime;
 }
 
 void ServerObjectRemover::Push(BaseServerObject* obj)
 {
-	m_listLock->Lock();
-	m_objectList.push(obj);
-	m_listLock->Unlock();
 	if(GetStatus()==Thread::THREAD_STATUS_SUSPENDED)
 		Resume();
+	// the object must not be dropped, so wait for the room
+	if(m_objectList.Push(obj,WAITTIME_INIFINITE))
+		return;
+	// the remover is stopped, so nothing will make the room
+	obj->ReleaseObj();
 }
 void ServerObjectRemover::execute()
 {
 	while(1)
 	{
-		m_listLock->Lock();
-
 		if(m_threadStopEvent.WaitForEvent(WAITTIME_IGNORE))
 		{
-			m_listLock->Unlock();
 			break;
 		}
 
-		if(!m_objectList.size())
-		{
-			m_listLock->Unlock();
-			Suspend();
-			m_listLock->Lock();
-		}
-
-
-		while(m_objectList.size())
+		BaseServerObject* serverObj=NULL;
+		if(m_objectList.Pop(serverObj))
 		{
-			BaseServerObject* serverObj=m_objectList.front();
-			m_objectList.pop();
-			m_listLock->Unlock();
 			serverObj->ReleaseObj();
-			m_listLock->Lock();
 		}
-		m_listLock->Unlock();
-		
 	}
 }
 
@@ -241,6 +226,7 @@ void ServerObjectRemover::stopRemover()
 		return;
 	}
 	m_threadStopEvent.SetEvent();
+	m_objectList.WakeUp();
 	if(GetStatus()==Thread::THREAD_STATUS_SUSPENDED)
 		Resume();
 	TerminateAfter(m_waitTime);
@@ -37,6 +37,7 @@ using namespace epse;
 ServerPacketProcessor::ServerPacketProcessor(ServerCallbackInterface *callBackObj,unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType):BasePacketProcessor(waitTimeMilliSec,lockPolicyType)
 {
 	m_callBackObj=callBackObj;
+	m_completionDelegate=NULL;
 }
 
 
@@ -52,6 +53,8 @@ void ServerPacketProcessor::execute()
 	{
 		m_callBackObj->OnReceived((SocketInterface*)m_owner,m_packetReceived,RECEIVE_STATUS_SUCCESS);
 		removeSelfFromContainer();
+		if(m_completionDelegate)
+			m_completionDelegate->OnPacketCompleted();
 	}
 }
 
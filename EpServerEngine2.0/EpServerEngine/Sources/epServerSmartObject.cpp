@@ -0,0 +1,114 @@
+/*! 
+ServerSmartObject for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epServerSmartObject.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+#if !defined(_DEBUG)
+ServerSmartObject::ServerSmartObject(epl::LockPolicy lockPolicyType)
+{
+	initialize(lockPolicyType);
+}
+
+ServerSmartObject::ServerSmartObject(const ServerSmartObject& b)
+{
+	initialize(b.m_lockPolicy);
+}
+
+ServerSmartObject::~ServerSmartObject()
+{
+	destroy();
+}
+
+void ServerSmartObject::RetainObj()
+{
+	incrementRefCount();
+}
+
+void ServerSmartObject::ReleaseObj()
+{
+	if(decrementRefCount()==0)
+		EP_DELETE this;
+}
+#endif //!defined(_DEBUG)
+
+void ServerSmartObject::initialize(epl::LockPolicy lockPolicyType)
+{
+	m_refCount=1;
+	m_lockPolicy=lockPolicyType;
+#if !EP_SERVER_ATOMIC_REFERENCE_COUNT
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_refCounterLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_refCounterLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_refCounterLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_refCounterLock=NULL;
+		break;
+	}
+#endif //!EP_SERVER_ATOMIC_REFERENCE_COUNT
+}
+
+void ServerSmartObject::destroy()
+{
+#if !EP_SERVER_ATOMIC_REFERENCE_COUNT
+	if(m_refCounterLock)
+		EP_DELETE m_refCounterLock;
+	m_refCounterLock=NULL;
+#endif //!EP_SERVER_ATOMIC_REFERENCE_COUNT
+}
+
+long ServerSmartObject::incrementRefCount()
+{
+#if EP_SERVER_ATOMIC_REFERENCE_COUNT
+	return InterlockedIncrement(&m_refCount);
+#else //EP_SERVER_ATOMIC_REFERENCE_COUNT
+	epl::LockObj lock(m_refCounterLock);
+	return ++m_refCount;
+#endif //EP_SERVER_ATOMIC_REFERENCE_COUNT
+}
+
+long ServerSmartObject::decrementRefCount()
+{
+#if EP_SERVER_ATOMIC_REFERENCE_COUNT
+	return InterlockedDecrement(&m_refCount);
+#else //EP_SERVER_ATOMIC_REFERENCE_COUNT
+	epl::LockObj lock(m_refCounterLock);
+	return --m_refCount;
+#endif //EP_SERVER_ATOMIC_REFERENCE_COUNT
+}
@@ -0,0 +1,577 @@
+/*! 
+SocketHelper for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epSocketHelper.h"
+
+#if defined(_WIN32)
+#include <mswsock.h>
+#if (_WIN32_WINNT>=0x0600)
+/// WSASendMsg and WSARecvMsg are available
+#define EP_UDP_OFFLOAD_AVAILABLE
+#endif //(_WIN32_WINNT>=0x0600)
+#ifndef UDP_SEND_MSG_SIZE
+#define UDP_SEND_MSG_SIZE 2
+#endif //UDP_SEND_MSG_SIZE
+#ifndef UDP_RECV_MAX_COALESCED_SIZE
+#define UDP_RECV_MAX_COALESCED_SIZE 3
+#endif //UDP_RECV_MAX_COALESCED_SIZE
+#ifndef UDP_COALESCED_INFO
+#define UDP_COALESCED_INFO 3
+#endif //UDP_COALESCED_INFO
+#else //defined(_WIN32)
+#include <netinet/udp.h>
+#include <vector>
+#if defined(__linux__)
+#define EP_UDP_OFFLOAD_AVAILABLE
+#endif //defined(__linux__)
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif //SOL_UDP
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif //UDP_SEGMENT
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif //UDP_GRO
+#if defined(__linux__)
+/// splice is available
+#define EP_SPLICE_AVAILABLE
+#endif //defined(__linux__)
+#endif //defined(_WIN32)
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+bool SocketHelper::Startup()
+{
+#if defined(_WIN32)
+	WSADATA wsaData;
+	return (WSAStartup(MAKEWORD(2,2), &wsaData)==0);
+#else //defined(_WIN32)
+	return true;
+#endif //defined(_WIN32)
+}
+
+void SocketHelper::Cleanup()
+{
+#if defined(_WIN32)
+	WSACleanup();
+#endif //defined(_WIN32)
+}
+
+int SocketHelper::CloseSocket(SOCKET socket)
+{
+#if defined(_WIN32)
+	return closesocket(socket);
+#else //defined(_WIN32)
+	return close(socket);
+#endif //defined(_WIN32)
+}
+
+int SocketHelper::GetLastSocketError()
+{
+#if defined(_WIN32)
+	return WSAGetLastError();
+#else //defined(_WIN32)
+	return errno;
+#endif //defined(_WIN32)
+}
+
+bool SocketHelper::SetNonBlocking(SOCKET socket,bool isNonBlocking)
+{
+#if defined(_WIN32)
+	u_long mode=isNonBlocking?1:0;
+	return (ioctlsocket(socket,FIONBIO,&mode)!=SOCKET_ERROR);
+#else //defined(_WIN32)
+	int flags=fcntl(socket,F_GETFL,0);
+	if(flags==-1)
+		return false;
+	if(isNonBlocking)
+		flags|=O_NONBLOCK;
+	else
+		flags&=~O_NONBLOCK;
+	return (fcntl(socket,F_SETFL,flags)!=-1);
+#endif //defined(_WIN32)
+}
+
+int SocketHelper::WaitForSocket(SOCKET socket,SocketWaitType waitType,unsigned int waitTimeInMilliSec)
+{
+#if defined(_WIN32)
+	// winsock fd_set is a socket array, so a single socket select is not limited by FD_SETSIZE
+	TIMEVAL	timeOutVal;
+	fd_set	fdSet;
+
+	FD_ZERO(&fdSet);
+	FD_SET(socket, &fdSet);
+	fd_set *readSet=(waitType==SOCKET_WAIT_READ)?&fdSet:NULL;
+	fd_set *writeSet=(waitType==SOCKET_WAIT_WRITE)?&fdSet:NULL;
+	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
+	{
+		// socket select time out setting
+		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
+		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
+		return select(0, readSet, writeSet, NULL, &timeOutVal);
+	}
+	return select(0, readSet, writeSet, NULL, NULL);
+#else //defined(_WIN32)
+	pollfd pollFd;
+	pollFd.fd=socket;
+	pollFd.events=(waitType==SOCKET_WAIT_READ)?POLLIN:POLLOUT;
+	pollFd.revents=0;
+	int timeOut=(waitTimeInMilliSec==WAITTIME_INIFINITE)?-1:static_cast<int>(waitTimeInMilliSec);
+	int retfdNum;
+	do
+	{
+		retfdNum=poll(&pollFd,1,timeOut);
+	}while(retfdNum==SOCKET_ERROR && errno==EINTR);
+	return retfdNum;
+#endif //defined(_WIN32)
+}
+
+void SocketHelper::SetSocketBuffer(SocketBuffer &buffer,const char *data,unsigned int byteSize)
+{
+#if defined(_WIN32)
+	buffer.buf=const_cast<char*>(data);
+	buffer.len=byteSize;
+#else //defined(_WIN32)
+	buffer.iov_base=const_cast<char*>(data);
+	buffer.iov_len=byteSize;
+#endif //defined(_WIN32)
+}
+
+int SocketHelper::SendGather(SOCKET socket,SocketBuffer *bufferList,unsigned int bufferCount)
+{
+	int writeLength=0;
+	while(bufferCount>0)
+	{
+#if defined(_WIN32)
+		DWORD sentLength=0;
+		if(WSASend(socket,bufferList,bufferCount,&sentLength,0,NULL,NULL)==SOCKET_ERROR)
+			return SOCKET_ERROR;
+#else //defined(_WIN32)
+		int sendCount=(bufferCount>IOV_MAX)?IOV_MAX:bufferCount;
+		ssize_t sentLength;
+		do
+		{
+			sentLength=writev(socket,bufferList,sendCount);
+		}while(sentLength==SOCKET_ERROR && errno==EINTR);
+		if(sentLength==SOCKET_ERROR)
+			return SOCKET_ERROR;
+#endif //defined(_WIN32)
+		if(sentLength==0)
+			return 0;
+		writeLength+=static_cast<int>(sentLength);
+
+		// skip the buffers fully sent, and advance the partially sent one
+		unsigned long remainLength=static_cast<unsigned long>(sentLength);
+		while(bufferCount>0)
+		{
+#if defined(_WIN32)
+			char *bufferData=bufferList->buf;
+			unsigned long bufferLength=bufferList->len;
+#else //defined(_WIN32)
+			char *bufferData=reinterpret_cast<char*>(bufferList->iov_base);
+			unsigned long bufferLength=bufferList->iov_len;
+#endif //defined(_WIN32)
+			if(remainLength<bufferLength)
+			{
+				SetSocketBuffer(*bufferList,bufferData+remainLength,bufferLength-remainLength);
+				break;
+			}
+			remainLength-=bufferLength;
+			bufferList++;
+			bufferCount--;
+		}
+	}
+	return writeLength;
+}
+
+bool SocketHelper::SetReusePort(SOCKET socket)
+{
+#if defined(SO_REUSEPORT)
+	int sockoptval=1;
+	return setsockopt(socket,SOL_SOCKET,SO_REUSEPORT,reinterpret_cast<char*>(&sockoptval),sizeof(int))==0;
+#else //defined(SO_REUSEPORT)
+	// SO_REUSEADDR of Winsock does not balance the load, so it is not used in place
+	return false;
+#endif //defined(SO_REUSEPORT)
+}
+
+#if defined(_WIN32) && defined(EP_UDP_OFFLOAD_AVAILABLE)
+/// WSARecvMsg extension function loaded by EnableReceiveOffload
+static LPFN_WSARECVMSG s_recvMsgFunc=NULL;
+#endif //defined(_WIN32) && defined(EP_UDP_OFFLOAD_AVAILABLE)
+
+bool SocketHelper::IsSendOffloadSupported(SOCKET socket)
+{
+#if defined(EP_UDP_OFFLOAD_AVAILABLE)
+#if defined(_WIN32)
+	DWORD segmentSize=0;
+	int optionSize=sizeof(DWORD);
+	return getsockopt(socket,IPPROTO_UDP,UDP_SEND_MSG_SIZE,reinterpret_cast<char*>(&segmentSize),&optionSize)==0;
+#else //defined(_WIN32)
+	int segmentSize=0;
+	socklen_t optionSize=sizeof(int);
+	return getsockopt(socket,SOL_UDP,UDP_SEGMENT,&segmentSize,&optionSize)==0;
+#endif //defined(_WIN32)
+#else //defined(EP_UDP_OFFLOAD_AVAILABLE)
+	return false;
+#endif //defined(EP_UDP_OFFLOAD_AVAILABLE)
+}
+
+bool SocketHelper::EnableReceiveOffload(SOCKET socket,unsigned int maxCoalescedByteSize)
+{
+#if defined(EP_UDP_OFFLOAD_AVAILABLE)
+#if defined(_WIN32)
+	if(!s_recvMsgFunc)
+	{
+		GUID recvMsgGuid=WSAID_WSARECVMSG;
+		LPFN_WSARECVMSG recvMsgFunc=NULL;
+		DWORD returnedSize=0;
+		if(WSAIoctl(socket,SIO_GET_EXTENSION_FUNCTION_POINTER,&recvMsgGuid,sizeof(recvMsgGuid),&recvMsgFunc,sizeof(recvMsgFunc),&returnedSize,NULL,NULL)==SOCKET_ERROR)
+			return false;
+		s_recvMsgFunc=recvMsgFunc;
+	}
+	DWORD coalescedSize=maxCoalescedByteSize;
+	return setsockopt(socket,IPPROTO_UDP,UDP_RECV_MAX_COALESCED_SIZE,reinterpret_cast<char*>(&coalescedSize),sizeof(DWORD))==0;
+#else //defined(_WIN32)
+	int isEnabled=1;
+	return setsockopt(socket,SOL_UDP,UDP_GRO,&isEnabled,sizeof(int))==0;
+#endif //defined(_WIN32)
+#else //defined(EP_UDP_OFFLOAD_AVAILABLE)
+	return false;
+#endif //defined(EP_UDP_OFFLOAD_AVAILABLE)
+}
+
+int SocketHelper::SendSegments(SOCKET socket,SocketBuffer *bufferList,unsigned int bufferCount,unsigned int segmentSize,const sockaddr *sockAddr,int sockAddrSize)
+{
+#if defined(EP_UDP_OFFLOAD_AVAILABLE)
+#if defined(_WIN32)
+	char controlBuffer[WSA_CMSG_SPACE(sizeof(DWORD))];
+	System::Memset(controlBuffer,0,sizeof(controlBuffer));
+	WSAMSG message;
+	System::Memset(&message,0,sizeof(WSAMSG));
+	message.name=const_cast<sockaddr*>(sockAddr);
+	message.namelen=sockAddrSize;
+	message.lpBuffers=bufferList;
+	message.dwBufferCount=bufferCount;
+	message.Control.buf=controlBuffer;
+	message.Control.len=sizeof(controlBuffer);
+	WSACMSGHDR *controlHeader=WSA_CMSG_FIRSTHDR(&message);
+	controlHeader->cmsg_level=IPPROTO_UDP;
+	controlHeader->cmsg_type=UDP_SEND_MSG_SIZE;
+	controlHeader->cmsg_len=WSA_CMSG_LEN(sizeof(DWORD));
+	*reinterpret_cast<DWORD*>(WSA_CMSG_DATA(controlHeader))=segmentSize;
+
+	DWORD sentLength=0;
+	if(WSASendMsg(socket,&message,0,&sentLength,NULL,NULL)==SOCKET_ERROR)
+		return SOCKET_ERROR;
+	return static_cast<int>(sentLength);
+#else //defined(_WIN32)
+	char controlBuffer[CMSG_SPACE(sizeof(unsigned short))];
+	System::Memset(controlBuffer,0,sizeof(controlBuffer));
+	struct msghdr message;
+	System::Memset(&message,0,sizeof(struct msghdr));
+	message.msg_name=const_cast<sockaddr*>(sockAddr);
+	message.msg_namelen=sockAddrSize;
+	message.msg_iov=bufferList;
+	message.msg_iovlen=bufferCount;
+	message.msg_control=controlBuffer;
+	message.msg_controllen=sizeof(controlBuffer);
+	struct cmsghdr *controlHeader=CMSG_FIRSTHDR(&message);
+	controlHeader->cmsg_level=SOL_UDP;
+	controlHeader->cmsg_type=UDP_SEGMENT;
+	controlHeader->cmsg_len=CMSG_LEN(sizeof(unsigned short));
+	*reinterpret_cast<unsigned short*>(CMSG_DATA(controlHeader))=static_cast<unsigned short>(segmentSize);
+
+	ssize_t sentLength;
+	do
+	{
+		sentLength=sendmsg(socket,&message,0);
+	}while(sentLength==SOCKET_ERROR && errno==EINTR);
+	return static_cast<int>(sentLength);
+#endif //defined(_WIN32)
+#else //defined(EP_UDP_OFFLOAD_AVAILABLE)
+	return SOCKET_ERROR;
+#endif //defined(EP_UDP_OFFLOAD_AVAILABLE)
+}
+
+int SocketHelper::ReceiveSegments(SOCKET socket,char *buffer,unsigned int bufferSize,sockaddr *retSockAddr,int *sockAddrSize,unsigned int *retSegmentSize)
+{
+	*retSegmentSize=0;
+#if defined(EP_UDP_OFFLOAD_AVAILABLE)
+#if defined(_WIN32)
+	if(!s_recvMsgFunc)
+		return recvfrom(socket,buffer,bufferSize,0,retSockAddr,sockAddrSize);
+
+	char controlBuffer[WSA_CMSG_SPACE(sizeof(DWORD))];
+	WSABUF dataBuffer;
+	SetSocketBuffer(dataBuffer,buffer,bufferSize);
+	WSAMSG message;
+	System::Memset(&message,0,sizeof(WSAMSG));
+	message.name=retSockAddr;
+	message.namelen=*sockAddrSize;
+	message.lpBuffers=&dataBuffer;
+	message.dwBufferCount=1;
+	message.Control.buf=controlBuffer;
+	message.Control.len=sizeof(controlBuffer);
+
+	DWORD recvLength=0;
+	if(s_recvMsgFunc(socket,&message,&recvLength,NULL,NULL)==SOCKET_ERROR)
+		return SOCKET_ERROR;
+	*sockAddrSize=message.namelen;
+	for(WSACMSGHDR *controlHeader=WSA_CMSG_FIRSTHDR(&message);controlHeader;controlHeader=WSA_CMSG_NXTHDR(&message,controlHeader))
+	{
+		if(controlHeader->cmsg_level==IPPROTO_UDP && controlHeader->cmsg_type==UDP_COALESCED_INFO)
+			*retSegmentSize=*reinterpret_cast<DWORD*>(WSA_CMSG_DATA(controlHeader));
+	}
+	return static_cast<int>(recvLength);
+#else //defined(_WIN32)
+	char controlBuffer[CMSG_SPACE(sizeof(int))];
+	struct iovec dataBuffer;
+	SetSocketBuffer(dataBuffer,buffer,bufferSize);
+	struct msghdr message;
+	System::Memset(&message,0,sizeof(struct msghdr));
+	message.msg_name=retSockAddr;
+	message.msg_namelen=*sockAddrSize;
+	message.msg_iov=&dataBuffer;
+	message.msg_iovlen=1;
+	message.msg_control=controlBuffer;
+	message.msg_controllen=sizeof(controlBuffer);
+
+	ssize_t recvLength;
+	do
+	{
+		recvLength=recvmsg(socket,&message,0);
+	}while(recvLength==SOCKET_ERROR && errno==EINTR);
+	if(recvLength==SOCKET_ERROR)
+		return SOCKET_ERROR;
+	*sockAddrSize=message.msg_namelen;
+	for(struct cmsghdr *controlHeader=CMSG_FIRSTHDR(&message);controlHeader;controlHeader=CMSG_NXTHDR(&message,controlHeader))
+	{
+		if(controlHeader->cmsg_level==SOL_UDP && controlHeader->cmsg_type==UDP_GRO)
+			*retSegmentSize=*reinterpret_cast<int*>(CMSG_DATA(controlHeader));
+	}
+	return static_cast<int>(recvLength);
+#endif //defined(_WIN32)
+#else //defined(EP_UDP_OFFLOAD_AVAILABLE)
+	return recvfrom(socket,buffer,bufferSize,0,retSockAddr,sockAddrSize);
+#endif //defined(EP_UDP_OFFLOAD_AVAILABLE)
+}
+
+int SocketHelper::WaitForSocketList(const SOCKET *socketList,const SocketWaitType *waitTypeList,bool *retIsReadyList,unsigned int socketCount,unsigned int waitTimeInMilliSec)
+{
+	unsigned int trav;
+#if defined(_WIN32)
+	TIMEVAL	timeOutVal;
+	fd_set	readSet;
+	fd_set	writeSet;
+	fd_set	exceptSet;
+
+	FD_ZERO(&readSet);
+	FD_ZERO(&writeSet);
+	FD_ZERO(&exceptSet);
+	for(trav=0;trav<socketCount;trav++)
+	{
+		if(waitTypeList[trav]==SOCKET_WAIT_READ)
+			FD_SET(socketList[trav], &readSet);
+		else
+			FD_SET(socketList[trav], &writeSet);
+		FD_SET(socketList[trav], &exceptSet);
+	}
+	int retfdNum;
+	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
+	{
+		// socket select time out setting
+		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
+		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
+		retfdNum=select(0, &readSet, &writeSet, &exceptSet, &timeOutVal);
+	}
+	else
+		retfdNum=select(0, &readSet, &writeSet, &exceptSet, NULL);
+	if(retfdNum==SOCKET_ERROR)
+		return SOCKET_ERROR;
+	retfdNum=0;
+	for(trav=0;trav<socketCount;trav++)
+	{
+		retIsReadyList[trav]=FD_ISSET(socketList[trav],&readSet) || FD_ISSET(socketList[trav],&writeSet) || FD_ISSET(socketList[trav],&exceptSet);
+		if(retIsReadyList[trav])
+			retfdNum++;
+	}
+	return retfdNum;
+#else //defined(_WIN32)
+	std::vector<pollfd> pollFdList(socketCount);
+	for(trav=0;trav<socketCount;trav++)
+	{
+		pollFdList[trav].fd=socketList[trav];
+		pollFdList[trav].events=(waitTypeList[trav]==SOCKET_WAIT_READ)?POLLIN:POLLOUT;
+		pollFdList[trav].revents=0;
+	}
+	int timeOut=(waitTimeInMilliSec==WAITTIME_INIFINITE)?-1:static_cast<int>(waitTimeInMilliSec);
+	int retfdNum;
+	do
+	{
+		retfdNum=poll(&pollFdList[0],socketCount,timeOut);
+	}while(retfdNum==SOCKET_ERROR && errno==EINTR);
+	if(retfdNum==SOCKET_ERROR)
+		return SOCKET_ERROR;
+	// POLLHUP and POLLERR are reported as ready, so the next call returns the closure or the error
+	for(trav=0;trav<socketCount;trav++)
+	{
+		retIsReadyList[trav]=(pollFdList[trav].revents!=0);
+	}
+	return retfdNum;
+#endif //defined(_WIN32)
+}
+
+bool SocketHelper::IsWouldBlock(int errorCode)
+{
+#if defined(_WIN32)
+	return (errorCode==WSAEWOULDBLOCK);
+#else //defined(_WIN32)
+	return (errorCode==EAGAIN || errorCode==EWOULDBLOCK);
+#endif //defined(_WIN32)
+}
+
+bool SocketHelper::CreateRelayPipe(RelayPipe &retPipe,unsigned int byteSize)
+{
+	retPipe.m_pipe[0]=-1;
+	retPipe.m_pipe[1]=-1;
+	retPipe.m_buffer=NULL;
+	retPipe.m_byteSize=byteSize;
+	retPipe.m_offset=0;
+	retPipe.m_pendingByteSize=0;
+	if(!byteSize)
+		return false;
+#if defined(EP_SPLICE_AVAILABLE)
+	if(pipe(retPipe.m_pipe)==0)
+	{
+		if(fcntl(retPipe.m_pipe[0],F_SETFL,O_NONBLOCK)!=-1 && fcntl(retPipe.m_pipe[1],F_SETFL,O_NONBLOCK)!=-1)
+		{
+#if defined(F_SETPIPE_SZ)
+			// the pipe may stay at the default capacity if the size is over the system limit
+			fcntl(retPipe.m_pipe[1],F_SETPIPE_SZ,static_cast<int>(byteSize));
+#endif //defined(F_SETPIPE_SZ)
+			return true;
+		}
+		close(retPipe.m_pipe[0]);
+		close(retPipe.m_pipe[1]);
+	}
+	// fall back to the user buffer
+	retPipe.m_pipe[0]=-1;
+	retPipe.m_pipe[1]=-1;
+#endif //defined(EP_SPLICE_AVAILABLE)
+	retPipe.m_buffer=EP_NEW char[byteSize];
+	return true;
+}
+
+void SocketHelper::DestroyRelayPipe(RelayPipe &pipe)
+{
+#if defined(EP_SPLICE_AVAILABLE)
+	if(pipe.m_pipe[0]!=-1)
+		close(pipe.m_pipe[0]);
+	if(pipe.m_pipe[1]!=-1)
+		close(pipe.m_pipe[1]);
+#endif //defined(EP_SPLICE_AVAILABLE)
+	pipe.m_pipe[0]=-1;
+	pipe.m_pipe[1]=-1;
+	if(pipe.m_buffer)
+		EP_DELETE[] pipe.m_buffer;
+	pipe.m_buffer=NULL;
+	pipe.m_offset=0;
+	pipe.m_pendingByteSize=0;
+}
+
+int SocketHelper::RelayReceive(SOCKET socket,RelayPipe &pipe)
+{
+	EP_ASSERT(pipe.m_pendingByteSize==0);
+#if defined(EP_SPLICE_AVAILABLE)
+	if(pipe.m_pipe[1]!=-1)
+	{
+		ssize_t recvLength;
+		do
+		{
+			recvLength=splice(socket,NULL,pipe.m_pipe[1],NULL,pipe.m_byteSize,SPLICE_F_MOVE|SPLICE_F_NONBLOCK);
+		}while(recvLength==SOCKET_ERROR && errno==EINTR);
+		if(recvLength>0)
+			pipe.m_pendingByteSize=static_cast<unsigned int>(recvLength);
+		return static_cast<int>(recvLength);
+	}
+#endif //defined(EP_SPLICE_AVAILABLE)
+#if defined(_WIN32)
+	int recvLength=recv(socket,pipe.m_buffer,pipe.m_byteSize,0);
+#else //defined(_WIN32)
+	int recvLength;
+	do
+	{
+		recvLength=static_cast<int>(recv(socket,pipe.m_buffer,pipe.m_byteSize,0));
+	}while(recvLength==SOCKET_ERROR && errno==EINTR);
+#endif //defined(_WIN32)
+	if(recvLength>0)
+	{
+		pipe.m_offset=0;
+		pipe.m_pendingByteSize=static_cast<unsigned int>(recvLength);
+	}
+	return recvLength;
+}
+
+int SocketHelper::RelaySend(SOCKET socket,RelayPipe &pipe)
+{
+	if(!pipe.m_pendingByteSize)
+		return 0;
+#if defined(EP_SPLICE_AVAILABLE)
+	if(pipe.m_pipe[0]!=-1)
+	{
+		ssize_t sentLength;
+		do
+		{
+			sentLength=splice(pipe.m_pipe[0],NULL,socket,NULL,pipe.m_pendingByteSize,SPLICE_F_MOVE|SPLICE_F_NONBLOCK);
+		}while(sentLength==SOCKET_ERROR && errno==EINTR);
+		if(sentLength>0)
+			pipe.m_pendingByteSize-=static_cast<unsigned int>(sentLength);
+		return static_cast<int>(sentLength);
+	}
+#endif //defined(EP_SPLICE_AVAILABLE)
+#if defined(_WIN32)
+	int sentLength=send(socket,pipe.m_buffer+pipe.m_offset,pipe.m_pendingByteSize,0);
+#else //defined(_WIN32)
+	int sentLength;
+	do
+	{
+		sentLength=static_cast<int>(send(socket,pipe.m_buffer+pipe.m_offset,pipe.m_pendingByteSize,0));
+	}while(sentLength==SOCKET_ERROR && errno==EINTR);
+#endif //defined(_WIN32)
+	if(sentLength>0)
+	{
+		pipe.m_offset+=static_cast<unsigned int>(sentLength);
+		pipe.m_pendingByteSize-=static_cast<unsigned int>(sentLength);
+	}
+	return sentLength;
+}
@@ -0,0 +1,171 @@
+/*!
+SocketRelay for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epSocketRelay.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+SocketRelay::SocketRelay(unsigned int byteSize,epl::LockPolicy lockPolicyType)
+{
+	m_lockPolicy=lockPolicyType;
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_relayLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_relayLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_relayLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_relayLock=NULL;
+		break;
+	}
+	m_byteSize=byteSize;
+	m_clientSocket=INVALID_SOCKET;
+	m_serverSocket=INVALID_SOCKET;
+	m_isStopped=false;
+}
+
+SocketRelay::~SocketRelay()
+{
+	if(m_relayLock)
+		EP_DELETE m_relayLock;
+	m_relayLock=NULL;
+}
+
+bool SocketRelay::Run(SOCKET clientSocket,SOCKET serverSocket)
+{
+	{
+		epl::LockObj lock(m_relayLock);
+		if(m_isStopped)
+			return false;
+		m_clientSocket=clientSocket;
+		m_serverSocket=serverSocket;
+	}
+
+	// index 0 relays from the client to the server, and index 1 from the server to the client
+	SOCKET fromSocketList[2]={clientSocket,serverSocket};
+	SOCKET toSocketList[2]={serverSocket,clientSocket};
+	bool isClosedList[2]={false,false};
+	SocketHelper::RelayPipe pipeList[2];
+	bool isSucceeded=SocketHelper::CreateRelayPipe(pipeList[0],m_byteSize);
+	isSucceeded=SocketHelper::CreateRelayPipe(pipeList[1],m_byteSize) && isSucceeded;
+	isSucceeded=isSucceeded && SocketHelper::SetNonBlocking(clientSocket,true) && SocketHelper::SetNonBlocking(serverSocket,true);
+
+	while(isSucceeded && !(isClosedList[0] && isClosedList[1]))
+	{
+		// wait for the source to read while the pipe is empty, otherwise for the destination to write
+		SOCKET waitSocketList[2];
+		SocketHelper::SocketWaitType waitTypeList[2];
+		unsigned int directionList[2];
+		bool isReadyList[2];
+		unsigned int waitCount=0;
+		for(unsigned int trav=0;trav<2;trav++)
+		{
+			if(isClosedList[trav])
+				continue;
+			if(pipeList[trav].m_pendingByteSize)
+			{
+				waitSocketList[waitCount]=toSocketList[trav];
+				waitTypeList[waitCount]=SocketHelper::SOCKET_WAIT_WRITE;
+			}
+			else
+			{
+				waitSocketList[waitCount]=fromSocketList[trav];
+				waitTypeList[waitCount]=SocketHelper::SOCKET_WAIT_READ;
+			}
+			directionList[waitCount]=trav;
+			waitCount++;
+		}
+		if(SocketHelper::WaitForSocketList(waitSocketList,waitTypeList,isReadyList,waitCount)==SOCKET_ERROR)
+		{
+			isSucceeded=false;
+			break;
+		}
+		if(m_isStopped)
+		{
+			isSucceeded=false;
+			break;
+		}
+		for(unsigned int trav=0;trav<waitCount && isSucceeded;trav++)
+		{
+			if(!isReadyList[trav])
+				continue;
+			unsigned int direction=directionList[trav];
+			isSucceeded=relay(fromSocketList[direction],toSocketList[direction],pipeList[direction],isClosedList[direction]);
+		}
+	}
+
+	SocketHelper::DestroyRelayPipe(pipeList[0]);
+	SocketHelper::DestroyRelayPipe(pipeList[1]);
+	SocketHelper::SetNonBlocking(clientSocket,false);
+	SocketHelper::SetNonBlocking(serverSocket,false);
+
+	epl::LockObj lock(m_relayLock);
+	m_clientSocket=INVALID_SOCKET;
+	m_serverSocket=INVALID_SOCKET;
+	return isSucceeded;
+}
+
+bool SocketRelay::relay(SOCKET fromSocket,SOCKET toSocket,SocketHelper::RelayPipe &pipe,bool &retIsClosed)
+{
+	if(!pipe.m_pendingByteSize)
+	{
+		int recvLength=SocketHelper::RelayReceive(fromSocket,pipe);
+		if(recvLength==0)
+		{
+			// pass the closure on, while the other direction keeps relaying
+			shutdown(toSocket,SD_SEND);
+			retIsClosed=true;
+			return true;
+		}
+		if(recvLength==SOCKET_ERROR)
+			return SocketHelper::IsWouldBlock(SocketHelper::GetLastSocketError());
+	}
+	// the destination is mostly writable, so send right away without waiting
+	if(SocketHelper::RelaySend(toSocket,pipe)==SOCKET_ERROR)
+		return SocketHelper::IsWouldBlock(SocketHelper::GetLastSocketError());
+	return true;
+}
+
+void SocketRelay::Stop()
+{
+	epl::LockObj lock(m_relayLock);
+	m_isStopped=true;
+	// shutdown wakes the wait of Run, while close does not on every platform
+	if(m_clientSocket!=INVALID_SOCKET)
+		shutdown(m_clientSocket,SD_BOTH);
+	if(m_serverSocket!=INVALID_SOCKET)
+		shutdown(m_serverSocket,SD_BOTH);
+}
@@ -95,15 +95,13 @@ bool SyncTcpClient::Connect(const ClientOps &ops)
 	SetWaitTime(ops.waitTimeMilliSec);
 
 
-	WSADATA wsaData;
 	m_connectSocket=INVALID_SOCKET;
 	struct addrinfo hints;
 	int iResult;
 
-	// Initialize Winsock
-	iResult = WSAStartup(MAKEWORD(2,2), &wsaData);
-	if (iResult != 0) {
-		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) WSAStartup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
+	// Initialize socket library
+	if (!SocketHelper::Startup()) {
+		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) socket startup failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
 		return false;
 	}
 
@@ -116,7 +114,7 @@ bool SyncTcpClient::Connect(const ClientOps &ops)
 	iResult = getaddrinfo(m_hostName.c_str(), m_port.c_str(), &hints, &m_result);
 	if ( iResult != 0 ) {
 		epl::System::OutputDebugString(_T("%s::%s(%d)(%x) getaddrinfo failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-		WSACleanup();
+		SocketHelper::Cleanup();
 		return false;
 	}
 
@@ -136,7 +134,7 @@ bool SyncTcpClient::Connect(const ClientOps &ops)
 		// Connect to server.
 		iResult = connect( m_connectSocket, iPtr->ai_addr, static_cast<int>(iPtr->ai_addrlen));
 		if (iResult == SOCKET_ERROR) {
-			closesocket(m_connectSocket);
+			SocketHelper::CloseSocket(m_connectSocket);
 			m_connectSocket = INVALID_SOCKET;
 			continue;
 		}
@@ -147,6 +145,7 @@ bool SyncTcpClient::Connect(const ClientOps &ops)
 		cleanUpClient();
 		return false;
 	}
+	m_packetRecvBuffer.Reset();
 	m_isConnected=true;
 	return true;
 
@@ -171,7 +170,7 @@ void SyncTcpClient::Disconnect()
 		// shutdown the connection since no more data will be sent
 		int iResult = shutdown(m_connectSocket, SD_SEND);
 		if (iResult == SOCKET_ERROR) {
-			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this, WSAGetLastError());
+			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) shutdown failed with error: %d\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this, SocketHelper::GetLastSocketError());
 		}
 
 	}
@@ -204,6 +203,12 @@ int SyncTcpClient::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 	return BaseTcpClient::Send(packet,waitTimeInMilliSec,sendStatus);
 }
 
+int SyncTcpClient::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	epl::LockObj lock(m_generalLock);
+	return BaseTcpClient::BatchSend(packetList,packetCount,waitTimeInMilliSec,sendStatus);
+}
+
 Packet *SyncTcpClient::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *retStatus)
 {
 	epl::LockObj lock(m_generalLock);
@@ -214,34 +219,25 @@ Packet *SyncTcpClient::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 		return NULL;
 	}
 
-	// select routine
-	TIMEVAL	timeOutVal;
-	fd_set	fdSet;
-	int		retfdNum = 0;
-
-	FD_ZERO(&fdSet);
-	FD_SET(m_connectSocket, &fdSet);
-	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
-	{
-		// socket select time out setting
-		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
-		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
-		// socket select
-		// socket read select
-		retfdNum = select(0,&fdSet, NULL, NULL, &timeOutVal);
-	}
-	else
+	// a packet read ahead by the previous receive is returned without waiting
+	Packet *recvPacket=m_packetRecvBuffer.Pop();
+	if(recvPacket)
 	{
-		retfdNum = select(0, &fdSet,NULL, NULL, NULL);
+		if(retStatus)
+			*retStatus=RECEIVE_STATUS_SUCCESS;
+		return recvPacket;
 	}
-	if (retfdNum == SOCKET_ERROR)	// select failed
+
+	// wait routine
+	int		retfdNum = SocketHelper::WaitForSocket(m_connectSocket, SocketHelper::SOCKET_WAIT_READ, waitTimeInMilliSec);
+	if (retfdNum == SOCKET_ERROR)	// wait failed
 	{
 		disconnect();
 		if(retStatus)
 			*retStatus=RECEIVE_STATUS_FAIL_SOCKET_ERROR;
 		return NULL;
 	}
-	else if (retfdNum == 0)		    // select time-out
+	else if (retfdNum == 0)		    // wait time-out
 	{
 		if(retStatus)
 			*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
@@ -249,40 +245,29 @@ Packet *SyncTcpClient::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 	}
 
 	// receive routine
-	int iResult;
-	int size =receive(m_recvSizePacket);
-	if(size>0)
-	{
-		unsigned int shouldReceive=(reinterpret_cast<unsigned int*>(const_cast<char*>(m_recvSizePacket.GetPacket())))[0];
-		Packet *recvPacket=EP_NEW Packet(NULL,shouldReceive);
-		iResult = receive(*recvPacket);
-
-		if (iResult == shouldReceive) {
-			if(retStatus)
-				*retStatus=RECEIVE_STATUS_SUCCESS;
-			return recvPacket;
-		}
-		else if (iResult == 0)
+	// a single recv may bring several packets, so the rest are kept for the next Receive
+	do{
+		int iResult=m_packetRecvBuffer.Fill(m_connectSocket);
+		if (iResult == 0)
 		{
 			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) Connection closing...\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-			recvPacket->ReleaseObj();
 			disconnect();
 			if(retStatus)
 				*retStatus=RECEIVE_STATUS_FAIL_CONNECTION_CLOSING;
 			return NULL;
 		}
-		else  {
+		else if (iResult < 0)
+		{
 			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) recv failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-			recvPacket->ReleaseObj();
 			disconnect();
 			if(retStatus)
 				*retStatus=RECEIVE_STATUS_FAIL_RECEIVE_FAILED;
 			return NULL;
 		}
-	}
-	else
-	{
-		disconnect();
-		return NULL;
-	}
+		recvPacket=m_packetRecvBuffer.Pop();
+	}while(!recvPacket);
+
+	if(retStatus)
+		*retStatus=RECEIVE_STATUS_SUCCESS;
+	return recvPacket;
 }
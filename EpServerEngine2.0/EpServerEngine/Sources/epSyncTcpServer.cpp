@@ -54,14 +54,14 @@ SyncTcpServer & SyncTcpServer::operator=(const SyncTcpServer&b)
 	return *this;
 }
 
-void SyncTcpServer::execute()
+void SyncTcpServer::listenLoop(SOCKET listenSocket)
 {
 	SOCKET clientSocket;
 	sockaddr sockAddr;
 	int sizeOfSockAddr=sizeof(sockaddr);
 	while(1)
 	{
-		clientSocket=accept(m_listenSocket,&sockAddr,&sizeOfSockAddr);
+		clientSocket=accept(listenSocket,&sockAddr,&sizeOfSockAddr);
 		if(clientSocket == INVALID_SOCKET || m_listenSocket== INVALID_SOCKET)
 		{
 			break;			
@@ -70,13 +70,13 @@ void SyncTcpServer::execute()
 		{
 			if(!m_callBackObj->OnAccept(sockAddr))
 			{
-				closesocket(clientSocket);
+				SocketHelper::CloseSocket(clientSocket);
 				continue;
 			}
 			SyncTcpSocket *accWorker=EP_NEW SyncTcpSocket(m_callBackObj,m_waitTime,m_lockPolicy);
 			if(!accWorker)
 			{
-				closesocket(clientSocket);
+				SocketHelper::CloseSocket(clientSocket);
 				continue;
 			}
 			accWorker->setClientSocket(clientSocket);
@@ -84,6 +84,7 @@ void SyncTcpServer::execute()
 			accWorker->setSockAddr(sockAddr);
 			m_socketList.Push(accWorker);	
 			accWorker->Start();
+			startActivityTimer(accWorker);
 			accWorker->ReleaseObj();
 			if(GetMaximumConnectionCount()!=CONNECTION_LIMIT_INFINITE)
 			{
@@ -95,6 +96,4 @@ void SyncTcpServer::execute()
 
 		}
 	}
-
-	stopServer();
-} 
+}
@@ -70,7 +70,7 @@ void SyncTcpSocket::KillConnection()
 		return;
 	}
 
-	closesocket(m_clientSocket);
+	SocketHelper::CloseSocket(m_clientSocket);
 	m_clientSocket = INVALID_SOCKET;
 	removeSelfFromContainer();
 	m_callBackObj->OnDisconnect(this);
@@ -85,7 +85,7 @@ void SyncTcpSocket::killConnection()
 		// No longer need client socket
 		if(m_clientSocket!=INVALID_SOCKET)
 		{
-			closesocket(m_clientSocket);
+			SocketHelper::CloseSocket(m_clientSocket);
 			m_clientSocket = INVALID_SOCKET;
 		}
 
@@ -100,6 +100,12 @@ int SyncTcpSocket::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 	return BaseTcpSocket::Send(packet,waitTimeInMilliSec,sendStatus);
 }
 
+int SyncTcpSocket::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	epl::LockObj lock(m_baseSocketLock);
+	return BaseTcpSocket::BatchSend(packetList,packetCount,waitTimeInMilliSec,sendStatus);
+}
+
 Packet *SyncTcpSocket::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *retStatus)
 {
 	epl::LockObj lock(m_baseSocketLock);
@@ -110,34 +116,26 @@ Packet *SyncTcpSocket::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 		return NULL;
 	}
 
-	// select routine
-	TIMEVAL	timeOutVal;
-	fd_set	fdSet;
-	int		retfdNum = 0;
-
-	FD_ZERO(&fdSet);
-	FD_SET(m_clientSocket, &fdSet);
-	if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
+	// a packet read ahead by the previous receive is returned without waiting
+	Packet *recvPacket=m_packetRecvBuffer.Pop();
+	if(recvPacket)
 	{
-		// socket select time out setting
-		timeOutVal.tv_sec = (long)(waitTimeInMilliSec/1000); // Convert to seconds
-		timeOutVal.tv_usec = (long)(waitTimeInMilliSec%1000)*1000; // Convert remainders to micro-seconds
-		// socket select
-		// socket read select
-		retfdNum = select(0,&fdSet, NULL, NULL, &timeOutVal);
-	}
-	else
-	{
-		retfdNum = select(0, &fdSet,NULL, NULL, NULL);
+		markActive();
+		if(retStatus)
+			*retStatus=RECEIVE_STATUS_SUCCESS;
+		return recvPacket;
 	}
-	if (retfdNum == SOCKET_ERROR)	// select failed
+
+	// wait routine
+	int		retfdNum = SocketHelper::WaitForSocket(m_clientSocket, SocketHelper::SOCKET_WAIT_READ, waitTimeInMilliSec);
+	if (retfdNum == SOCKET_ERROR)	// wait failed
 	{
 		killConnection();
 		if(retStatus)
 			*retStatus=RECEIVE_STATUS_FAIL_SOCKET_ERROR;
 		return NULL;
 	}
-	else if (retfdNum == 0)		    // select time-out
+	else if (retfdNum == 0)		    // wait time-out
 	{
 		if(retStatus)
 			*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
@@ -145,44 +143,32 @@ Packet *SyncTcpSocket::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 	}
 
 	// receive routine
-	int iResult =receive(m_recvSizePacket);
-	if(iResult>0)
-	{
-		unsigned int shouldReceive=(reinterpret_cast<unsigned int*>(const_cast<char*>(m_recvSizePacket.GetPacket())))[0];
-		Packet *recvPacket=EP_NEW Packet(NULL,shouldReceive);
-		iResult = receive(*recvPacket);
-
-		if (iResult == shouldReceive) {
-			if(retStatus)
-				*retStatus=RECEIVE_STATUS_SUCCESS;
-			return recvPacket;
-		}
-		else if (iResult == 0)
+	// a single recv may bring several packets, so the rest are kept for the next Receive
+	do{
+		int iResult=m_packetRecvBuffer.Fill(m_clientSocket);
+		if (iResult == 0)
 		{
 			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) Connection closing...\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-			recvPacket->ReleaseObj();
 			killConnection();
 			if(retStatus)
 				*retStatus=RECEIVE_STATUS_FAIL_CONNECTION_CLOSING;
 			return NULL;
 		}
-		else  {
+		else if (iResult < 0)
+		{
 			epl::System::OutputDebugString(_T("%s::%s(%d)(%x) recv failed with error\r\n"),__TFILE__,__TFUNCTION__,__LINE__,this);
-			recvPacket->ReleaseObj();
 			killConnection();
 			if(retStatus)
 				*retStatus=RECEIVE_STATUS_FAIL_RECEIVE_FAILED;
 			return NULL;
 		}
-	}
-	else
-	{
-		killConnection();
-		if(retStatus)
-			*retStatus=RECEIVE_STATUS_FAIL_CONNECTION_CLOSING;
-		return NULL;
-	}
+		recvPacket=m_packetRecvBuffer.Pop();
+	}while(!recvPacket);
 
+	markActive();
+	if(retStatus)
+		*retStatus=RECEIVE_STATUS_SUCCESS;
+	return recvPacket;
 }
 void SyncTcpSocket::execute()
 {
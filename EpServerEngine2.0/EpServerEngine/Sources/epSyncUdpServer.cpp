@@ -54,65 +54,54 @@ SyncUdpServer & SyncUdpServer::operator=(const SyncUdpServer&b)
 	return *this;
 }
 
-void SyncUdpServer::execute()
+void SyncUdpServer::processDatagram(const char *packetData,int recvLength,const sockaddr &clientSockAddr)
 {
-	Packet recvPacket(NULL,m_maxPacketSize);
-	char *packetData=const_cast<char*>(recvPacket.GetPacket());
-	int length=recvPacket.GetPacketByteSize();
-	sockaddr clientSockAddr;
-	int sockAddrSize=sizeof(sockaddr);
-	while(m_listenSocket!=INVALID_SOCKET)
+	SyncUdpSocket *workerObj=(SyncUdpSocket*)findPeer(clientSockAddr);
+	if(workerObj)
 	{
-		int recvLength=recvfrom(m_listenSocket,packetData,length, 0,&clientSockAddr,&sockAddrSize);
-
-		SyncUdpSocket *workerObj=(SyncUdpSocket*)m_socketList.Find(clientSockAddr,socketCompare);
-		if(workerObj)
+		if(recvLength<=0)
 		{
-			if(recvLength<=0)
-			{
-				Packet *passPacket=EP_NEW Packet(packetData,0);
-				workerObj->addPacket(passPacket);
-				passPacket->ReleaseObj();
-				continue;
-			}	
-			Packet *passPacket=EP_NEW Packet(packetData,recvLength);
+			Packet *passPacket=EP_NEW Packet(packetData,0);
 			workerObj->addPacket(passPacket);
 			passPacket->ReleaseObj();
-		}
-		else
+			return;
+		}	
+		Packet *passPacket=EP_NEW Packet(packetData,recvLength);
+		workerObj->addPacket(passPacket);
+		passPacket->ReleaseObj();
+	}
+	else
+	{
+		if(recvLength<=0)
+			return;
+		if(GetMaximumConnectionCount()!=CONNECTION_LIMIT_INFINITE)
 		{
-			if(recvLength<=0)
-				continue;
-			if(GetMaximumConnectionCount()!=CONNECTION_LIMIT_INFINITE)
-			{
-				if(m_socketList.Count()>=GetMaximumConnectionCount())
-				{
-					continue;
-				}
-			}
-			if(!m_callBackObj->OnAccept(clientSockAddr))
-			{
-				continue;
-			}
-			/// Create Worker Thread
-			SyncUdpSocket *accWorker=EP_NEW SyncUdpSocket(m_callBackObj,m_waitTime,m_lockPolicy);
-			if(!accWorker)
+			if(m_socketList.Count()>=GetMaximumConnectionCount())
 			{
-				continue;
+				return;
 			}
-			Packet *passPacket=EP_NEW Packet(packetData,recvLength);
-			accWorker->setSockAddr(clientSockAddr);
-			accWorker->setOwner(this);
-			accWorker->setMaxPacketByteSize(m_maxPacketSize);
-			m_socketList.Push(accWorker);
-			accWorker->Start();
-			accWorker->addPacket(passPacket);
-			accWorker->ReleaseObj();
-			passPacket->ReleaseObj();
-
 		}
+		if(!m_callBackObj->OnAccept(clientSockAddr))
+		{
+			return;
+		}
+		/// Create Worker Thread
+		SyncUdpSocket *accWorker=EP_NEW SyncUdpSocket(m_callBackObj,m_waitTime,m_lockPolicy);
+		if(!accWorker)
+		{
+			return;
+		}
+		Packet *passPacket=EP_NEW Packet(packetData,recvLength);
+		accWorker->setSockAddr(clientSockAddr);
+		accWorker->setOwner(this);
+		accWorker->setMaxPacketByteSize(m_maxPacketSize);
+		pushPeer(accWorker,clientSockAddr);
+		accWorker->Start();
+		startActivityTimer(accWorker);
+		accWorker->addPacket(passPacket);
+		accWorker->ReleaseObj();
+		passPacket->ReleaseObj();
 
 	}
+}
 
-	stopServer();
-} 
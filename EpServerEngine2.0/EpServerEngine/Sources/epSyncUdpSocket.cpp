@@ -35,7 +35,6 @@ static char THIS_FILE[] = __FILE__;
 using namespace epse;
 SyncUdpSocket::SyncUdpSocket(ServerCallbackInterface *callBackObj,unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType): BaseUdpSocket(callBackObj,waitTimeMilliSec,lockPolicyType)
 {
-	m_packetReceivedEvent=EventEx(false,false);
 	m_isConnected=true;
 }
 
@@ -58,16 +57,7 @@ void SyncUdpSocket::KillConnection()
 	}
 	m_isConnected=false;
 
-	m_listLock->Lock();
-	Packet *removeElem=NULL;
-	while(!m_packetList.empty())
-	{
-		removeElem=m_packetList.front();
-		if(removeElem)
-			removeElem->ReleaseObj();
-		m_packetList.pop();
-	}
-	m_listLock->Unlock();
+	clearPacketList();
 
 	removeSelfFromContainer();
 	m_callBackObj->OnDisconnect(this);
@@ -80,16 +70,7 @@ void SyncUdpSocket::killConnection()
 	{
 		m_isConnected=false;
 
-		m_listLock->Lock();
-		Packet *removeElem=NULL;
-		while(!m_packetList.empty())
-		{
-			removeElem=m_packetList.front();
-			if(removeElem)
-				removeElem->ReleaseObj();
-			m_packetList.pop();
-		}
-		m_listLock->Unlock();
+		clearPacketList();
 
 
 		removeSelfFromContainer();
@@ -100,11 +81,7 @@ void SyncUdpSocket::killConnection()
 
 void SyncUdpSocket::addPacket(Packet *packet)
 {
-	if(packet)
-		packet->RetainObj();
-	epl::LockObj lock(m_listLock);
-	m_packetList.push(packet);
-	m_packetReceivedEvent.SetEvent();
+	pushPacket(packet);
 }
 
 int SyncUdpSocket::Send(const Packet &packet, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
@@ -113,6 +90,12 @@ int SyncUdpSocket::Send(const Packet &packet, unsigned int waitTimeInMilliSec,Se
 	return BaseUdpSocket::Send(packet,waitTimeInMilliSec,sendStatus);
 }
 
+int SyncUdpSocket::BatchSend(const Packet *const *packetList,unsigned int packetCount, unsigned int waitTimeInMilliSec,SendStatus *sendStatus)
+{
+	epl::LockObj lock(m_baseSocketLock);
+	return BaseUdpSocket::BatchSend(packetList,packetCount,waitTimeInMilliSec,sendStatus);
+}
+
 Packet *SyncUdpSocket::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *retStatus)
 {
 	epl::LockObj lock(m_baseSocketLock);
@@ -126,30 +109,25 @@ Packet *SyncUdpSocket::Receive(unsigned int waitTimeInMilliSec,ReceiveStatus *re
 	// receive routine
 	unsigned int packetSize=0;
 
-	m_listLock->Lock();
-	if(m_packetList.size()==0)
+	Packet *packet=NULL;
+	while(!m_packetList.Pop(packet,waitTimeInMilliSec))
 	{
-		m_listLock->Unlock();
-		if(!m_packetReceivedEvent.WaitForEvent(waitTimeInMilliSec))
+		if(waitTimeInMilliSec!=WAITTIME_INIFINITE)
 		{
 			if(retStatus)
 				*retStatus=RECEIVE_STATUS_FAIL_TIME_OUT;
 			return NULL;
 		}
-
 	}
-	Packet *packet= m_packetList.front();
 	packetSize=packet->GetPacketByteSize();
 	if(packetSize==0)
 	{
-		m_listLock->Unlock();
+		packet->ReleaseObj();
 		killConnection();
 		if(retStatus)
 			*retStatus=RECEIVE_STATUS_FAIL_CONNECTION_CLOSING;
 		return NULL;
 	}
-	m_packetList.pop();
-	m_listLock->Unlock();
 	if(retStatus)
 		*retStatus=RECEIVE_STATUS_SUCCESS;
 	return packet;
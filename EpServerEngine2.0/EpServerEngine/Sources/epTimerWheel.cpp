@@ -0,0 +1,293 @@
+/*! 
+TimerWheel for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epTimerWheel.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+TimerWheel::Timer::Timer(epl::SmartObject *target)
+{
+	m_prev=NULL;
+	m_next=NULL;
+	m_expireTick=0;
+	m_level=0;
+	m_slot=0;
+	m_isArmed=false;
+	m_isExpiring=false;
+	m_target=target;
+}
+
+TimerWheel::Timer::~Timer()
+{
+	EP_ASSERT(!m_isArmed);
+}
+
+bool TimerWheel::Timer::IsArmed() const
+{
+	return m_isArmed;
+}
+
+void TimerWheel::Timer::setTarget(epl::SmartObject *target)
+{
+	EP_ASSERT(!m_isArmed);
+	m_target=target;
+}
+
+TimerWheel::TimerWheel(unsigned int tickMilliSec,unsigned int waitTimeMilliSec,epl::LockPolicy lockPolicyType):Thread(EP_THREAD_PRIORITY_NORMAL,lockPolicyType)
+{
+	EP_ASSERT(tickMilliSec>0);
+	m_tickMilliSec=tickMilliSec;
+	m_waitTime=waitTimeMilliSec;
+	m_currentTick=0;
+	m_lockPolicy=lockPolicyType;
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_timerLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_timerLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_timerLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_timerLock=NULL;
+		break;
+	}
+	System::Memset(m_slotList,0,sizeof(m_slotList));
+	m_threadStopEvent=EventEx(false,false);
+}
+
+TimerWheel::~TimerWheel()
+{
+	Close();
+	if(m_timerLock)
+		EP_DELETE m_timerLock;
+	m_timerLock=NULL;
+}
+
+bool TimerWheel::Create()
+{
+	if(GetStatus()!=Thread::THREAD_STATUS_TERMINATED)
+		return true;
+	m_threadStopEvent.ResetEvent();
+	return Start();
+}
+
+void TimerWheel::Close()
+{
+	if(GetStatus()!=Thread::THREAD_STATUS_TERMINATED)
+	{
+		m_threadStopEvent.SetEvent();
+		TerminateAfter(m_waitTime);
+	}
+
+	vector<Timer*> cancelledList;
+	epl::LockObj lock(m_timerLock);
+	for(unsigned int levelTrav=0;levelTrav<TIMER_WHEEL_LEVEL_COUNT;levelTrav++)
+	{
+		for(unsigned int slotTrav=0;slotTrav<SLOT_COUNT;slotTrav++)
+		{
+			while(m_slotList[levelTrav][slotTrav])
+			{
+				Timer *timer=m_slotList[levelTrav][slotTrav];
+				unlink(timer);
+				cancelledList.push_back(timer);
+			}
+		}
+	}
+	for(int trav=0;trav<cancelledList.size();trav++)
+	{
+		if(cancelledList.at(trav)->m_target)
+			cancelledList.at(trav)->m_target->ReleaseObj();
+	}
+}
+
+void TimerWheel::Arm(Timer *timer,unsigned int delayMilliSec)
+{
+	epl::LockObj lock(m_timerLock);
+	// the expiry not called back yet is superseded, and its reference is released by the wheel thread
+	timer->m_isExpiring=false;
+	if(timer->m_isArmed)
+		unlink(timer);
+	else if(timer->m_target)
+		timer->m_target->RetainObj();
+	unsigned int delayTick=ToTick(delayMilliSec);
+	if(delayTick==0)
+		delayTick=1;
+	timer->m_expireTick=m_currentTick+delayTick;
+	link(timer);
+}
+
+bool TimerWheel::Cancel(Timer *timer)
+{
+	epl::SmartObject *target=NULL;
+	{
+		epl::LockObj lock(m_timerLock);
+		// the expiry already pulled off the slot is dropped, and its reference is released by the wheel thread
+		if(timer->m_isExpiring)
+		{
+			timer->m_isExpiring=false;
+			return true;
+		}
+		if(!timer->m_isArmed)
+			return false;
+		unlink(timer);
+		target=timer->m_target;
+	}
+	// the target may be released to the deletion, so it is released out of the lock
+	if(target)
+		target->ReleaseObj();
+	return true;
+}
+
+unsigned int TimerWheel::GetCurrentTick() const
+{
+	return m_currentTick;
+}
+
+unsigned int TimerWheel::GetTickMilliSec() const
+{
+	return m_tickMilliSec;
+}
+
+unsigned int TimerWheel::ToTick(unsigned int milliSec) const
+{
+	return milliSec/m_tickMilliSec+((milliSec%m_tickMilliSec)?1:0);
+}
+
+void TimerWheel::link(Timer *timer)
+{
+	// the level is chosen by how far the expire tick is, so each level is cascaded down once
+	unsigned int delayTick=timer->m_expireTick-m_currentTick;
+	unsigned int maxDelayTick=(1<<(TIMER_WHEEL_SLOT_BITS*TIMER_WHEEL_LEVEL_COUNT))-1;
+	if(delayTick>maxDelayTick)
+	{
+		delayTick=maxDelayTick;
+		timer->m_expireTick=m_currentTick+delayTick;
+	}
+	unsigned int level=0;
+	while(level<TIMER_WHEEL_LEVEL_COUNT-1 && delayTick>=(1u<<(TIMER_WHEEL_SLOT_BITS*(level+1))))
+		level++;
+	unsigned int slot=(timer->m_expireTick>>(TIMER_WHEEL_SLOT_BITS*level))&(SLOT_COUNT-1);
+
+	timer->m_level=level;
+	timer->m_slot=slot;
+	timer->m_prev=NULL;
+	timer->m_next=m_slotList[level][slot];
+	if(timer->m_next)
+		timer->m_next->m_prev=timer;
+	m_slotList[level][slot]=timer;
+	timer->m_isArmed=true;
+}
+
+void TimerWheel::unlink(Timer *timer)
+{
+	if(timer->m_prev)
+		timer->m_prev->m_next=timer->m_next;
+	else
+		m_slotList[timer->m_level][timer->m_slot]=timer->m_next;
+	if(timer->m_next)
+		timer->m_next->m_prev=timer->m_prev;
+	timer->m_prev=NULL;
+	timer->m_next=NULL;
+	timer->m_isArmed=false;
+}
+
+void TimerWheel::advance(vector<Timer*> &retExpiredList)
+{
+	m_currentTick++;
+	unsigned int currentTick=m_currentTick;
+
+	// when a level wraps around, the next slot of the upper level is cascaded down
+	for(unsigned int level=1;level<TIMER_WHEEL_LEVEL_COUNT;level++)
+	{
+		if(currentTick&((1u<<(TIMER_WHEEL_SLOT_BITS*level))-1))
+			break;
+		unsigned int slot=(currentTick>>(TIMER_WHEEL_SLOT_BITS*level))&(SLOT_COUNT-1);
+		Timer *timer=m_slotList[level][slot];
+		m_slotList[level][slot]=NULL;
+		while(timer)
+		{
+			Timer *nextTimer=timer->m_next;
+			link(timer);
+			timer=nextTimer;
+		}
+	}
+
+	unsigned int slot=currentTick&(SLOT_COUNT-1);
+	while(m_slotList[0][slot])
+	{
+		Timer *timer=m_slotList[0][slot];
+		unlink(timer);
+		timer->m_isExpiring=true;
+		retExpiredList.push_back(timer);
+	}
+}
+
+void TimerWheel::execute()
+{
+	unsigned int lastTime=System::GetTickCount();
+	vector<Timer*> expiredList;
+	while(!m_threadStopEvent.WaitForEvent(m_tickMilliSec))
+	{
+		// the ticks missed by the late wake-up are caught up at once
+		unsigned int elapsedTime=System::GetTickCount()-lastTime;
+		unsigned int tickCount=elapsedTime/m_tickMilliSec;
+		lastTime+=tickCount*m_tickMilliSec;
+
+		expiredList.clear();
+		{
+			epl::LockObj lock(m_timerLock);
+			for(unsigned int trav=0;trav<tickCount;trav++)
+				advance(expiredList);
+		}
+
+		// the callbacks run out of the lock, holding the reference taken when armed
+		for(int trav=0;trav<expiredList.size();trav++)
+		{
+			Timer *timer=expiredList.at(trav);
+			epl::SmartObject *target=timer->m_target;
+			// the timer cancelled or armed again since pulled off the slot is not called back
+			bool isExpiring;
+			{
+				epl::LockObj lock(m_timerLock);
+				isExpiring=timer->m_isExpiring;
+				timer->m_isExpiring=false;
+			}
+			if(isExpiring)
+				timer->onExpired();
+			if(target)
+				target->ReleaseObj();
+		}
+	}
+}
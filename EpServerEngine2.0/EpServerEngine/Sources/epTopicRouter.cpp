@@ -0,0 +1,245 @@
+/*! 
+TopicRouter for the EpServerEngine
+
+The MIT License (MIT)
+
+Copyright (c) 2012-2013 Woong Gyu La <juhgiyo@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "epTopicRouter.h"
+#include "epBaseSocket.h"
+
+#if defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif // defined(_DEBUG) && defined(EP_ENABLE_CRTDBG)
+
+using namespace epse;
+
+TopicRouter::TopicRouter(epl::LockPolicy lockPolicyType):m_exactTrie(epl::PATRICIA_TRIE_MODE_LOOP,epl::LOCK_POLICY_NONE),m_prefixTrie(epl::PATRICIA_TRIE_MODE_LOOP,epl::LOCK_POLICY_NONE)
+{
+	m_lockPolicy=lockPolicyType;
+	switch(lockPolicyType)
+	{
+	case epl::LOCK_POLICY_CRITICALSECTION:
+		m_routerLock=EP_NEW epl::CriticalSectionEx();
+		break;
+	case epl::LOCK_POLICY_MUTEX:
+		m_routerLock=EP_NEW epl::Mutex();
+		break;
+	case epl::LOCK_POLICY_NONE:
+		m_routerLock=EP_NEW epl::NoLock();
+		break;
+	default:
+		m_routerLock=NULL;
+		break;
+	}
+}
+
+TopicRouter::~TopicRouter()
+{
+	Clear();
+	if(m_routerLock)
+		EP_DELETE m_routerLock;
+	m_routerLock=NULL;
+}
+
+TopicRouter::TopicTrie *TopicRouter::getTrie(const TCHAR *topic,epl::EpTString &retKey)
+{
+	size_t topicLength=_tcslen(topic);
+	if(topicLength==0)
+		return NULL;
+	if(topic[topicLength-1]!=_T(TOPIC_WILDCARD))
+	{
+		retKey=topic;
+		return &m_exactTrie;
+	}
+	// the wildcard must be a level by itself
+	if(topicLength==1)
+	{
+		retKey=_T("");
+		return &m_prefixTrie;
+	}
+	if(topic[topicLength-2]!=_T(TOPIC_SEPARATOR))
+		return NULL;
+	retKey=epl::EpTString(topic,topicLength-2);
+	return &m_prefixTrie;
+}
+
+bool TopicRouter::Subscribe(BaseSocket *socket,const TCHAR *topic)
+{
+	epl::LockObj lock(m_routerLock);
+	epl::EpTString key;
+	TopicTrie *trie=getTrie(topic,key);
+	if(!trie)
+		return false;
+
+	SubscriptionMap::iterator subscriptionIter=m_subscriptionMap.find(socket);
+	if(subscriptionIter!=m_subscriptionMap.end() && subscriptionIter->second.count(topic))
+		return false;
+
+	SubscriberSet *subscriberSet=NULL;
+	if(!trie->Find(key.c_str(),subscriberSet))
+	{
+		subscriberSet=EP_NEW SubscriberSet();
+		trie->Insert(key.c_str(),subscriberSet);
+	}
+	subscriberSet->insert(socket);
+
+	if(subscriptionIter==m_subscriptionMap.end())
+	{
+		socket->RetainObj();
+		subscriptionIter=m_subscriptionMap.insert(SubscriptionMap::value_type(socket,set<epl::EpTString>())).first;
+	}
+	subscriptionIter->second.insert(topic);
+	return true;
+}
+
+bool TopicRouter::Unsubscribe(BaseSocket *socket,const TCHAR *topic)
+{
+	bool isLastSubscription=false;
+	{
+		epl::LockObj lock(m_routerLock);
+		SubscriptionMap::iterator subscriptionIter=m_subscriptionMap.find(socket);
+		if(subscriptionIter==m_subscriptionMap.end() || !subscriptionIter->second.erase(topic))
+			return false;
+		removeSubscriber(socket,topic);
+		if(subscriptionIter->second.empty())
+		{
+			m_subscriptionMap.erase(subscriptionIter);
+			isLastSubscription=true;
+		}
+	}
+	// released out of the lock since it may delete the socket
+	if(isLastSubscription)
+		socket->ReleaseObj();
+	return true;
+}
+
+void TopicRouter::UnsubscribeAll(BaseSocket *socket)
+{
+	{
+		epl::LockObj lock(m_routerLock);
+		SubscriptionMap::iterator subscriptionIter=m_subscriptionMap.find(socket);
+		if(subscriptionIter==m_subscriptionMap.end())
+			return;
+		set<epl::EpTString>::iterator topicIter;
+		for(topicIter=subscriptionIter->second.begin();topicIter!=subscriptionIter->second.end();topicIter++)
+		{
+			removeSubscriber(socket,topicIter->c_str());
+		}
+		m_subscriptionMap.erase(subscriptionIter);
+	}
+	socket->ReleaseObj();
+}
+
+void TopicRouter::Clear()
+{
+	vector<BaseSocket*> socketList;
+	{
+		epl::LockObj lock(m_routerLock);
+		SubscriptionMap::iterator subscriptionIter;
+		for(subscriptionIter=m_subscriptionMap.begin();subscriptionIter!=m_subscriptionMap.end();subscriptionIter++)
+		{
+			set<epl::EpTString>::iterator topicIter;
+			for(topicIter=subscriptionIter->second.begin();topicIter!=subscriptionIter->second.end();topicIter++)
+			{
+				removeSubscriber(subscriptionIter->first,topicIter->c_str());
+			}
+			socketList.push_back(subscriptionIter->first);
+		}
+		m_subscriptionMap.clear();
+	}
+	for(int trav=0;trav<socketList.size();trav++)
+	{
+		socketList.at(trav)->ReleaseObj();
+	}
+}
+
+void TopicRouter::removeSubscriber(BaseSocket *socket,const TCHAR *topic)
+{
+	epl::EpTString key;
+	TopicTrie *trie=getTrie(topic,key);
+	SubscriberSet *subscriberSet=NULL;
+	if(!trie || !trie->Find(key.c_str(),subscriberSet))
+		return;
+	subscriberSet->erase(socket);
+	// the empty topic is removed, so the trie does not grow with the topics no longer used
+	if(subscriberSet->empty())
+	{
+		trie->Erase(key.c_str());
+		EP_DELETE subscriberSet;
+	}
+}
+
+void TopicRouter::findSubscriber(const TopicTrie &trie,const TCHAR *key,vector<SubscriberSet*> &retSubscriberList)
+{
+	SubscriberSet *subscriberSet=NULL;
+	if(trie.Find(key,subscriberSet))
+		retSubscriberList.push_back(subscriberSet);
+}
+
+void TopicRouter::Find(const TCHAR *topic,vector<BaseSocket*> &retSocketList) const
+{
+	size_t topicLength=_tcslen(topic);
+	if(topicLength==0)
+		return;
+
+	epl::LockObj lock(m_routerLock);
+	vector<SubscriberSet*> subscriberList;
+	findSubscriber(m_exactTrie,topic,subscriberList);
+
+	// the wildcard subscriptions are looked up at each level of the topic, terminating the copy in place
+	vector<TCHAR> prefix(topic,topic+topicLength+1);
+	findSubscriber(m_prefixTrie,_T(""),subscriberList);
+	for(size_t trav=1;trav<=topicLength;trav++)
+	{
+		if(trav<topicLength && prefix[trav]!=_T(TOPIC_SEPARATOR))
+			continue;
+		TCHAR separator=prefix[trav];
+		prefix[trav]=_T('\0');
+		findSubscriber(m_prefixTrie,&prefix[0],subscriberList);
+		prefix[trav]=separator;
+	}
+
+	if(subscriberList.empty())
+		return;
+
+	SubscriberSet mergedSet;
+	const SubscriberSet *resultSet=subscriberList.at(0);
+	// a socket subscribing to the matching topics more than once gets the packet only once
+	if(subscriberList.size()>1)
+	{
+		for(int trav=0;trav<subscriberList.size();trav++)
+		{
+			mergedSet.insert(subscriberList.at(trav)->begin(),subscriberList.at(trav)->end());
+		}
+		resultSet=&mergedSet;
+	}
+
+	retSocketList.reserve(retSocketList.size()+resultSet->size());
+	SubscriberSet::const_iterator socketIter;
+	for(socketIter=resultSet->begin();socketIter!=resultSet->end();socketIter++)
+	{
+		(*socketIter)->RetainObj();
+		retSocketList.push_back(*socketIter);
+	}
+}